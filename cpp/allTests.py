@@ -60,6 +60,7 @@ tests = [
     ("Ice/hold", ["core"]),
     ("Ice/custom", ["core", "nossl", "nows"]),
     ("Ice/retry", ["core"]),
+    ("Ice/hedging", ["core"]),
     ("Ice/timeout", ["core", "nocompress", "nosocks"]),
     ("Ice/acm", ["core"]),
     ("Ice/background", ["core", "nomingw", "nosocks"]),
@@ -77,7 +78,9 @@ tests = [
     ("Ice/enums", ["once"]),
     ("Ice/logger", ["once"]),
     ("Ice/networkProxy", ["core", "noipv6", "nosocks"]),
+    ("Ice/perMessageDeflate", ["once", "nowin32"]), # zlib isn't available on Windows.
     ("Ice/services", ["once"]),
+    ("Perf/marshal", ["once", "novalgrind"]), # Marshaling benchmark, use --filter=Perf/marshal to run it alone.
     ("IceSSL/configuration", ["once", "novalgrind"]), # valgrind doesn't work well with openssl
     ("IceBox/configuration", ["core", "noipv6", "novc100", "nomingw", "nomx"]),
     ("IceBox/admin", ["core", "noipv6", "novc100", "nomingw", "nomx"]),
@@ -0,0 +1,40 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ARENA_H
+#define ICE_ARENA_H
+
+#include <Ice/Config.h>
+
+namespace IceInternal
+{
+
+//
+// Allocation functions for the instances of Slice classes with the
+// "cpp:arena" metadata.
+//
+// Instances are allocated sequentially from a chunk owned by the
+// calling thread, so all the instances unmarshaled for a request
+// share a few chunks instead of going through the heap one by one. A
+// chunk is freed as a unit once the thread moved on to another chunk
+// and all the instances allocated from it are destroyed. A long-lived
+// instance keeps its whole chunk alive, this is intended for
+// short-lived instances such as request and reply parameters.
+//
+ICE_API void* arenaAllocate(size_t);
+ICE_API void arenaFree(void*);
+
+//
+// Returns the number of chunks currently allocated by all the threads.
+//
+ICE_API int arenaChunkCount();
+
+}
+
+#endif
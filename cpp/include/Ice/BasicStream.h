@@ -23,6 +23,8 @@
 #include <Ice/StreamHelpers.h>
 #include <Ice/FactoryTable.h>
 
+#include <deque>
+
 namespace Ice
 {
 
@@ -53,7 +55,8 @@ public:
     {
         // Inlined for performance reasons.
 
-        if(_currentReadEncaps != &_preAllocatedReadEncaps || _currentWriteEncaps != &_preAllocatedWriteEncaps)
+        if(_currentReadEncaps != &_preAllocatedReadEncaps || _currentWriteEncaps != &_preAllocatedWriteEncaps ||
+           _stringViewHolders)
         {
             clear(); // Not inlined.
         }
@@ -434,6 +437,51 @@ public:
         }
     }
 
+    //
+    // Marshal packed structs (see Ice::StreamPackedTraits) with a copy of
+    // their memory. A struct can be larger than its encoding because of
+    // trailing padding, in which case the structs are copied one by one.
+    //
+    template<typename T> void writePacked(const T* v, Ice::Int sz)
+    {
+        const Container::size_type wireSize = Ice::StreamableTraits<T>::minWireSize;
+        Container::size_type position = b.size();
+        resize(position + sz * wireSize);
+        if(sizeof(T) == wireSize)
+        {
+            memcpy(&b[position], v, sz * wireSize);
+        }
+        else
+        {
+            for(Ice::Byte* p = &b[position]; p != b.end(); p += wireSize)
+            {
+                memcpy(p, v++, wireSize);
+            }
+        }
+    }
+
+    template<typename T> void readPacked(T* v, Ice::Int sz)
+    {
+        const Container::size_type wireSize = Ice::StreamableTraits<T>::minWireSize;
+        if(static_cast<Container::size_type>(b.end() - i) < sz * wireSize)
+        {
+            throwUnmarshalOutOfBoundsException(__FILE__, __LINE__);
+        }
+        if(sizeof(T) == wireSize)
+        {
+            memcpy(v, i, sz * wireSize);
+            i += sz * wireSize;
+        }
+        else
+        {
+            for(T* p = v; p != v + sz; ++p)
+            {
+                memcpy(p, i, wireSize);
+                i += wireSize;
+            }
+        }
+    }
+
     template<typename T> void write(const T& v)
     {
         Ice::StreamHelper<T, Ice::StreamableTraits<T>::helper>::write(this, v);
@@ -762,6 +810,7 @@ public:
                 readConverted(holder, sz);
                 vdata = holder.data();
                 vsize = holder.size();
+                i += sz;
             }
             else
             {
@@ -772,6 +821,23 @@ public:
         }
     }
 
+    //
+    // For string views: without a string converter, the returned data
+    // points into the stream buffer. Otherwise, the converted string is
+    // kept by the stream until it's cleared or destroyed.
+    //
+    void readStringView(const char*& vdata, size_t& vsize)
+    {
+        if(_stringConverter == 0)
+        {
+            read(vdata, vsize);
+        }
+        else
+        {
+            readConvertedView(vdata, vsize); // Not inlined.
+        }
+    }
+
     void read(std::vector<std::string>&, bool = true);
 
     void write(const std::wstring& v);
@@ -863,6 +929,7 @@ private:
     //
     void writeConverted(const char*, size_t);
     void readConverted(std::string&, Ice::Int);
+    void readConvertedView(const char*&, size_t&);
 
     //
     // I can't throw these exception from inline functions from within
@@ -890,6 +957,325 @@ private:
 
     typedef std::vector<Ice::ObjectPtr> ObjectList;
 
+    //
+    // Tables for the instance bookkeeping of the encapsulation decoders
+    // and encoders. Most object graphs are small: the tables use flat
+    // arrays with a linear search for the first SmallTableSize entries
+    // and avoid allocating a tree node per instance for larger graphs.
+    //
+    enum { SmallTableSize = 16 };
+
+    //
+    // An encoded instance takes at least 3 bytes (the 1.1 encoding of
+    // an instance with a compact type ID and its reference), the 1.0
+    // encoding is larger.
+    //
+    enum { MinInstanceSize = 3 };
+
+    //
+    // Maps instance IDs to values. Instance IDs are allocated
+    // sequentially from 1, so values are indexed directly by ID. A
+    // stream can't hold more instances than its size divided by
+    // MinInstanceSize: larger IDs can only come from invalid data and
+    // are kept in a map, so the table never has more entries than the
+    // stream can encode instances, whatever ID a peer sends.
+    //
+    template<typename T> class IndexToValueMap : private ::IceUtil::noncopyable
+    {
+    public:
+
+        IndexToValueMap() : _count(0)
+        {
+        }
+
+        T* find(Ice::Int index)
+        {
+            if(index <= 0)
+            {
+                return 0;
+            }
+            else if(index <= SmallTableSize)
+            {
+                Entry& e = _small[index - 1];
+                return e.set ? &e.value : 0;
+            }
+            else if(static_cast<size_t>(index - SmallTableSize) <= _large.size())
+            {
+                Entry& e = _large[index - SmallTableSize - 1];
+                return e.set ? &e.value : 0;
+            }
+            else if(!_sparse.empty())
+            {
+                typename std::map<Ice::Int, T>::iterator p = _sparse.find(index);
+                return p != _sparse.end() ? &p->second : 0;
+            }
+            return 0;
+        }
+
+        T& insert(Ice::Int index, size_t streamSize)
+        {
+            assert(index > 0);
+            Entry* e;
+            if(index <= SmallTableSize)
+            {
+                e = &_small[index - 1];
+            }
+            else if(static_cast<size_t>(index) <= streamSize / MinInstanceSize)
+            {
+                size_t pos = static_cast<size_t>(index - SmallTableSize - 1);
+                if(pos >= _large.size())
+                {
+                    _large.resize(pos + 1);
+                }
+                e = &_large[pos];
+            }
+            else
+            {
+                typename std::map<Ice::Int, T>::iterator p = _sparse.find(index);
+                if(p == _sparse.end())
+                {
+                    p = _sparse.insert(std::make_pair(index, T())).first;
+                    ++_count;
+                }
+                return p->second;
+            }
+
+            if(!e->set)
+            {
+                e->set = true;
+                ++_count;
+            }
+            return e->value;
+        }
+
+        void erase(Ice::Int index)
+        {
+            if(index <= 0)
+            {
+                return;
+            }
+            else if(index <= SmallTableSize)
+            {
+                erase(_small[index - 1]);
+            }
+            else if(static_cast<size_t>(index - SmallTableSize) <= _large.size())
+            {
+                erase(_large[index - SmallTableSize - 1]);
+            }
+            else if(_sparse.erase(index) > 0)
+            {
+                --_count;
+            }
+        }
+
+        bool empty() const
+        {
+            return _count == 0;
+        }
+
+    private:
+
+        struct Entry
+        {
+            Entry() : set(false)
+            {
+            }
+
+            T value;
+            bool set;
+        };
+
+        void erase(Entry& e)
+        {
+            if(e.set)
+            {
+                e.value = T();
+                e.set = false;
+                --_count;
+            }
+        }
+
+        Entry _small[SmallTableSize];
+        std::vector<Entry> _large;
+        std::map<Ice::Int, T> _sparse;
+        size_t _count;
+    };
+
+    //
+    // Maps instances to their ID. Instances are compared by identity:
+    // the entries are stored in insertion order in a vector and a hash
+    // table of positions into this vector, keyed by the address of the
+    // instance, is used once there are more than SmallTableSize
+    // entries.
+    //
+    class PtrToIndexMap : private ::IceUtil::noncopyable
+    {
+    public:
+
+        typedef std::vector<std::pair<Ice::ObjectPtr, Ice::Int> > EntryList;
+        typedef EntryList::const_iterator const_iterator;
+
+        const Ice::Int* find(const Ice::ObjectPtr& key) const
+        {
+            const Ice::Object* k = key.get();
+            if(_table.empty())
+            {
+                for(const_iterator p = _entries.begin(); p != _entries.end(); ++p)
+                {
+                    if(p->first.get() == k)
+                    {
+                        return &p->second;
+                    }
+                }
+                return 0;
+            }
+
+            size_t mask = _table.size() - 1;
+            for(size_t n = hash(k) & mask; _table[n] != 0; n = (n + 1) & mask)
+            {
+                const std::pair<Ice::ObjectPtr, Ice::Int>& e = _entries[_table[n] - 1];
+                if(e.first.get() == k)
+                {
+                    return &e.second;
+                }
+            }
+            return 0;
+        }
+
+        void insert(const Ice::ObjectPtr& key, Ice::Int value)
+        {
+            _entries.push_back(std::make_pair(key, value));
+            if(_entries.size() > SmallTableSize)
+            {
+                if(_entries.size() * 2 > _table.size())
+                {
+                    rehash();
+                }
+                else
+                {
+                    add(_entries.size());
+                }
+            }
+        }
+
+        const_iterator begin() const
+        {
+            return _entries.begin();
+        }
+
+        const_iterator end() const
+        {
+            return _entries.end();
+        }
+
+        size_t size() const
+        {
+            return _entries.size();
+        }
+
+        bool empty() const
+        {
+            return _entries.empty();
+        }
+
+        void swap(PtrToIndexMap& other)
+        {
+            _entries.swap(other._entries);
+            _table.swap(other._table);
+        }
+
+        void clear()
+        {
+            _entries.clear();
+            _table.clear();
+        }
+
+    private:
+
+        static size_t hash(const Ice::Object* p)
+        {
+            size_t h = reinterpret_cast<size_t>(p);
+            return (h >> 4) ^ (h >> 12);
+        }
+
+        void add(size_t pos)
+        {
+            size_t mask = _table.size() - 1;
+            size_t n = hash(_entries[pos - 1].first.get()) & mask;
+            while(_table[n] != 0)
+            {
+                n = (n + 1) & mask;
+            }
+            _table[n] = pos;
+        }
+
+        void rehash()
+        {
+            size_t size = _table.empty() ? SmallTableSize * 4 : _table.size() * 2;
+            _table.assign(size, 0);
+            for(size_t pos = 1; pos <= _entries.size(); ++pos)
+            {
+                add(pos);
+            }
+        }
+
+        EntryList _entries;
+        std::vector<size_t> _table; // Positions + 1 in _entries, 0 for empty slots.
+    };
+
+    //
+    // Maps type IDs to their ID. There are few type IDs in most
+    // encapsulations, they are looked up with a linear search until
+    // there are more than SmallTableSize entries.
+    //
+    class TypeIdWriteMap : private ::IceUtil::noncopyable
+    {
+    public:
+
+        const Ice::Int* find(const std::string& typeId) const
+        {
+            if(_map.empty())
+            {
+                for(std::vector<std::pair<std::string, Ice::Int> >::const_iterator p = _entries.begin();
+                    p != _entries.end(); ++p)
+                {
+                    if(p->first == typeId)
+                    {
+                        return &p->second;
+                    }
+                }
+                return 0;
+            }
+            else
+            {
+                std::map<std::string, Ice::Int>::const_iterator p = _map.find(typeId);
+                return p != _map.end() ? &p->second : 0;
+            }
+        }
+
+        void insert(const std::string& typeId, Ice::Int value)
+        {
+            if(_map.empty() && _entries.size() < SmallTableSize)
+            {
+                _entries.push_back(std::make_pair(typeId, value));
+            }
+            else
+            {
+                if(_map.empty())
+                {
+                    _map.insert(_entries.begin(), _entries.end());
+                    _entries.clear();
+                }
+                _map.insert(std::make_pair(typeId, value));
+            }
+        }
+
+    private:
+
+        std::vector<std::pair<std::string, Ice::Int> > _entries;
+        std::map<std::string, Ice::Int> _map;
+    };
+
     class ICE_API EncapsDecoder : private ::IceUtil::noncopyable
     {
     public:
@@ -917,7 +1303,7 @@ private:
     protected:
 
         EncapsDecoder(BasicStream* stream, ReadEncaps* encaps, bool sliceObjects, const ObjectFactoryManagerPtr& f) :
-            _stream(stream), _encaps(encaps), _sliceObjects(sliceObjects), _servantFactoryManager(f), _typeIdIndex(0)
+            _stream(stream), _encaps(encaps), _sliceObjects(sliceObjects), _servantFactoryManager(f)
         {
         }
 
@@ -927,8 +1313,8 @@ private:
         void addPatchEntry(Ice::Int, PatchFunc, void*);
         void unmarshal(Ice::Int, const Ice::ObjectPtr&);
 
-        typedef std::map<Ice::Int, Ice::ObjectPtr> IndexToPtrMap;
-        typedef std::map<Ice::Int, std::string> TypeIdReadMap;
+        typedef IndexToValueMap<Ice::ObjectPtr> IndexToPtrMap;
+        typedef std::vector<std::string> TypeIdReadList;
 
         struct PatchEntry
         {
@@ -936,7 +1322,7 @@ private:
             void* patchAddr;
         };
         typedef std::vector<PatchEntry> PatchList;
-        typedef std::map<Ice::Int, PatchList> PatchMap;
+        typedef IndexToValueMap<PatchList> PatchMap;
 
         BasicStream* _stream;
         ReadEncaps* _encaps;
@@ -950,8 +1336,7 @@ private:
 
         // Encapsulation attributes for object un-marshalling
         IndexToPtrMap _unmarshaledMap;
-        TypeIdReadMap _typeIdMap;
-        Ice::Int _typeIdIndex;
+        TypeIdReadList _typeIds;
         ObjectList _objectList;
     };
 
@@ -1112,9 +1497,6 @@ private:
         BasicStream* _stream;
         WriteEncaps* _encaps;
 
-        typedef std::map<Ice::ObjectPtr, Ice::Int> PtrToIndexMap;
-        typedef std::map<std::string, Ice::Int> TypeIdWriteMap;
-
         // Encapsulation attributes for object marshalling.
         PtrToIndexMap _marshaledMap;
 
@@ -1308,6 +1690,11 @@ private:
 
     int _startSeq;
     int _minSeqSize;
+
+    //
+    // The converted strings returned by readStringView.
+    //
+    std::deque<std::string>* _stringViewHolders;
 };
 
 } // End namespace IceInternal
@@ -0,0 +1,256 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_COROUTINE_H
+#define ICE_COROUTINE_H
+
+#include <Ice/Config.h>
+
+#ifdef ICE_CPP_COROUTINES
+
+#include <Ice/AsyncResult.h>
+#include <Ice/IncomingAsync.h>
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+
+namespace IceInternal
+{
+
+//
+// The AMI callback of an AsyncAwaiter. The invocation can complete
+// before or after the coroutine is suspended: the first of completed()
+// and suspend() to run records it in _state, and the second one
+// resumes the coroutine (or doesn't suspend it).
+//
+class CoroutineCallback : public GenericCallbackBase
+{
+public:
+
+    CoroutineCallback() : _state(0)
+    {
+    }
+
+    virtual void completed(const ::Ice::AsyncResultPtr& result) const
+    {
+        _result = result;
+        void* state = _state.exchange(const_cast<CoroutineCallback*>(this), ::std::memory_order_acq_rel);
+        if(state)
+        {
+            //
+            // The coroutine is resumed from the thread that completes
+            // the invocation, usually a client thread pool thread.
+            //
+            ::std::coroutine_handle<>::from_address(state).resume();
+        }
+    }
+
+    virtual CallbackBasePtr verify(const ::Ice::LocalObjectPtr&)
+    {
+        return this;
+    }
+
+    virtual void sent(const ::Ice::AsyncResultPtr&) const
+    {
+    }
+
+    virtual bool hasSentCallback() const
+    {
+        return false;
+    }
+
+    bool suspend(::std::coroutine_handle<> handle)
+    {
+        void* state = 0;
+        return _state.compare_exchange_strong(state, handle.address(), ::std::memory_order_acq_rel);
+    }
+
+    const ::Ice::AsyncResultPtr& result() const
+    {
+        return _result;
+    }
+
+private:
+
+    mutable ::Ice::AsyncResultPtr _result;
+    mutable ::std::atomic<void*> _state;
+};
+typedef IceUtil::Handle<CoroutineCallback> CoroutineCallbackPtr;
+
+template<typename T>
+struct IsAMDCallback : ::std::false_type
+{
+};
+
+template<typename T>
+struct IsAMDCallback< ::IceUtil::Handle<T> > : ::std::is_base_of< ::Ice::AMDCallback, T>
+{
+};
+
+}
+
+namespace Ice
+{
+
+//
+// An AsyncAwaiter resumes the coroutine that awaits it once the
+// invocation started with its callback completes, for example:
+//
+// Ice::AsyncAwaiter awaiter;
+// proxy->begin_op(arg, awaiter.callback());
+// Ice::AsyncResultPtr r = co_await awaiter;
+// int ret = proxy->end_op(r);
+//
+// slice2cpp generates co_ methods that do the first two steps for
+// the operations of interfaces with the "cpp:coroutine" metadata:
+//
+// int ret = proxy->end_op(co_await proxy->co_op(arg));
+//
+// The coroutine is resumed from the thread that completes the
+// invocation, so the same restrictions apply as for AMI callbacks:
+// it must not make blocking invocations before it's suspended again.
+//
+class AsyncAwaiter
+{
+public:
+
+    AsyncAwaiter() :
+        _callback(new ::IceInternal::CoroutineCallback)
+    {
+    }
+
+    CallbackPtr callback() const
+    {
+        return _callback;
+    }
+
+    bool await_ready() const
+    {
+        return false;
+    }
+
+    bool await_suspend(::std::coroutine_handle<> handle)
+    {
+        return _callback->suspend(handle);
+    }
+
+    AsyncResultPtr await_resume() const
+    {
+        return _callback->result();
+    }
+
+private:
+
+    ::IceInternal::CoroutineCallbackPtr _callback;
+};
+
+//
+// The return type of coroutines that implement AMD operations. The
+// coroutine runs until it's first suspended when it's called and the
+// AMD callback passed as a parameter is used to report exceptions
+// that the coroutine doesn't catch, for example:
+//
+// virtual void op_async(const AMD_Intf_opPtr& cb, int arg, const Ice::Current&)
+// {
+//     opCoroutine(cb, arg);
+// }
+//
+// Ice::DispatchTask opCoroutine(AMD_Intf_opPtr cb, int arg)
+// {
+//     cb->ice_response(_other->end_op(co_await _other->co_op(arg)));
+// }
+//
+// The parameters must be passed by value since the coroutine outlives
+// the dispatch.
+//
+class DispatchTask
+{
+public:
+
+    class promise_type
+    {
+    public:
+
+        template<typename... Args>
+        promise_type(const Args&... args) :
+            _callback(findCallback(args...))
+        {
+        }
+
+        DispatchTask get_return_object()
+        {
+            return DispatchTask();
+        }
+
+        ::std::suspend_never initial_suspend() noexcept
+        {
+            return ::std::suspend_never();
+        }
+
+        ::std::suspend_never final_suspend() noexcept
+        {
+            return ::std::suspend_never();
+        }
+
+        void return_void()
+        {
+        }
+
+        void unhandled_exception()
+        {
+            if(!_callback)
+            {
+                throw;
+            }
+
+            try
+            {
+                throw;
+            }
+            catch(const ::std::exception& ex)
+            {
+                _callback->ice_exception(ex);
+            }
+            catch(...)
+            {
+                _callback->ice_exception();
+            }
+        }
+
+    private:
+
+        static ::IceUtil::Handle<AMDCallback> findCallback()
+        {
+            return 0;
+        }
+
+        template<typename T, typename... Args>
+        static ::IceUtil::Handle<AMDCallback> findCallback(const T& arg, const Args&... args)
+        {
+            if constexpr(::IceInternal::IsAMDCallback<T>::value)
+            {
+                return arg;
+            }
+            else
+            {
+                return findCallback(args...);
+            }
+        }
+
+        ::IceUtil::Handle<AMDCallback> _callback;
+    };
+};
+
+}
+
+#endif
+
+#endif
@@ -19,6 +19,7 @@
 #include <Ice/Current.h>
 #include <Ice/IncomingAsyncF.h>
 #include <Ice/ObserverHelper.h>
+#include <Ice/TraceSpan.h>
 #include <Ice/ResponseHandlerF.h>
 
 #include <deque>
@@ -53,10 +54,12 @@ protected:
     void __handleException(bool);
 
     Ice::Current _current;
+    Ice::Long _deadline;
     Ice::ObjectPtr _servant;
     Ice::ServantLocatorPtr _locator;
     Ice::LocalObjectPtr _cookie;
     DispatchObserver _observer;
+    TraceSpan _span;
     bool _response;
     Ice::Byte _compress;
 
@@ -93,7 +96,12 @@ public:
         return _inParamPos != 0;
     }
 
-    void invoke(const ServantManagerPtr&, BasicStream*);
+    //
+    // The monotonic time at which the request was read from the
+    // connection. It's used to charge the time the request spent
+    // queued against its deadline and to start its trace span.
+    //
+    void invoke(const ServantManagerPtr&, BasicStream*, const IceUtil::Time& = IceUtil::Time());
 
     // Inlined for speed optimization.
     BasicStream* startReadParams()
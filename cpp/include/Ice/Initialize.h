@@ -122,6 +122,13 @@ ICE_API OutputStreamPtr createOutputStream(const CommunicatorPtr&, const Encodin
 ICE_API LoggerPtr getProcessLogger();
 ICE_API void setProcessLogger(const LoggerPtr&);
 
+//
+// Returns the deadline of the request dispatched by the calling
+// thread, in milliseconds on the monotonic clock, or 0 if the thread
+// isn't dispatching a request or the request doesn't have a deadline.
+//
+ICE_API Long getDispatchDeadline();
+
 typedef Ice::Plugin* (*PLUGIN_FACTORY)(const ::Ice::CommunicatorPtr&, const std::string&, const ::Ice::StringSeq&);
 ICE_API void registerPluginFactory(const std::string&, PLUGIN_FACTORY, bool);
 
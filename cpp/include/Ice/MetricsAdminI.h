@@ -39,6 +39,57 @@ namespace IceMX
 class Updater;
 template<typename T> class MetricsHelperT;
 
+//
+// The buckets of latency histograms, see IceMX::LatencyHistogram.
+//
+const int latencyBucketCount = 128;
+ICE_API int getLatencyBucket(Ice::Long);
+ICE_API Ice::Long getLatencyBucketUpperBound(int);
+
+ICE_API void addLatency(LatencyHistogram&, Ice::Long);
+
+inline void
+addLatency(IceUtil::Optional<LatencyHistogram>& histogram, Ice::Long latency)
+{
+    if(!histogram)
+    {
+        histogram = LatencyHistogram();
+    }
+    addLatency(*histogram, latency);
+}
+
+//
+// Returns the upper bound of the bucket which holds the given
+// percentile of the histogram samples, or 0 if it's empty.
+//
+ICE_API Ice::Long getLatencyPercentile(const LatencyHistogram&, double);
+
+//
+// Only the dispatch and invocation metrics have a latency histogram.
+//
+inline void
+addLatency(Metrics*, Ice::Long)
+{
+}
+
+inline void
+addLatency(DispatchMetrics* metrics, Ice::Long latency)
+{
+    addLatency(metrics->latency, latency);
+}
+
+inline void
+addLatency(InvocationMetrics* metrics, Ice::Long latency)
+{
+    addLatency(metrics->latency, latency);
+}
+
+inline void
+addLatency(ChildInvocationMetrics* metrics, Ice::Long latency)
+{
+    addLatency(metrics->latency, latency);
+}
+
 }
 
 namespace IceInternal
@@ -147,12 +198,19 @@ public:
     class EntryT;
     typedef IceUtil::Handle<EntryT> EntryTPtr;
 
+    //
+    // The metrics object of an entry is protected by the entry mutex,
+    // the map mutex only protects the entries of the map and the
+    // detached queue. Observers of different entries of the same map
+    // don't contend with each other. The map mutex is always locked
+    // before the entry mutex.
+    //
     class EntryT : public Ice::LocalObject
     {
     public:
 
         EntryT(MetricsMapT* map, const TPtr& object, const typename std::list<EntryTPtr>::iterator& p) : 
-            _map(map), _object(object), _detachedPos(p)
+            _map(map), _object(object), _detachedPos(p), _removed(false)
         {
         }
 
@@ -169,7 +227,7 @@ public:
         void  
         failed(const std::string& exceptionName)
         {
-            IceUtil::Mutex::Lock sync(*_map);
+            IceUtil::Mutex::Lock sync(_mutex);
             ++_object->failures;
             ++_failures[exceptionName];
         }
@@ -179,7 +237,7 @@ public:
         {
             MetricsMapIPtr m;
             {
-                IceUtil::Mutex::Lock sync(*_map);
+                IceUtil::Mutex::Lock sync(_mutex);
                 typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> >::iterator p = 
                     _subMaps.find(mapName);
                 if(p == _subMaps.end())
@@ -205,18 +263,28 @@ public:
         void
         detach(Ice::Long lifetime)
         {
-            IceUtil::Mutex::Lock sync(*_map);
-            _object->totalLifetime += lifetime;
-            if(--_object->current == 0)
             {
-                _map->detached(this);
+                IceUtil::Mutex::Lock sync(_mutex);
+                _object->totalLifetime += lifetime;
+                IceMX::addLatency(_object.get(), lifetime);
+                if(--_object->current > 0)
+                {
+                    return;
+                }
             }
+
+            //
+            // The entry might have been attached again once its mutex
+            // is released, detached() checks it with the map locked.
+            //
+            IceUtil::Mutex::Lock sync(*_map);
+            _map->detached(this);
         }
 
         template<typename Function> void
         execute(Function func)
         {
-            IceUtil::Mutex::Lock sync(*_map);
+            IceUtil::Mutex::Lock sync(_mutex);
             func(_object);
         }
 
@@ -232,6 +300,7 @@ public:
         IceMX::MetricsFailures
         getFailures() const
         {
+            IceUtil::Mutex::Lock sync(_mutex);
             IceMX::MetricsFailures f;
             f.id = _object->id;
             f.failures = _failures;
@@ -241,6 +310,7 @@ public:
         IceMX::MetricsPtr
         clone() const
         {
+            IceUtil::Mutex::Lock sync(_mutex);
             TPtr metrics = TPtr::dynamicCast(_object->ice_clone());
             for(typename std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> >::const_iterator p =
                     _subMaps.begin(); p != _subMaps.end(); ++p)
@@ -253,12 +323,14 @@ public:
         bool 
         isDetached() const
         {
+            IceUtil::Mutex::Lock sync(_mutex);
             return _object->current == 0;
         }
 
         void
         attach(const IceMX::MetricsHelperT<T>& helper)
         {
+            IceUtil::Mutex::Lock sync(_mutex);
             ++_object->total;
             ++_object->current;
             helper.initMetrics(_object);
@@ -266,10 +338,12 @@ public:
 
         friend class MetricsMapT;
         MetricsMapTPtr _map;
+        IceUtil::Mutex _mutex;
         TPtr _object;
         IceMX::StringIntDict _failures;
         std::map<std::string, std::pair<MetricsMapIPtr, SubMapMember> > _subMaps;
         typename std::list<EntryTPtr>::iterator _detachedPos;
+        bool _removed;
     };
 
     MetricsMapT(const std::string& mapPrefix,
@@ -460,7 +534,7 @@ private:
     {
         // This is called with the map mutex locked.
 
-        if(_retain == 0 || _destroyed)
+        if(_retain == 0 || _destroyed || entry->_removed || !entry->isDetached())
         {
             return;
         }
@@ -500,6 +574,7 @@ private:
         // If there's still no room, remove the oldest entry (at the front).
         if(static_cast<int>(_detachedQueue.size()) == _retain)
         {
+            _detachedQueue.front()->_removed = true;
             _objects.erase(_detachedQueue.front()->_object->id);
             _detachedQueue.pop_front();
         }
@@ -10,6 +10,8 @@
 #ifndef ICE_METRICSFUNCTIONAL_H
 #define ICE_METRICSFUNCTIONAL_H
 
+#include <IceUtil/Optional.h>
+
 namespace IceInternal
 {
 
@@ -106,6 +108,17 @@ template<typename T> struct Increment
     }
 };
 
+//
+// Optional metrics start at 0 on their first increment.
+//
+template<typename T> struct Increment<IceUtil::Optional<T> >
+{
+    void operator()(IceUtil::Optional<T>& v)
+    {
+        v = v ? *v + 1 : 1;
+    }
+};
+
 template<typename T> struct Add
 {
     Add(T value) : value(value) { }
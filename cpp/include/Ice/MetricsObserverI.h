@@ -447,14 +447,22 @@ public:
     ObserverImplPtrType
     getObserver(const MetricsHelperT<MetricsType>& helper)
     {
-        IceUtil::Mutex::Lock sync(*this);
-        if(!_metrics)
+        //
+        // The attributes are resolved and the entries are looked up
+        // without the factory mutex, each map has its own.
+        //
+        MetricsMapSeqType maps;
         {
-            return 0;
+            IceUtil::Mutex::Lock sync(*this);
+            if(!_metrics)
+            {
+                return 0;
+            }
+            maps = _maps;
         }
 
         typename ObserverImplType::EntrySeqType metricsObjects;
-        for(typename MetricsMapSeqType::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+        for(typename MetricsMapSeqType::const_iterator p = maps.begin(); p != maps.end(); ++p)
         {
             typename ObserverImplType::EntryPtrType entry = (*p)->getMatching(helper);
             if(entry)
@@ -482,14 +490,18 @@ public:
             return getObserver(helper);
         }
 
-        IceUtil::Mutex::Lock sync(*this);
-        if(!_metrics)
+        MetricsMapSeqType maps;
         {
-            return 0;
+            IceUtil::Mutex::Lock sync(*this);
+            if(!_metrics)
+            {
+                return 0;
+            }
+            maps = _maps;
         }
 
         typename ObserverImplType::EntrySeqType metricsObjects;
-        for(typename MetricsMapSeqType::const_iterator p = _maps.begin(); p != _maps.end(); ++p)
+        for(typename MetricsMapSeqType::const_iterator p = maps.begin(); p != maps.end(); ++p)
         {
             typename ObserverImplType::EntryPtrType entry = (*p)->getMatching(helper, old->getEntry(p->get()));
             if(entry)
@@ -138,6 +138,19 @@ public:
         }
     }
 
+    void hedged()
+    {
+        if(_observer)
+        {
+            ::Ice::Instrumentation::HedgedInvocationObserverPtr observer =
+                ::Ice::Instrumentation::HedgedInvocationObserverPtr::dynamicCast(_observer);
+            if(observer)
+            {
+                observer->hedged();
+            }
+        }
+    }
+
     ::Ice::Instrumentation::ChildInvocationObserverPtr
     getRemoteObserver(const Ice::ConnectionInfoPtr& con, const Ice::EndpointPtr& endpt, int requestId, int size)
     {
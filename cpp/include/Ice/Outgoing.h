@@ -15,12 +15,14 @@
 #include <IceUtil/UniquePtr.h>
 
 #include <Ice/RequestHandlerF.h>
+#include <Ice/OutgoingAsyncF.h>
 #include <Ice/InstanceF.h>
 #include <Ice/ConnectionIF.h>
 #include <Ice/ReferenceF.h>
 #include <Ice/BasicStream.h>
 #include <Ice/Current.h>
 #include <Ice/ObserverHelper.h>
+#include <Ice/TraceSpan.h>
 #include <Ice/ObjectAdapterF.h>
 
 namespace Ice
@@ -91,6 +93,7 @@ public:
 protected:
 
     bool invokeImpl(); // Returns true if ok, false if user exception.
+    void startHedging(const std::string&);
 
     //
     // Optimization. The request handler and the reference may not be
@@ -100,6 +103,7 @@ protected:
     Ice::OperationMode _mode;
     RequestHandlerPtr _handler;
     IceUtil::Time _invocationTimeoutDeadline;
+    TraceSpan _span;
 
     enum
     {
@@ -111,6 +115,18 @@ protected:
         StateLocalException,
         StateFailed
     } _state;
+
+private:
+
+    void hedge();
+
+    //
+    // Set if the invocation is hedged, see HedgeManager.
+    //
+    const std::string* _hedgeOperation;
+    IceUtil::Time _hedgeStart;
+    IceUtil::Time _hedgeDeadline;
+    HedgeRequestPtr _hedge;
 };
 
 class ICE_API Outgoing : public ProxyOutgoingBase
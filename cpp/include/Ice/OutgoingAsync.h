@@ -16,6 +16,7 @@
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionIF.h>
 #include <Ice/ObjectAdapterF.h>
+#include <Ice/TraceSpan.h>
 
 namespace IceInternal
 {
@@ -91,6 +92,7 @@ public:
     virtual Ice::ObjectPrx getProxy() const;
 
     using OutgoingAsyncBase::sent;
+    using OutgoingAsyncBase::completed;
     virtual bool completed(const Ice::Exception&);
     void retryException(const Ice::Exception&);
     virtual void cancelable(const CancellationHandlerPtr&);
@@ -98,12 +100,16 @@ public:
     void retry();
     void abort(const Ice::Exception&);
 
+    void hedge();
+    void hedgeReplied();
+
 protected:
 
     ProxyOutgoingAsyncBase(const Ice::ObjectPrx&, const std::string&, const CallbackBasePtr&,
                            const Ice::LocalObjectPtr&);
 
     void invokeImpl(bool);
+    void startHedging();
 
     bool sent(bool);
     bool finished(const Ice::Exception&);
@@ -115,11 +121,22 @@ protected:
     const Ice::ObjectPrx _proxy;
     RequestHandlerPtr _handler;
     Ice::OperationMode _mode;
+    TraceSpan _span;
 
 private:
 
+    HedgeRequestPtr stopHedging();
+
     int _cnt;
     bool _sent;
+
+    //
+    // Set if the invocation is hedged, see HedgeManager.
+    //
+    IceUtil::Time _hedgeStart;
+    IceUtil::TimerTaskPtr _hedgeTask;
+    Ice::ConnectionIPtr _hedgeConnection;
+    HedgeRequestPtr _hedge;
 };
 
 //
@@ -29,6 +29,10 @@ class ProxyOutgoingAsyncBase;
 ICE_API IceUtil::Shared* upCast(ProxyOutgoingAsyncBase*);
 typedef IceInternal::Handle<ProxyOutgoingAsyncBase> ProxyOutgoingAsyncBasePtr;
 
+class HedgeRequest;
+ICE_API IceUtil::Shared* upCast(HedgeRequest*);
+typedef IceInternal::Handle<HedgeRequest> HedgeRequestPtr;
+
 class CommunicatorFlushBatchAsync;
 ICE_API IceUtil::Shared* upCast(CommunicatorFlushBatchAsync*);
 typedef IceInternal::Handle<CommunicatorFlushBatchAsync> CommunicatorFlushBatchAsyncPtr;
@@ -18,6 +18,7 @@
 #include <Ice/SlicedDataF.h>
 #include <IceUtil/Shared.h>
 #include <Ice/StreamHelpers.h>
+#include <deque>
 
 namespace Ice
 {
@@ -196,6 +197,24 @@ public:
     virtual void read(::std::string&, bool = true) = 0;
     virtual void read(const char*&, size_t&) = 0;
     virtual void read(const char*&, size_t&, std::string&) = 0;
+
+    //
+    // Reads a string view, its data remains valid until the stream is
+    // destroyed. The default implementation keeps the strings which
+    // don't point into the stream buffer.
+    //
+    virtual void readStringView(const char*& vdata, size_t& vsize)
+    {
+        ::std::string holder;
+        read(vdata, vsize, holder);
+        if(!holder.empty())
+        {
+            _stringViewHolders.push_back(::std::string());
+            _stringViewHolders.back().swap(holder);
+            vdata = _stringViewHolders.back().data();
+        }
+    }
+
     virtual void read(::std::vector< ::std::string>&, bool) = 0; // Overload required for additional bool argument.
     virtual void read(::std::wstring&) = 0;
 
@@ -219,6 +238,16 @@ public:
         read(p);
     }
 
+    //
+    // Sequences of fixed-size primitive types are read in bulk rather
+    // than element by element.
+    //
+    void read(::std::vector<Short>& v) { readSeq(v); }
+    void read(::std::vector<Int>& v) { readSeq(v); }
+    void read(::std::vector<Long>& v) { readSeq(v); }
+    void read(::std::vector<Float>& v) { readSeq(v); }
+    void read(::std::vector<Double>& v) { readSeq(v); }
+
     virtual bool readOptional(Int, OptionalFormat) = 0;
 
     template<typename T> inline void read(T& v)
@@ -243,6 +272,18 @@ public:
 
     virtual void closure(void*) = 0;
     virtual void* closure() const = 0;
+
+private:
+
+    template<typename T> void readSeq(::std::vector<T>& v)
+    {
+        ::std::pair<const T*, const T*> p;
+        ::IceUtil::ScopedArray<T> result;
+        read(p, result);
+        ::std::vector<T>(p.first, p.second).swap(v);
+    }
+
+    ::std::deque< ::std::string> _stringViewHolders;
 };
 
 class ICE_API OutputStream : public ::IceUtil::Shared
@@ -343,6 +384,16 @@ public:
     virtual void write(const Float*, const Float*) = 0;
     virtual void write(const Double*, const Double*) = 0;
 
+    //
+    // Sequences of fixed-size primitive types are written in bulk rather
+    // than element by element.
+    //
+    void write(const ::std::vector<Short>& v) { writeSeq(v); }
+    void write(const ::std::vector<Int>& v) { writeSeq(v); }
+    void write(const ::std::vector<Long>& v) { writeSeq(v); }
+    void write(const ::std::vector<Float>& v) { writeSeq(v); }
+    void write(const ::std::vector<Double>& v) { writeSeq(v); }
+
     virtual bool writeOptional(Int, OptionalFormat) = 0;
 
     virtual size_type startSize() = 0;
@@ -375,6 +426,20 @@ public:
             write(*p);
         }
     }
+
+private:
+
+    template<typename T> void writeSeq(const ::std::vector<T>& v)
+    {
+        if(v.empty())
+        {
+            writeSize(0);
+        }
+        else
+        {
+            write(&v[0], &v[0] + v.size());
+        }
+    }
 };
 
 class ICE_API ObjectReader : public Object
@@ -14,6 +14,14 @@
 #include <IceUtil/Iterator.h>
 
 #include <Ice/ObjectF.h>
+#include <Ice/StringView.h>
+
+namespace IceInternal
+{
+
+class BasicStream;
+
+}
 
 namespace Ice
 {
@@ -220,6 +228,14 @@ struct StreamableTraits< ::std::wstring>
     static const bool fixedLength = false;
 };
 
+template<>
+struct StreamableTraits<StringView>
+{
+    static const StreamHelperCategory helper = StreamHelperCategoryBuiltin;
+    static const int minWireSize = 1;
+    static const bool fixedLength = false;
+};
+
 //
 // vector<bool> is a special type in C++: the streams are responsible
 // to handle it like a built-in type.
@@ -275,6 +291,26 @@ struct StreamHelper<T, StreamHelperCategoryBuiltin>
     }
 };
 
+// Helper for string views, the view points into the stream buffer.
+template<>
+struct StreamHelper<StringView, StreamHelperCategoryBuiltin>
+{
+    template<class S> static inline void
+    write(S* stream, const StringView& v)
+    {
+        stream->write(v.data(), v.size());
+    }
+
+    template<class S> static inline void
+    read(S* stream, StringView& v)
+    {
+        const char* vdata;
+        size_t vsize;
+        stream->readStringView(vdata, vsize);
+        v = StringView(vdata, vsize);
+    }
+};
+
 // "helpers" for the StreamHelper<T, StreamHelperCategoryStruct[Class]> below
 // We generate specializations, which can be instantiated explicitly and exported from DLLs
 //
@@ -285,9 +321,45 @@ struct StreamWriter;
 template<typename T, typename S>
 struct StreamReader;
 
-// Helper for structs
+//
+// Structs with the cpp:packed metadata only have fixed-size members laid
+// out without padding, so on little-endian hosts their memory holds their
+// encoding (minWireSize bytes) and they can be marshaled with a copy.
+// slice2cpp specializes StreamPackedTraits for these structs.
+//
 template<typename T>
-struct StreamHelper<T, StreamHelperCategoryStruct>
+struct StreamPackedTraits
+{
+    static const bool packed = false;
+};
+
+//
+// Can the stream S marshal the packed struct or sequence T with a copy?
+// Only BasicStream supports this, the public streaming API marshals the
+// members one by one.
+//
+template<typename T, typename S>
+struct StreamPackedCopy
+{
+    static const bool value = false;
+};
+
+#if defined(ICE_LITTLE_ENDIAN) && !defined(ICE_LITTLEBYTE_BIGWORD)
+template<typename T>
+struct StreamPackedCopy<T, ::IceInternal::BasicStream>
+{
+    static const bool value = StreamPackedTraits<T>::packed;
+};
+
+template<typename T, typename A>
+struct StreamPackedCopy< ::std::vector<T, A>, ::IceInternal::BasicStream>
+{
+    static const bool value = StreamPackedTraits<T>::packed;
+};
+#endif
+
+template<typename T, bool copy>
+struct StreamStructHelper
 {
     template<class S> static inline void
     write(S* stream, const T& v)
@@ -302,6 +374,39 @@ struct StreamHelper<T, StreamHelperCategoryStruct>
     }
 };
 
+template<typename T>
+struct StreamStructHelper<T, true>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        stream->writePacked(&v, 1);
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        stream->readPacked(&v, 1);
+    }
+};
+
+// Helper for structs
+template<typename T>
+struct StreamHelper<T, StreamHelperCategoryStruct>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        StreamStructHelper<T, StreamPackedCopy<T, S>::value>::write(stream, v);
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        StreamStructHelper<T, StreamPackedCopy<T, S>::value>::read(stream, v);
+    }
+};
+
 
 // Helper for class structs
 template<typename T>
@@ -347,9 +452,8 @@ struct StreamHelper<T, StreamHelperCategoryEnum>
     }
 };
 
-// Helper for sequences
-template<typename T>
-struct StreamHelper<T, StreamHelperCategorySequence>
+template<typename T, bool copy>
+struct StreamSequenceHelper
 {
     template<class S> static inline void
     write(S* stream, const T& v)
@@ -373,6 +477,50 @@ struct StreamHelper<T, StreamHelperCategorySequence>
     }
 };
 
+// Vectors of packed structs
+template<typename T>
+struct StreamSequenceHelper<T, true>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        Int sz = static_cast<Int>(v.size());
+        stream->writeSize(sz);
+        if(sz > 0)
+        {
+            stream->writePacked(&v[0], sz);
+        }
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        Int sz = stream->readAndCheckSeqSize(StreamableTraits<typename T::value_type>::minWireSize);
+        T(sz).swap(v);
+        if(sz > 0)
+        {
+            stream->readPacked(&v[0], sz);
+        }
+    }
+};
+
+// Helper for sequences
+template<typename T>
+struct StreamHelper<T, StreamHelperCategorySequence>
+{
+    template<class S> static inline void
+    write(S* stream, const T& v)
+    {
+        StreamSequenceHelper<T, StreamPackedCopy<T, S>::value>::write(stream, v);
+    }
+
+    template<class S> static inline void
+    read(S* stream, T& v)
+    {
+        StreamSequenceHelper<T, StreamPackedCopy<T, S>::value>::read(stream, v);
+    }
+};
+
 // Helper for array and range:array custom sequence parameters
 template<typename T>
 struct StreamHelper<std::pair<const T*, const T*>, StreamHelperCategorySequence>
@@ -0,0 +1,154 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_STRING_VIEW_H
+#define ICE_STRING_VIEW_H
+
+#include <Ice/Config.h>
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+namespace Ice
+{
+
+//
+// A non-owning reference to a string, similar to boost::string_ref
+// and std::experimental::string_view.
+//
+// StringView and StringViewSeq can be used with the "cpp:view-type"
+// metadata for string and string sequence parameters, for example:
+//
+// void lookup(["cpp:view-type:::Ice::StringViewSeq"] Ice::StringSeq keys);
+//
+// In-parameters of dispatched operations and out-parameters of AMI
+// callbacks then point into the request or reply buffer instead of
+// being copied into std::string objects. The views are only valid
+// until the dispatch or the callback returns, servants and callbacks
+// must copy the strings they want to keep. With AMD, this means the
+// views must not be used once the dispatch method returns.
+//
+class StringView
+{
+public:
+
+    typedef const char* const_iterator;
+    typedef size_t size_type;
+
+    StringView() :
+        _data(0),
+        _size(0)
+    {
+    }
+
+    StringView(const std::string& s) :
+        _data(s.data()),
+        _size(s.size())
+    {
+    }
+
+    StringView(const char* s) :
+        _data(s),
+        _size(strlen(s))
+    {
+    }
+
+    StringView(const char* s, size_t sz) :
+        _data(s),
+        _size(sz)
+    {
+    }
+
+    const char* data() const
+    {
+        return _data;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    size_t length() const
+    {
+        return _size;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    const_iterator begin() const
+    {
+        return _data;
+    }
+
+    const_iterator end() const
+    {
+        return _data + _size;
+    }
+
+    char operator[](size_t pos) const
+    {
+        return _data[pos];
+    }
+
+    void clear()
+    {
+        _data = 0;
+        _size = 0;
+    }
+
+    std::string toString() const
+    {
+        return std::string(_data, _size);
+    }
+
+    int compare(const StringView& other) const
+    {
+        size_t sz = _size < other._size ? _size : other._size;
+        int r = sz > 0 ? memcmp(_data, other._data, sz) : 0;
+        if(r == 0 && _size != other._size)
+        {
+            r = _size < other._size ? -1 : 1;
+        }
+        return r;
+    }
+
+private:
+
+    const char* _data;
+    size_t _size;
+};
+
+typedef std::vector<StringView> StringViewSeq;
+
+inline bool
+operator==(const StringView& lhs, const StringView& rhs)
+{
+    return lhs.size() == rhs.size() && (lhs.size() == 0 || memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+inline bool
+operator!=(const StringView& lhs, const StringView& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bool
+operator<(const StringView& lhs, const StringView& rhs)
+{
+    return lhs.compare(rhs) < 0;
+}
+
+}
+
+#endif
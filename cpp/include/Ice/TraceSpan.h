@@ -0,0 +1,135 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_TRACE_SPAN_H
+#define ICE_TRACE_SPAN_H
+
+#include <IceUtil/Time.h>
+#include <Ice/Handle.h>
+#include <Ice/InstanceF.h>
+#include <Ice/Current.h>
+
+namespace IceInternal
+{
+
+class Tracer;
+ICE_API IceUtil::Shared* upCast(Tracer*);
+typedef Handle<Tracer> TracerPtr;
+
+//
+// The span of a traced invocation or dispatch. The timestamps are in
+// microseconds since the epoch, they are 0 if not recorded.
+//
+struct TraceRecord
+{
+    Ice::Long traceId;
+    Ice::Long spanId;
+    Ice::Long parentId;
+    std::string operation;
+    bool dispatch;
+    bool failed;
+
+    Ice::Long start;      // Invocation started or request received.
+    Ice::Long sent;       // Request sent.
+    Ice::Long replied;    // Reply received.
+    Ice::Long dispatched; // Dispatch started.
+    Ice::Long end;        // Invocation completed or response sent.
+};
+
+//
+// Records the span of an invocation or dispatch with the tracer of the
+// communicator, see Ice.Tracing.*. The span does nothing unless it's
+// started, the span is recorded once finished.
+//
+class ICE_API TraceSpan : private IceUtil::noncopyable
+{
+public:
+
+    TraceSpan()
+    {
+    }
+
+    ~TraceSpan()
+    {
+        if(_tracer)
+        {
+            finish();
+        }
+    }
+
+    //
+    // Starts the span of an invocation if the calling thread is
+    // dispatching a traced request or if the invocation is sampled.
+    //
+    void startInvocation(Instance*, const std::string&);
+
+    //
+    // Starts the span of a dispatch if the request context carries a
+    // trace, the trace entry is removed from the context. The span
+    // starts at the given monotonic time the request was received.
+    //
+    void startDispatch(Instance*, const std::string&, Ice::Context&, const IceUtil::Time&);
+
+    bool isStarted() const
+    {
+        return _tracer;
+    }
+
+    void sent()
+    {
+        if(_tracer)
+        {
+            _record.sent = now();
+        }
+    }
+
+    void replied()
+    {
+        if(_tracer)
+        {
+            _record.replied = now();
+        }
+    }
+
+    void failed()
+    {
+        if(_tracer)
+        {
+            _record.failed = true;
+        }
+    }
+
+    void finish();
+
+    void adopt(TraceSpan&);
+
+    //
+    // Adds the trace entry to the context of the request.
+    //
+    void writeContext(Ice::Context&) const;
+
+    const TraceRecord& getRecord() const
+    {
+        return _record;
+    }
+
+private:
+
+    static Ice::Long now()
+    {
+        return IceUtil::Time::now().toMicroSeconds();
+    }
+
+    TracerPtr _tracer;
+    TraceRecord _record;
+};
+
+}
+
+#endif
@@ -60,6 +60,13 @@
 #   define ICE_CPP11
 #endif
 
+//
+// C++20 coroutines, see Ice/Coroutine.h.
+//
+#if defined(ICE_CPP11) && defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#   define ICE_CPP_COROUTINES
+#endif
+
 
 #if defined(ICE_CPP11) && (!defined(_MSC_VER) || (_MSC_VER >= 1900))
 #   define ICE_NOEXCEPT noexcept
@@ -21,7 +21,7 @@ class MutexPtrLock
 {
 public:
     
-    MutexPtrLock<T>(const T* mutex) :
+    MutexPtrLock(const T* mutex) :
         _mutex(mutex),
         _acquired(false)
     {
@@ -32,7 +32,7 @@ public:
         }
     }
 
-    ~MutexPtrLock<T>()
+    ~MutexPtrLock()
     {
         if(_mutex && _acquired)
         {
@@ -71,7 +71,7 @@ private:
     
     // Not implemented; prevents accidental use.
     //
-    MutexPtrLock<T>(const MutexPtrLock<T>&);
+    MutexPtrLock(const MutexPtrLock<T>&);
     MutexPtrLock<T>& operator=(const MutexPtrLock<T>&);
 
     const T* _mutex;
@@ -21,7 +21,7 @@ class MutexPtrTryLock
 {
 public:
     
-    MutexPtrTryLock<T>(const T* mutex) :
+    MutexPtrTryLock(const T* mutex) :
         _mutex(mutex),
         _acquired(false)
     {
@@ -31,7 +31,7 @@ public:
         }
     }
 
-    ~MutexPtrTryLock<T>()
+    ~MutexPtrTryLock()
     {
         if(_mutex && _acquired)
         {
@@ -70,7 +70,7 @@ private:
     
     // Not implemented; prevents accidental use.
     //
-    MutexPtrTryLock<T>(const MutexPtrTryLock&);
+    MutexPtrTryLock(const MutexPtrTryLock&);
     MutexPtrTryLock<T>& operator=(const MutexPtrTryLock<T>&);
 
     const T* _mutex;
@@ -0,0 +1,133 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/AdmissionControl.h>
+#include <math.h>
+
+using namespace std;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(AdmissionControl* p) { return p; }
+
+const char* const IceInternal::overloadedReason = "object adapter overloaded, request not dispatched";
+
+IceInternal::OverloadedException::OverloadedException(const char* file, int line) :
+    Ice::UnknownLocalException(file, line, overloadedReason)
+{
+}
+
+IceInternal::OverloadedException::~OverloadedException() throw()
+{
+}
+
+IceInternal::OverloadedException*
+IceInternal::OverloadedException::ice_clone() const
+{
+    return new OverloadedException(*this);
+}
+
+void
+IceInternal::OverloadedException::ice_throw() const
+{
+    throw *this;
+}
+
+IceInternal::AdmissionControl::AdmissionControl(int maxInFlight, int targetQueueDelay, int queueDelayInterval) :
+    _maxInFlight(maxInFlight > 0 ? maxInFlight : 0),
+    _targetQueueDelay(IceUtil::Time::milliSeconds(targetQueueDelay > 0 ? targetQueueDelay : 0)),
+    _queueDelayInterval(IceUtil::Time::milliSeconds(queueDelayInterval > 0 ? queueDelayInterval : 0)),
+    _inFlight(0),
+    _dropping(0),
+    _dropCount(0)
+{
+}
+
+bool
+IceInternal::AdmissionControl::admit(int count)
+{
+    int inFlight = _inFlight.fetch_add(count);
+
+    //
+    // The requests are always admitted if there are no other requests
+    // in flight, nothing would otherwise stop the rejection.
+    //
+    if(inFlight > 0 && ((_maxInFlight > 0 && inFlight + count > _maxInFlight) || (_dropping.load() > 0 && drop())))
+    {
+        _inFlight.fetch_sub(count);
+        return false;
+    }
+    return true;
+}
+
+void
+IceInternal::AdmissionControl::finished(int count)
+{
+    if(_inFlight.fetch_sub(count) == count && measureQueueDelay())
+    {
+        //
+        // The queue drained, start over.
+        //
+        IceUtil::Mutex::Lock sync(_mutex);
+        _aboveTargetDeadline = IceUtil::Time();
+        _dropping.exchange(0);
+    }
+}
+
+void
+IceInternal::AdmissionControl::dispatched(const IceUtil::Time& delay)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(delay < _targetQueueDelay)
+    {
+        _aboveTargetDeadline = IceUtil::Time();
+        _dropping.exchange(0);
+    }
+    else
+    {
+        IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        if(_aboveTargetDeadline == IceUtil::Time())
+        {
+            _aboveTargetDeadline = now + _queueDelayInterval;
+        }
+        else if(now >= _aboveTargetDeadline && _dropping.load() == 0)
+        {
+            //
+            // The next request is rejected, drop() schedules the
+            // following rejections.
+            //
+            _dropNext = now;
+            _dropCount = 0;
+            _dropping.exchange(1);
+        }
+    }
+}
+
+bool
+IceInternal::AdmissionControl::drop()
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    if(_dropping.load() == 0)
+    {
+        return false; // The queue delay went under the target meanwhile.
+    }
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    if(now < _dropNext)
+    {
+        return false;
+    }
+
+    //
+    // CoDel's control law: the rejections get closer as long as the
+    // queue delay stays above the target.
+    //
+    ++_dropCount;
+    _dropNext = now + _queueDelayInterval / sqrt(static_cast<double>(_dropCount));
+    return true;
+}
@@ -0,0 +1,108 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_ADMISSION_CONTROL_H
+#define ICE_ADMISSION_CONTROL_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Time.h>
+#include <IceUtil/Atomic.h>
+#include <Ice/AdmissionControlF.h>
+#include <Ice/LocalException.h>
+
+namespace IceInternal
+{
+
+//
+// The admission control of an object adapter, configured with the
+// <adapter>.MaxInFlight, <adapter>.TargetQueueDelay and
+// <adapter>.QueueDelayInterval properties.
+//
+// Requests are rejected when the number of requests received by the
+// adapter's connections and not answered yet reaches MaxInFlight, or
+// when the time requests wait between the thread pool reporting their
+// connection ready and their dispatch stayed above TargetQueueDelay
+// for QueueDelayInterval. The latter is the CoDel criteria: a queue
+// with a standing delay that doesn't drain is overloaded. As with
+// CoDel, a request is then rejected and the following ones are
+// rejected at an increasing rate, the n-th rejection occurring
+// QueueDelayInterval/sqrt(n) after the previous one. Rejection stops
+// once a request is dispatched under the target delay or all the
+// requests are answered.
+//
+// A rejected twoway request gets an UnknownLocalException reply with
+// the overloadedReason below as its reason. The Ice protocol has no
+// other way to report it, clients which know the reason turn the reply
+// into an OverloadedException and retry the request since it wasn't
+// dispatched.
+//
+extern const char* const overloadedReason;
+
+//
+// The exception raised for the reply of a request rejected by an
+// overloaded adapter. It's only used by the retry logic and it's
+// reported to the application as an UnknownLocalException.
+//
+class OverloadedException : public Ice::UnknownLocalException
+{
+public:
+
+    OverloadedException(const char*, int);
+    virtual ~OverloadedException() throw();
+
+    virtual OverloadedException* ice_clone() const;
+    virtual void ice_throw() const;
+};
+
+class AdmissionControl : public IceUtil::Shared
+{
+public:
+
+    AdmissionControl(int, int, int);
+
+    //
+    // Called when requests are received. Returns false if they must
+    // be rejected, otherwise they are counted until finished() is
+    // called.
+    //
+    bool admit(int);
+    void finished(int);
+
+    bool measureQueueDelay() const
+    {
+        return _targetQueueDelay != IceUtil::Time();
+    }
+
+    //
+    // Called when an admitted request is dispatched with the time it
+    // waited since it was received.
+    //
+    void dispatched(const IceUtil::Time&);
+
+private:
+
+    bool drop();
+
+    const int _maxInFlight;
+    const IceUtil::Time _targetQueueDelay;
+    const IceUtil::Time _queueDelayInterval;
+
+    IceUtilInternal::Atomic _inFlight;
+    IceUtilInternal::Atomic _dropping;
+
+    IceUtil::Mutex _mutex;
+    IceUtil::Time _aboveTargetDeadline;
+    IceUtil::Time _dropNext;
+    int _dropCount;
+};
+
+}
+
+#endif
@@ -9,6 +9,8 @@
 
 #include <Ice/Application.h>
 #include <Ice/LoggerI.h>
+#include <Ice/Instance.h>
+#include <Ice/FlightRecorderI.h>
 #include <IceUtil/Mutex.h>
 #include <IceUtil/CtrlCHandler.h>
 #include <IceUtil/Cond.h>
@@ -95,6 +97,35 @@ const DWORD SIGHUP = CTRL_LOGOFF_EVENT;
 #   undef signal
 #endif
 
+//
+// Saves the events of the flight recorder, if Ice.FlightRecorder.File
+// is set, before the communicator is shutdown or destroyed in response
+// to a signal.
+//
+static void
+saveFlightRecorder(int signal)
+{
+    if(!IceInternal::Application::_communicator)
+    {
+        return;
+    }
+
+    try
+    {
+        IceInternal::InstancePtr instance = IceInternal::getInstance(IceInternal::Application::_communicator);
+        string file = instance->initializationData().properties->getProperty("Ice.FlightRecorder.File");
+        if(instance->flightRecorder() && !file.empty())
+        {
+            instance->flightRecorder()->save(file);
+        }
+    }
+    catch(const std::exception& ex)
+    {
+        Error out(getProcessLogger());
+        out << "(while saving the flight recorder in response to signal " << signal << "): " << ex;
+    }
+}
+
 //
 // CtrlCHandler callbacks.
 //
@@ -150,6 +181,8 @@ destroyOnInterruptCallback(int signal)
         IceInternal::Application::_destroyed = true;
     }
 
+    saveFlightRecorder(signal);
+
     try
     {
         assert(IceInternal::Application::_communicator != 0);
@@ -205,6 +238,8 @@ shutdownOnInterruptCallback(int signal)
         IceInternal::Application::_interrupted = true;
     }
 
+    saveFlightRecorder(signal);
+
     try
     {
         assert(IceInternal::Application::_communicator != 0);
@@ -257,6 +292,8 @@ callbackOnInterruptCallback(int signal)
         IceInternal::Application::_interrupted = true;
     }
 
+    saveFlightRecorder(signal);
+
     try
     {
         assert(IceInternal::Application::_application != 0);
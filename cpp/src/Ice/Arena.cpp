@@ -0,0 +1,266 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Arena.h>
+#include <IceUtil/Atomic.h>
+
+#include <cstdlib>
+#include <new>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace IceInternal;
+
+#if defined(_WIN32)
+extern "C" void WINAPI iceArenaThreadDestructor(void*);
+#else
+extern "C" void iceArenaThreadDestructor(void*);
+#endif
+
+namespace
+{
+
+//
+// Each allocation is preceded by a header that points to its chunk,
+// or is null for allocations from the heap. The header keeps the
+// allocations aligned on 16 bytes.
+//
+const size_t HeaderSize = 16;
+
+//
+// Allocations larger than MaxArenaAllocation are always done from the
+// heap.
+//
+const size_t ChunkSize = 64 * 1024;
+const size_t MaxArenaAllocation = 1024;
+
+struct Chunk
+{
+    Chunk() : count(0)
+    {
+    }
+
+    //
+    // The number of allocations from the chunk is only known to the
+    // owner thread: frees decrement the count and the owner adds the
+    // number of allocations when it releases the chunk. The chunk is
+    // free once the count drops back to 0 after it was released.
+    //
+    IceUtilInternal::Atomic count;
+};
+
+const size_t ChunkHeaderSize = (sizeof(Chunk) + HeaderSize - 1) & ~(HeaderSize - 1);
+
+struct ThreadArena
+{
+    ThreadArena() : chunk(0), next(0), end(0), allocated(0)
+    {
+    }
+
+    Chunk* chunk;
+    char* next;
+    char* end;
+    int allocated;
+};
+
+IceUtilInternal::Atomic chunkCount(0);
+
+void
+destroyChunk(Chunk* chunk)
+{
+    chunk->~Chunk();
+    free(chunk);
+    chunkCount.fetch_sub(1);
+}
+
+//
+// Release the chunk owned by the arena. Returns true if all the
+// allocations from the chunk were already freed, in which case the
+// caller can reuse or destroy the chunk.
+//
+bool
+releaseChunk(ThreadArena* arena)
+{
+    return arena->chunk->count.fetch_add(arena->allocated) + arena->allocated == 0;
+}
+
+#if defined(ICE_OS_WINRT)
+
+ThreadArena*
+currentArena()
+{
+    return 0;
+}
+
+#else
+
+bool keyInitialized = false;
+#   if defined(_WIN32)
+DWORD key;
+#   else
+pthread_key_t key;
+#   endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+#   if defined(_WIN32)
+        key = FlsAlloc(&iceArenaThreadDestructor);
+        keyInitialized = key != FLS_OUT_OF_INDEXES;
+#   else
+        keyInitialized = pthread_key_create(&key, &iceArenaThreadDestructor) == 0;
+#   endif
+    }
+
+    ~Init()
+    {
+        //
+        // Instances allocated from an arena can outlive this object,
+        // they don't need the key to be freed. Later allocations are
+        // done from the heap.
+        //
+        if(keyInitialized)
+        {
+            keyInitialized = false;
+#   if defined(_WIN32)
+            FlsFree(key);
+#   else
+            pthread_key_delete(key);
+#   endif
+        }
+    }
+};
+
+Init init;
+
+ThreadArena*
+currentArena()
+{
+    if(!keyInitialized)
+    {
+        return 0;
+    }
+
+#   if defined(_WIN32)
+    ThreadArena* arena = static_cast<ThreadArena*>(FlsGetValue(key));
+#   else
+    ThreadArena* arena = static_cast<ThreadArena*>(pthread_getspecific(key));
+#   endif
+    if(!arena)
+    {
+        arena = new ThreadArena;
+#   if defined(_WIN32)
+        FlsSetValue(key, arena);
+#   else
+        pthread_setspecific(key, arena);
+#   endif
+    }
+    return arena;
+}
+
+#endif
+
+}
+
+extern "C" void
+#if defined(_WIN32)
+WINAPI
+#endif
+iceArenaThreadDestructor(void* p)
+{
+    ThreadArena* arena = static_cast<ThreadArena*>(p);
+    if(arena)
+    {
+        if(arena->chunk && releaseChunk(arena))
+        {
+            destroyChunk(arena->chunk);
+        }
+        delete arena;
+    }
+}
+
+void*
+IceInternal::arenaAllocate(size_t size)
+{
+    ThreadArena* arena = size <= MaxArenaAllocation ? currentArena() : 0;
+    if(!arena)
+    {
+        char* p = static_cast<char*>(malloc(HeaderSize + size));
+        if(!p)
+        {
+            throw bad_alloc();
+        }
+        *reinterpret_cast<Chunk**>(p) = 0;
+        return p + HeaderSize;
+    }
+
+    size_t sz = (HeaderSize + size + HeaderSize - 1) & ~(HeaderSize - 1);
+    if(static_cast<size_t>(arena->end - arena->next) < sz)
+    {
+        //
+        // The chunk is full. If all its allocations were already
+        // freed, it is reused right away, otherwise it is released
+        // and freed by the last deallocation.
+        //
+        if(!arena->chunk || !releaseChunk(arena))
+        {
+            void* mem = malloc(ChunkSize);
+            if(!mem)
+            {
+                arena->chunk = 0;
+                arena->next = arena->end = 0;
+                arena->allocated = 0;
+                throw bad_alloc();
+            }
+            arena->chunk = new(mem) Chunk;
+            chunkCount.fetch_add(1);
+        }
+        arena->next = reinterpret_cast<char*>(arena->chunk) + ChunkHeaderSize;
+        arena->end = reinterpret_cast<char*>(arena->chunk) + ChunkSize;
+        arena->allocated = 0;
+    }
+
+    char* p = arena->next;
+    arena->next += sz;
+    ++arena->allocated;
+    *reinterpret_cast<Chunk**>(p) = arena->chunk;
+    return p + HeaderSize;
+}
+
+void
+IceInternal::arenaFree(void* p)
+{
+    if(!p)
+    {
+        return;
+    }
+
+    char* q = static_cast<char*>(p) - HeaderSize;
+    Chunk* chunk = *reinterpret_cast<Chunk**>(q);
+    if(!chunk)
+    {
+        free(q);
+    }
+    else if(chunk->count.fetch_sub(1) == 1)
+    {
+        destroyChunk(chunk);
+    }
+}
+
+int
+IceInternal::arenaChunkCount()
+{
+    return chunkCount.load();
+}
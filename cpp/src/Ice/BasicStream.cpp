@@ -31,6 +31,15 @@ using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+//
+// On these little-endian platforms, unaligned memory accesses are supported
+// and sequences of fixed-size primitive types are unmarshaled without a copy.
+//
+#if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64) || \
+    defined(__aarch64__) || defined(_M_ARM64)
+#   define ICE_UNALIGNED
+#endif
+
 namespace
 {
 
@@ -98,7 +107,8 @@ IceInternal::BasicStream::BasicStream(Instance* instance, const EncodingVersion&
     _stringConverter(instance->getStringConverter()),
     _wstringConverter(instance->getWstringConverter()),
     _startSeq(-1),
-    _minSeqSize(0)
+    _minSeqSize(0),
+    _stringViewHolders(0)
 {
     //
     // Initialize the encoding members of our pre-allocated encapsulations, in case
@@ -120,7 +130,8 @@ IceInternal::BasicStream::BasicStream(Instance* instance, const EncodingVersion&
     _stringConverter(instance->getStringConverter()),
     _wstringConverter(instance->getWstringConverter()),
     _startSeq(-1),
-    _minSeqSize(0)
+    _minSeqSize(0),
+    _stringViewHolders(0)
 {
     //
     // Initialize the encoding members of our pre-allocated encapsulations, in case
@@ -147,6 +158,9 @@ IceInternal::BasicStream::clear()
         delete oldEncaps;
     }
 
+    delete _stringViewHolders;
+    _stringViewHolders = 0;
+
     _startSeq = -1;
     _sliceObjects = true;
 }
@@ -184,6 +198,7 @@ IceInternal::BasicStream::swap(BasicStream& other)
 
     std::swap(_startSeq, other._startSeq);
     std::swap(_minSeqSize, other._minSeqSize);
+    std::swap(_stringViewHolders, other._stringViewHolders);
 }
 
 void
@@ -441,6 +456,122 @@ IceInternal::BasicStream::read(pair<const Byte*, const Byte*>& v)
     }
 }
 
+namespace
+{
+
+//
+// Bulk copy of sequences of fixed-size primitive types between the
+// marshaling buffer and memory. The Ice encoding is little-endian, so
+// on little-endian hosts this is a plain memcpy. On big-endian hosts,
+// each element is loaded as an unsigned word, byte swapped with shifts
+// and masks and stored back; compilers turn such loops into byte swap
+// instructions and vectorize them. The helper is its own inverse, so
+// it is used for both marshaling and unmarshaling.
+//
+#ifdef ICE_BIG_ENDIAN
+inline unsigned short
+byteSwap(unsigned short v)
+{
+    return static_cast<unsigned short>((v << 8) | (v >> 8));
+}
+
+inline unsigned int
+byteSwap(unsigned int v)
+{
+    return (v << 24) | ((v << 8) & 0x00ff0000U) | ((v >> 8) & 0x0000ff00U) | (v >> 24);
+}
+
+template<size_t size>
+struct BasicStreamSeqHelper
+{
+};
+
+template<>
+struct BasicStreamSeqHelper<2>
+{
+    static void copy(Byte* dest, const Byte* src, Int sz)
+    {
+        for(Int j = 0; j < sz; ++j)
+        {
+            unsigned short v;
+            memcpy(&v, src + j * 2, 2);
+            v = byteSwap(v);
+            memcpy(dest + j * 2, &v, 2);
+        }
+    }
+};
+
+template<>
+struct BasicStreamSeqHelper<4>
+{
+    static void copy(Byte* dest, const Byte* src, Int sz)
+    {
+        for(Int j = 0; j < sz; ++j)
+        {
+            unsigned int v;
+            memcpy(&v, src + j * 4, 4);
+            v = byteSwap(v);
+            memcpy(dest + j * 4, &v, 4);
+        }
+    }
+};
+
+template<>
+struct BasicStreamSeqHelper<8>
+{
+    static void copy(Byte* dest, const Byte* src, Int sz)
+    {
+        for(Int j = 0; j < sz; ++j)
+        {
+            unsigned int v[2];
+            memcpy(v, src + j * 8, 8);
+            unsigned int w[2] = { byteSwap(v[1]), byteSwap(v[0]) };
+            memcpy(dest + j * 8, w, 8);
+        }
+    }
+};
+#endif
+
+template<typename T> inline void
+copySeq(Byte* dest, const T* src, Int sz)
+{
+#ifdef ICE_BIG_ENDIAN
+    BasicStreamSeqHelper<sizeof(T)>::copy(dest, reinterpret_cast<const Byte*>(src), sz);
+#else
+    memcpy(dest, src, sz * sizeof(T));
+#endif
+}
+
+template<typename T> inline void
+copySeq(T* dest, const Byte* src, Int sz)
+{
+#ifdef ICE_BIG_ENDIAN
+    BasicStreamSeqHelper<sizeof(T)>::copy(reinterpret_cast<Byte*>(dest), src, sz);
+#else
+    memcpy(dest, src, sz * sizeof(T));
+#endif
+}
+
+#if defined(ICE_LITTLEBYTE_BIGWORD)
+//
+// Doubles are stored with their two 32-bit words swapped on these
+// platforms.
+//
+inline void
+copyDoubleSeq(Byte* dest, const Byte* src, Int sz)
+{
+    for(Int j = 0; j < sz; ++j)
+    {
+        memcpy(dest + 4, src, 4);
+        memcpy(dest, src + 4, 4);
+        src += sizeof(Double);
+        dest += sizeof(Double);
+    }
+}
+#endif
+
+}
+
 void
 IceInternal::BasicStream::write(const vector<bool>& v)
 {
@@ -583,18 +714,7 @@ IceInternal::BasicStream::write(const Short* begin, const Short* end)
     {
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Short));
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Short) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Short);
-        }
-#else
-        memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Short));
-#endif
+        copySeq(&b[pos], begin, sz);
     }
 }
 
@@ -627,18 +747,7 @@ IceInternal::BasicStream::read(vector<Short>& v)
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Short));
         v.resize(sz);
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Short) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Short);
-        }
-#else
-        copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
-#endif
+        copySeq(&v[0], begin, sz);
     }
     else
     {
@@ -652,7 +761,7 @@ IceInternal::BasicStream::read(pair<const Short*, const Short*>& v, IceUtil::Sco
     Int sz = readAndCheckSeqSize(static_cast<int>(sizeof(Short)));
     if(sz > 0)
     {
-#if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
+#ifdef ICE_UNALIGNED
         v.first = reinterpret_cast<Short*>(i);
         i += sz * static_cast<int>(sizeof(Short));
         v.second = reinterpret_cast<Short*>(i);
@@ -663,18 +772,7 @@ IceInternal::BasicStream::read(pair<const Short*, const Short*>& v, IceUtil::Sco
 
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Short));
-#  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Short) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Short);
-        }
-#  else
-        copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
-#  endif
+        copySeq(result.get(), begin, sz);
 #endif
     }
     else
@@ -693,20 +791,7 @@ IceInternal::BasicStream::write(const Int* begin, const Int* end)
     {
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Int));
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Int) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Int);
-        }
-#else
-        memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Int));
-#endif
+        copySeq(&b[pos], begin, sz);
     }
 }
 
@@ -719,20 +804,7 @@ IceInternal::BasicStream::read(vector<Int>& v)
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Int));
         v.resize(sz);
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Int) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Int);
-        }
-#else
-        copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
-#endif
+        copySeq(&v[0], begin, sz);
     }
     else
     {
@@ -746,7 +818,7 @@ IceInternal::BasicStream::read(pair<const Int*, const Int*>& v, ::IceUtil::Scope
     Int sz = readAndCheckSeqSize(static_cast<int>(sizeof(Int)));
     if(sz > 0)
     {
-#if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
+#ifdef ICE_UNALIGNED
         v.first = reinterpret_cast<Int*>(i);
         i += sz * static_cast<int>(sizeof(Int));
         v.second = reinterpret_cast<Int*>(i);
@@ -757,20 +829,7 @@ IceInternal::BasicStream::read(pair<const Int*, const Int*>& v, ::IceUtil::Scope
 
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Int));
-#  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Int) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Int);
-        }
-#  else
-        copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
-#  endif
+        copySeq(result.get(), begin, sz);
 #endif
     }
     else
@@ -818,24 +877,7 @@ IceInternal::BasicStream::write(const Long* begin, const Long* end)
     {
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Long));
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Long) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Long);
-        }
-#else
-        memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Long));
-#endif
+        copySeq(&b[pos], begin, sz);
     }
 }
 
@@ -880,24 +922,7 @@ IceInternal::BasicStream::read(vector<Long>& v)
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Long));
         v.resize(sz);
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Long) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Long);
-        }
-#else
-        copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
-#endif
+        copySeq(&v[0], begin, sz);
     }
     else
     {
@@ -911,7 +936,7 @@ IceInternal::BasicStream::read(pair<const Long*, const Long*>& v, IceUtil::Scope
     Int sz = readAndCheckSeqSize(static_cast<int>(sizeof(Long)));
     if(sz > 0)
     {
-#if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
+#ifdef ICE_UNALIGNED
         v.first = reinterpret_cast<Long*>(i);
         i += sz * static_cast<int>(sizeof(Long));
         v.second = reinterpret_cast<Long*>(i);
@@ -922,24 +947,7 @@ IceInternal::BasicStream::read(pair<const Long*, const Long*>& v, IceUtil::Scope
 
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Long));
-#  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Long) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Long);
-        }
-#  else
-        copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
-#  endif
+        copySeq(result.get(), begin, sz);
 #endif
     }
     else
@@ -979,20 +987,7 @@ IceInternal::BasicStream::write(const Float* begin, const Float* end)
     {
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Float));
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Float) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Float);
-        }
-#else
-        memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Float));
-#endif
+        copySeq(&b[pos], begin, sz);
     }
 }
 
@@ -1029,20 +1024,7 @@ IceInternal::BasicStream::read(vector<Float>& v)
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Float));
         v.resize(sz);
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Float) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Float);
-        }
-#else
-        copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
-#endif
+        copySeq(&v[0], begin, sz);
     }
     else
     {
@@ -1056,7 +1038,7 @@ IceInternal::BasicStream::read(pair<const Float*, const Float*>& v, IceUtil::Sco
     Int sz = readAndCheckSeqSize(static_cast<int>(sizeof(Float)));
     if(sz > 0)
     {
-#if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
+#ifdef ICE_UNALIGNED
         v.first = reinterpret_cast<Float*>(i);
         i += sz * static_cast<int>(sizeof(Float));
         v.second = reinterpret_cast<Float*>(i);
@@ -1067,20 +1049,7 @@ IceInternal::BasicStream::read(pair<const Float*, const Float*>& v, IceUtil::Sco
 
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Float));
-#  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Float) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Float);
-        }
-#  else
-        copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
-#  endif
+        copySeq(result.get(), begin, sz);
 #endif
     }
     else
@@ -1139,38 +1108,10 @@ IceInternal::BasicStream::write(const Double* begin, const Double* end)
     {
         Container::size_type pos = b.size();
         resize(pos + sz * sizeof(Double));
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = reinterpret_cast<const Byte*>(begin) + sizeof(Double) - 1;
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            *dest++ = *src--;
-            src += 2 * sizeof(Double);
-        }
-#elif defined(ICE_LITTLEBYTE_BIGWORD)
-        const Byte* src = reinterpret_cast<const Byte*>(begin);
-        Byte* dest = &(*(b.begin() + pos));
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            dest[4] = *src++;
-            dest[5] = *src++;
-            dest[6] = *src++;
-            dest[7] = *src++;
-            dest[0] = *src++;
-            dest[1] = *src++;
-            dest[2] = *src++;
-            dest[3] = *src++;
-            dest += sizeof(Double);
-        }
+#if defined(ICE_LITTLEBYTE_BIGWORD)
+        copyDoubleSeq(&b[pos], reinterpret_cast<const Byte*>(begin), sz);
 #else
-        memcpy(&b[pos], reinterpret_cast<const Byte*>(begin), sz * sizeof(Double));
+        copySeq(&b[pos], begin, sz);
 #endif
     }
 }
@@ -1227,38 +1168,10 @@ IceInternal::BasicStream::read(vector<Double>& v)
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Double));
         v.resize(sz);
-#ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]) + sizeof(Double) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Double);
-        }
-#elif defined(ICE_LITTLEBYTE_BIGWORD)
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&v[0]);
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            dest[4] = *src++;
-            dest[5] = *src++;
-            dest[6] = *src++;
-            dest[7] = *src++;
-            dest[0] = *src++;
-            dest[1] = *src++;
-            dest[2] = *src++;
-            dest[3] = *src++;
-            dest += sizeof(Double);
-        }
+#if defined(ICE_LITTLEBYTE_BIGWORD)
+        copyDoubleSeq(reinterpret_cast<Byte*>(&v[0]), begin, sz);
 #else
-        copy(begin, i, reinterpret_cast<Byte*>(&v[0]));
+        copySeq(&v[0], begin, sz);
 #endif
     }
     else
@@ -1273,7 +1186,7 @@ IceInternal::BasicStream::read(pair<const Double*, const Double*>& v, IceUtil::S
     Int sz = readAndCheckSeqSize(static_cast<int>(sizeof(Double)));
     if(sz > 0)
     {
-#if defined(__i386) || defined(_M_IX86) || defined(__x86_64) || defined(_M_X64)
+#ifdef ICE_UNALIGNED
         v.first = reinterpret_cast<Double*>(i);
         i += sz * static_cast<int>(sizeof(Double));
         v.second = reinterpret_cast<Double*>(i);
@@ -1284,39 +1197,10 @@ IceInternal::BasicStream::read(pair<const Double*, const Double*>& v, IceUtil::S
 
         Container::iterator begin = i;
         i += sz * static_cast<int>(sizeof(Double));
-#  ifdef ICE_BIG_ENDIAN
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]) + sizeof(Double) - 1;
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            *dest-- = *src++;
-            dest += 2 * sizeof(Double);
-        }
-#  elif defined(ICE_LITTLEBYTE_BIGWORD)
-        const Byte* src = &(*begin);
-        Byte* dest = reinterpret_cast<Byte*>(&result[0]);
-        for(int j = 0 ; j < sz ; ++j)
-        {
-            dest[4] = *src++;
-            dest[5] = *src++;
-            dest[6] = *src++;
-            dest[7] = *src++;
-            dest[0] = *src++;
-            dest[1] = *src++;
-            dest[2] = *src++;
-            dest[3] = *src++;
-            dest += sizeof(Double);
-        }
-
+#  if defined(ICE_LITTLEBYTE_BIGWORD)
+        copyDoubleSeq(reinterpret_cast<Byte*>(result.get()), begin, sz);
 #  else
-        copy(begin, i, reinterpret_cast<Byte*>(&result[0]));
+        copySeq(result.get(), begin, sz);
 #  endif
 #endif
     }
@@ -1432,6 +1316,39 @@ IceInternal::BasicStream::readConverted(string& v, int sz)
     }
 }
 
+void
+IceInternal::BasicStream::readConvertedView(const char*& vdata, size_t& vsize)
+{
+    Int sz = readSize();
+    if(sz > 0)
+    {
+        if(b.end() - i < sz)
+        {
+            throwUnmarshalOutOfBoundsException(__FILE__, __LINE__);
+        }
+
+        //
+        // The elements of a deque aren't moved when it grows, so the
+        // views returned previously remain valid.
+        //
+        if(!_stringViewHolders)
+        {
+            _stringViewHolders = new deque<string>;
+        }
+        _stringViewHolders->push_back(string());
+        string& holder = _stringViewHolders->back();
+        readConverted(holder, sz);
+        i += sz;
+        vdata = holder.data();
+        vsize = holder.size();
+    }
+    else
+    {
+        vdata = 0;
+        vsize = 0;
+    }
+}
+
 void
 IceInternal::BasicStream::read(vector<string>& v, bool convert)
 {
@@ -1888,18 +1805,17 @@ IceInternal::BasicStream::EncapsDecoder::readTypeId(bool isIndex)
     if(isIndex)
     {
         Int index = _stream->readSize();
-        TypeIdReadMap::const_iterator k = _typeIdMap.find(index);
-        if(k == _typeIdMap.end())
+        if(index < 1 || static_cast<size_t>(index) > _typeIds.size())
         {
             throw UnmarshalOutOfBoundsException(__FILE__, __LINE__);
         }
-        return k->second;
+        return _typeIds[index - 1];
     }
     else
     {
         string typeId;
         _stream->read(typeId, false);
-        _typeIdMap.insert(make_pair(++_typeIdIndex, typeId));
+        _typeIds.push_back(typeId);
         return typeId;
     }
 }
@@ -1957,10 +1873,10 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     // Check if already un-marshalled the object. If that's the case,
     // just patch the object smart pointer and we're done.
     //
-    IndexToPtrMap::iterator p = _unmarshaledMap.find(index);
-    if(p != _unmarshaledMap.end())
+    ObjectPtr* p = _unmarshaledMap.find(index);
+    if(p)
     {
-        (*patchFunc)(patchAddr, p->second);
+        (*patchFunc)(patchAddr, *p);
         return;
     }
 
@@ -1970,15 +1886,7 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     // un-marshalled.
     //
 
-    PatchMap::iterator q = _patchMap.find(index);
-    if(q == _patchMap.end())
-    {
-        //
-        // We have no outstanding instances to be patched for this
-        // index, so make a new entry in the patch map.
-        //
-        q = _patchMap.insert(make_pair(index, PatchList())).first;
-    }
+    PatchList& patchList = _patchMap.insert(index, _stream->b.size());
 
     //
     // Append a patch entry for this instance.
@@ -1986,7 +1894,7 @@ IceInternal::BasicStream::EncapsDecoder::addPatchEntry(Int index, PatchFunc patc
     PatchEntry e;
     e.patchFunc = patchFunc;
     e.patchAddr = patchAddr;
-    q->second.push_back(e);
+    patchList.push_back(e);
 }
 
 void
@@ -1996,7 +1904,11 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
     // Add the object to the map of un-marshalled objects, this must
     // be done before reading the objects (for circular references).
     //
-    _unmarshaledMap.insert(make_pair(index, v));
+    ObjectPtr& unmarshaled = _unmarshaledMap.insert(index, _stream->b.size());
+    if(!unmarshaled)
+    {
+        unmarshaled = v;
+    }
 
     //
     // Read the object.
@@ -2006,15 +1918,15 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
     //
     // Patch all instances now that the object is un-marshalled.
     //
-    PatchMap::iterator patchPos = _patchMap.find(index);
-    if(patchPos != _patchMap.end())
+    PatchList* patchList = _patchMap.find(index);
+    if(patchList)
     {
-        assert(patchPos->second.size() > 0);
+        assert(patchList->size() > 0);
 
         //
         // Patch all pointers that refer to the instance.
         //
-        for(PatchList::iterator k = patchPos->second.begin(); k != patchPos->second.end(); ++k)
+        for(PatchList::iterator k = patchList->begin(); k != patchList->end(); ++k)
         {
             (*k->patchFunc)(k->patchAddr, v);
         }
@@ -2023,7 +1935,7 @@ IceInternal::BasicStream::EncapsDecoder::unmarshal(Int index, const Ice::ObjectP
         // Clear out the patch map for that index -- there is nothing left
         // to patch for that index for the time being.
         //
-        _patchMap.erase(patchPos);
+        _patchMap.erase(index);
     }
 
     if(_objectList.empty() && _patchMap.empty())
@@ -2919,14 +2831,14 @@ IceInternal::BasicStream::EncapsDecoder11::readSlicedData()
 Int
 IceInternal::BasicStream::EncapsEncoder::registerTypeId(const string& typeId)
 {
-    TypeIdWriteMap::const_iterator p = _typeIdMap.find(typeId);
-    if(p != _typeIdMap.end())
+    const Int* p = _typeIdMap.find(typeId);
+    if(p)
     {
-        return p->second;
+        return *p;
     }
     else
     {
-        _typeIdMap.insert(make_pair(typeId, ++_typeIdIndex));
+        _typeIdMap.insert(typeId, ++_typeIdIndex);
         return -1;
     }
 }
@@ -3042,12 +2954,15 @@ IceInternal::BasicStream::EncapsEncoder10::writePendingObjects()
         // marshalled objects" into _toBeMarshaledMap while writing
         // objects.
         //
-        _marshaledMap.insert(_toBeMarshaledMap.begin(), _toBeMarshaledMap.end());
+        for(PtrToIndexMap::const_iterator p = _toBeMarshaledMap.begin(); p != _toBeMarshaledMap.end(); ++p)
+        {
+            _marshaledMap.insert(p->first, p->second);
+        }
 
         PtrToIndexMap savedMap;
         savedMap.swap(_toBeMarshaledMap);
         _stream->writeSize(static_cast<Int>(savedMap.size()));
-        for(PtrToIndexMap::iterator p = savedMap.begin(); p != savedMap.end(); ++p)
+        for(PtrToIndexMap::const_iterator p = savedMap.begin(); p != savedMap.end(); ++p)
         {
             //
             // Ask the instance to marshal itself. Any new class
@@ -3085,26 +3000,26 @@ IceInternal::BasicStream::EncapsEncoder10::registerObject(const ObjectPtr& v)
     //
     // Look for this instance in the to-be-marshaled map.
     //
-    PtrToIndexMap::const_iterator p = _toBeMarshaledMap.find(v);
-    if(p != _toBeMarshaledMap.end())
+    const Int* p = _toBeMarshaledMap.find(v);
+    if(p)
     {
-        return p->second;
+        return *p;
     }
 
     //
     // Didn't find it, try the marshaled map next.
     //
-    PtrToIndexMap::const_iterator q = _marshaledMap.find(v);
-    if(q != _marshaledMap.end())
+    const Int* q = _marshaledMap.find(v);
+    if(q)
     {
-        return q->second;
+        return *q;
     }
 
     //
     // We haven't seen this instance previously, create a new
     // index, and insert it into the to-be-marshaled map.
     //
-    _toBeMarshaledMap.insert(make_pair(v, ++_objectIdIndex));
+    _toBeMarshaledMap.insert(v, ++_objectIdIndex);
     return _objectIdIndex;
 }
 
@@ -3124,17 +3039,17 @@ IceInternal::BasicStream::EncapsEncoder11::write(const ObjectPtr& v)
         // each slice and is always read (even if the Slice is
         // unknown).
         //
-        PtrToIndexMap::const_iterator p = _current->indirectionMap.find(v);
-        if(p == _current->indirectionMap.end())
+        const Int* p = _current->indirectionMap.find(v);
+        if(!p)
         {
             _current->indirectionTable.push_back(v);
             Int idx = static_cast<Int>(_current->indirectionTable.size()); // Position + 1 (0 is reserved for nil)
-            _current->indirectionMap.insert(make_pair(v, idx));
+            _current->indirectionMap.insert(v, idx);
             _stream->writeSize(idx);
         }
         else
         {
-            _stream->writeSize(p->second);
+            _stream->writeSize(*p);
         }
     }
     else
@@ -3361,10 +3276,10 @@ IceInternal::BasicStream::EncapsEncoder11::writeInstance(const ObjectPtr& v)
     //
     // If the instance was already marshaled, just write it's ID.
     //
-    PtrToIndexMap::const_iterator q = _marshaledMap.find(v);
-    if(q != _marshaledMap.end())
+    const Int* q = _marshaledMap.find(v);
+    if(q)
     {
-        _stream->writeSize(q->second);
+        _stream->writeSize(*q);
         return;
     }
 
@@ -3372,7 +3287,7 @@ IceInternal::BasicStream::EncapsEncoder11::writeInstance(const ObjectPtr& v)
     // We haven't seen this instance previously, create a new ID,
     // insert it into the marshaled map, and write the instance.
     //
-    _marshaledMap.insert(make_pair(v, ++_objectIdIndex));
+    _marshaledMap.insert(v, ++_objectIdIndex);
 
     try
     {
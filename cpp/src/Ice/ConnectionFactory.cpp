@@ -342,6 +342,52 @@ IceInternal::OutgoingConnectionFactory::applyOverrides(const vector<EndpointIPtr
     return endpoints;
 }
 
+vector<IceUtil::Int64>
+IceInternal::OutgoingConnectionFactory::getRoundTripTimes(const vector<EndpointIPtr>& endpts)
+{
+    vector<EndpointIPtr> endpoints = applyOverrides(endpts);
+    vector<ConnectionIPtr> connections;
+    vector<size_t> indexes;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+        if(_destroyed)
+        {
+            throw CommunicatorDestroyedException(__FILE__, __LINE__);
+        }
+
+        for(size_t i = 0; i < endpoints.size(); ++i)
+        {
+            pair<multimap<EndpointIPtr, ConnectionIPtr>::const_iterator,
+                 multimap<EndpointIPtr, ConnectionIPtr>::const_iterator> pr =
+                _connectionsByEndpoint.equal_range(endpoints[i]);
+            for(multimap<EndpointIPtr, ConnectionIPtr>::const_iterator p = pr.first; p != pr.second; ++p)
+            {
+                connections.push_back(p->second);
+                indexes.push_back(i);
+            }
+        }
+    }
+
+    //
+    // The connections are called without the factory mutex locked.
+    // The fastest connection to an endpoint gives its round-trip time.
+    //
+    vector<IceUtil::Int64> roundTripTimes(endpoints.size(), -1);
+    for(size_t i = 0; i < connections.size(); ++i)
+    {
+        if(connections[i]->isActiveOrHolding())
+        {
+            IceUtil::Int64 rtt = connections[i]->roundTripTime();
+            IceUtil::Int64& value = roundTripTimes[indexes[i]];
+            if(rtt >= 0 && (value < 0 || rtt < value))
+            {
+                value = rtt;
+            }
+        }
+    }
+    return roundTripTimes;
+}
+
 ConnectionIPtr
 IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress)
 {
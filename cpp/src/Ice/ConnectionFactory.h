@@ -68,6 +68,13 @@ public:
     void removeAdapter(const Ice::ObjectAdapterPtr&);
     void flushAsyncBatchRequests(const CommunicatorFlushBatchAsyncPtr&);
 
+    //
+    // Returns the round-trip times of the connections to the given
+    // endpoints in microseconds, -1 for the endpoints without a
+    // connection or measurements.
+    //
+    std::vector<IceUtil::Int64> getRoundTripTimes(const std::vector<EndpointIPtr>&);
+
 private:
 
     OutgoingConnectionFactory(const Ice::CommunicatorPtr&, const InstancePtr&);
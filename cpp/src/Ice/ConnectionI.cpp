@@ -28,6 +28,9 @@
 #include <Ice/ReferenceFactory.h> // For createProxy().
 #include <Ice/ProxyFactory.h> // For createProxy().
 #include <Ice/BatchRequestQueue.h>
+#include <Ice/AdmissionControl.h>
+#include <Ice/ReplyStatus.h>
+#include <Ice/FlightRecorderI.h>
 
 #ifdef ICE_HAS_BZIP2
 #  include <bzlib.h>
@@ -73,6 +76,7 @@ public:
                  const vector<ConnectionI::OutgoingMessage>& sentCBs, Byte compress, Int requestId,
                  Int invokeNum, const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
                  const OutgoingAsyncBasePtr& outAsync, const ConnectionCallbackPtr& heartbeatCallback,
+                 const AdmissionControlPtr& admissionControl, const IceUtil::Time& ready, const IceUtil::Time& received,
                  BasicStream& stream) :
         DispatchWorkItem(connection),
         _connection(connection),
@@ -85,6 +89,9 @@ public:
         _adapter(adapter),
         _outAsync(outAsync),
         _heartbeatCallback(heartbeatCallback),
+        _admissionControl(admissionControl),
+        _ready(ready),
+        _requestReceived(received),
         _stream(stream.instance(), currentProtocolEncoding)
     {
         _stream.swap(stream);
@@ -93,8 +100,12 @@ public:
     virtual void
     run()
     {
+        if(_admissionControl)
+        {
+            _admissionControl->dispatched(IceUtil::Time::now(IceUtil::Time::Monotonic) - _ready);
+        }
         _connection->dispatch(_startCB, _sentCBs, _compress, _requestId, _invokeNum, _servantManager, _adapter,
-                              _outAsync, _heartbeatCallback, _stream);
+                              _outAsync, _heartbeatCallback, _requestReceived, _stream);
     }
 
 private:
@@ -109,6 +120,9 @@ private:
     const ObjectAdapterPtr _adapter;
     const OutgoingAsyncBasePtr _outAsync;
     const ConnectionCallbackPtr _heartbeatCallback;
+    const AdmissionControlPtr _admissionControl;
+    const IceUtil::Time _ready;
+    const IceUtil::Time _requestReceived;
     BasicStream _stream;
 };
 
@@ -457,6 +471,45 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+IceUtil::Int64
+Ice::ConnectionI::roundTripTime()
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
+
+    IceUtil::Time now = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    if(_timedRequestId != 0)
+    {
+        if(_requests.find(_timedRequestId) == _requests.end() &&
+           _asyncRequests.find(_timedRequestId) == _asyncRequests.end())
+        {
+            //
+            // The timed request was canceled.
+            //
+            _timedRequestId = 0;
+        }
+        else
+        {
+            //
+            // Don't wait for the reply of a request that takes longer
+            // than usual to account for it: a peer that stopped
+            // answering is slow.
+            //
+            IceUtil::Int64 elapsed = (now - _timedRequestTime).toMicroSeconds();
+            return elapsed > _roundTripTime ? elapsed : _roundTripTime;
+        }
+    }
+
+    //
+    // The measurement decays after a while without requests, the
+    // peer's load might have changed since then.
+    //
+    if(_roundTripTime >= 0 && now - _roundTripTimeUpdate > IceUtil::Time::seconds(10))
+    {
+        _roundTripTime = -1;
+    }
+    return _roundTripTime;
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -571,6 +624,10 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
     {
         if(acm.heartbeat != HeartbeatOnInvocation || _dispatchCount > 0)
         {
+            if(_instance->flightRecorder())
+            {
+                _instance->flightRecorder()->record(FlightAcmHeartbeat, this);
+            }
             heartbeat();
         }
     }
@@ -595,6 +652,10 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
             // Close the connection if we didn't receive a heartbeat in
             // the last period.
             //
+            if(_instance->flightRecorder())
+            {
+                _instance->flightRecorder()->record(FlightAcmClose, this, 1);
+            }
             setState(StateClosed, ConnectionTimeoutException(__FILE__, __LINE__));
         }
         else if(acm.close != CloseOnInvocation &&
@@ -603,6 +664,10 @@ Ice::ConnectionI::monitor(const IceUtil::Time& now, const ACMConfig& acm)
             //
             // The connection is idle, close it.
             //
+            if(_instance->flightRecorder())
+            {
+                _instance->flightRecorder()->record(FlightAcmClose, this, 0);
+            }
             setState(StateClosing, ConnectionTimeoutException(__FILE__, __LINE__));
         }
     }
@@ -646,6 +711,15 @@ Ice::ConnectionI::sendRequest(OutgoingBase* out, bool compress, bool response, i
             requestId = _nextRequestId++;
         }
 
+        //
+        // Time the request if no other request is timed.
+        //
+        if(_timedRequestId == 0)
+        {
+            _timedRequestId = requestId;
+            _timedRequestTime = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+
         //
         // Fill in the request ID.
         //
@@ -740,6 +814,15 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
             requestId = _nextRequestId++;
         }
 
+        //
+        // Time the request if no other request is timed.
+        //
+        if(_timedRequestId == 0)
+        {
+            _timedRequestId = requestId;
+            _timedRequestTime = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        }
+
         //
         // Fill in the request ID.
         //
@@ -1182,6 +1265,8 @@ Ice::ConnectionI::sendResponse(Int, BasicStream* os, Byte compressFlag, bool /*a
 
     try
     {
+        finishRequests(1);
+
         if(--_dispatchCount == 0)
         {
             if(_state == StateFinished)
@@ -1221,6 +1306,8 @@ Ice::ConnectionI::sendNoResponse()
 
     try
     {
+        finishRequests(1);
+
         if(--_dispatchCount == 0)
         {
             if(_state == StateFinished)
@@ -1266,6 +1353,8 @@ Ice::ConnectionI::invokeException(Ice::Int, const LocalException& ex, int invoke
 
     if(invokeNum > 0)
     {
+        finishRequests(invokeNum);
+
         assert(_dispatchCount >= invokeNum);
         _dispatchCount -= invokeNum;
         if(_dispatchCount == 0)
@@ -1303,17 +1392,26 @@ Ice::ConnectionI::setAdapter(const ObjectAdapterPtr& adapter)
 
     _adapter = adapter;
 
+    //
+    // The requests admitted by the previous adapter are no longer
+    // counted.
+    //
+    finishRequests(_admittedCount);
+
     if(_adapter)
     {
         _servantManager = dynamic_cast<ObjectAdapterI*>(_adapter.get())->getServantManager();
+        _admissionControl = dynamic_cast<ObjectAdapterI*>(_adapter.get())->getAdmissionControl();
         if(!_servantManager)
         {
             _adapter = 0;
+            _admissionControl = 0;
         }
     }
     else
     {
         _servantManager = 0;
+        _admissionControl = 0;
     }
 
     //
@@ -1468,6 +1566,8 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
     ObjectAdapterPtr adapter;
     OutgoingAsyncBasePtr outAsync;
     ConnectionCallbackPtr heartbeatCallback;
+    AdmissionControlPtr admissionControl;
+    IceUtil::Time received;
     int dispatchCount = 0;
 
     ThreadPoolMessage<ConnectionI> msg(current, *this);
@@ -1679,6 +1779,27 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                 return; // Nothing to dispatch we're done!
             }
 
+            //
+            // The queueing delay of the requests is measured from the
+            // time the selector reported the connection ready, it
+            // includes the wait for a thread pool thread and for the
+            // dispatcher if there's one.
+            //
+            if(invokeNum > 0 && _admissionControl && _admissionControl->measureQueueDelay())
+            {
+                admissionControl = _admissionControl;
+            }
+
+            //
+            // The time spent queued before the dispatch is charged
+            // against the request deadlines, and the spans of traced
+            // requests start when they are received.
+            //
+            if(invokeNum > 0)
+            {
+                received = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            }
+
             _dispatchCount += dispatchCount;
             io.completed();
         }
@@ -1722,13 +1843,18 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
 
     if(!_dispatcher) // Optimization, call dispatch() directly if there's no dispatcher.
     {
+        if(admissionControl)
+        {
+            admissionControl->dispatched(IceUtil::Time::now(IceUtil::Time::Monotonic) - current.ready);
+        }
         dispatch(startCB, sentCBs, compress, requestId, invokeNum, servantManager, adapter, outAsync, heartbeatCallback,
-                 current.stream);
+                 received, current.stream);
     }
     else
     {
         _threadPool->dispatchFromThisThread(new DispatchCall(this, startCB, sentCBs, compress, requestId, invokeNum,
                                                              servantManager, adapter, outAsync, heartbeatCallback,
+                                                             admissionControl, current.ready, received,
                                                              current.stream));
     }
 }
@@ -1737,7 +1863,8 @@ void
 ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMessage>& sentCBs,
                       Byte compress, Int requestId, Int invokeNum, const ServantManagerPtr& servantManager,
                       const ObjectAdapterPtr& adapter, const OutgoingAsyncBasePtr& outAsync,
-                      const ConnectionCallbackPtr& heartbeatCallback, BasicStream& stream)
+                      const ConnectionCallbackPtr& heartbeatCallback, const IceUtil::Time& received,
+                      BasicStream& stream)
 {
     int dispatchedCount = 0;
 
@@ -1814,7 +1941,7 @@ ConnectionI::dispatch(const StartCallbackPtr& startCB, const vector<OutgoingMess
     //
     if(invokeNum)
     {
-        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter);
+        invokeAll(stream, invokeNum, requestId, compress, servantManager, adapter, received);
 
         //
         // Don't increase count, the dispatch count is
@@ -2111,6 +2238,7 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _connector(connector),
     _endpoint(endpoint),
     _adapter(adapter),
+    _admittedCount(0),
     _dispatcher(_instance->initializationData().dispatcher), // Cached for better performance.
     _logger(_instance->initializationData().logger), // Cached for better performance.
     _traceLevels(_instance->traceLevels()), // Cached for better performance.
@@ -2123,6 +2251,8 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     _warnUdp(_instance->initializationData().properties->getPropertyAsInt("Ice.Warn.Datagrams") > 0),
     _compressionLevel(1),
     _nextRequestId(1),
+    _timedRequestId(0),
+    _roundTripTime(-1),
     _requestsHint(_requests.end()),
     _asyncRequestsHint(_asyncRequests.end()),
     _messageSizeMax(adapter ? adapter->messageSizeMax() : _instance->messageSizeMax()),
@@ -2152,6 +2282,7 @@ Ice::ConnectionI::ConnectionI(const CommunicatorPtr& communicator,
     if(adapter)
     {
         _servantManager = adapter->getServantManager();
+        _admissionControl = adapter->getAdmissionControl();
     }
 
     if(_monitor && _monitor->getACM().timeout > 0)
@@ -2412,6 +2543,10 @@ Ice::ConnectionI::setState(State state)
             }
         }
     }
+    if(_instance->flightRecorder())
+    {
+        _instance->flightRecorder()->record(FlightConnectionState, this, _state, state);
+    }
     _state = state;
 
     notifyAll();
@@ -2830,6 +2965,12 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
     assert(_state < StateClosed);
 
+    if(_instance->flightRecorder())
+    {
+        _instance->flightRecorder()->record(FlightMessageSent, this, message.stream->b[8],
+                                            static_cast<Int>(message.stream->b.size()));
+    }
+
     message.stream->i = 0; // Reset the message stream iterator before starting sending the message.
 
     if(!_sendStreams.empty())
@@ -3158,6 +3299,12 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
         stream.read(messageType);
         stream.read(compress);
 
+        if(_instance->flightRecorder())
+        {
+            _instance->flightRecorder()->record(FlightMessageReceived, this, messageType,
+                                                static_cast<Int>(stream.b.size()));
+        }
+
         if(compress == 2)
         {
 #ifdef ICE_HAS_BZIP2
@@ -3213,10 +3360,13 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
                 {
                     traceRecv(stream, _logger, _traceLevels);
                     stream.read(requestId);
-                    invokeNum = 1;
-                    servantManager = _servantManager;
-                    adapter = _adapter;
-                    ++dispatchCount;
+                    if(admitRequests(stream, requestId, 1))
+                    {
+                        invokeNum = 1;
+                        servantManager = _servantManager;
+                        adapter = _adapter;
+                        ++dispatchCount;
+                    }
                 }
                 break;
             }
@@ -3237,9 +3387,16 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
                         invokeNum = 0;
                         throw UnmarshalOutOfBoundsException(__FILE__, __LINE__);
                     }
-                    servantManager = _servantManager;
-                    adapter = _adapter;
-                    dispatchCount += invokeNum;
+                    if(admitRequests(stream, 0, invokeNum))
+                    {
+                        servantManager = _servantManager;
+                        adapter = _adapter;
+                        dispatchCount += invokeNum;
+                    }
+                    else
+                    {
+                        invokeNum = 0;
+                    }
                 }
                 break;
             }
@@ -3250,6 +3407,11 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
 
                 stream.read(requestId);
 
+                if(requestId == _timedRequestId)
+                {
+                    updateRoundTripTime();
+                }
+
                 map<Int, OutgoingBase*>::iterator p = _requests.end();
                 map<Int, OutgoingAsyncBasePtr>::iterator q = _asyncRequests.end();
 
@@ -3388,7 +3550,8 @@ Ice::ConnectionI::parseMessage(BasicStream& stream, Int& invokeNum, Int& request
 
 void
 Ice::ConnectionI::invokeAll(BasicStream& stream, Int invokeNum, Int requestId, Byte compress,
-                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter)
+                            const ServantManagerPtr& servantManager, const ObjectAdapterPtr& adapter,
+                            const IceUtil::Time& received)
 {
     //
     // Note: In contrast to other private or protected methods, this
@@ -3410,7 +3573,15 @@ Ice::ConnectionI::invokeAll(BasicStream& stream, Int invokeNum, Int requestId, B
             //
             // Dispatch the invocation.
             //
-            in.invoke(servantManager, &stream);
+            if(_instance->flightRecorder())
+            {
+                _instance->flightRecorder()->record(FlightDispatchStart, this, requestId);
+            }
+            in.invoke(servantManager, &stream, received);
+            if(_instance->flightRecorder())
+            {
+                _instance->flightRecorder()->record(FlightDispatchEnd, this, requestId);
+            }
 
             --invokeNum;
         }
@@ -3423,6 +3594,110 @@ Ice::ConnectionI::invokeAll(BasicStream& stream, Int invokeNum, Int requestId, B
     }
 }
 
+void
+Ice::ConnectionI::updateRoundTripTime()
+{
+    //
+    // This must be called with the mutex locked.
+    //
+    // The round-trip time is an exponentially weighted moving average
+    // of the requests timed one at a time.
+    //
+    _roundTripTimeUpdate = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    IceUtil::Int64 sample = (_roundTripTimeUpdate - _timedRequestTime).toMicroSeconds();
+    _roundTripTime = _roundTripTime < 0 ? sample : _roundTripTime + (sample - _roundTripTime) / 4;
+    _timedRequestId = 0;
+}
+
+bool
+Ice::ConnectionI::admitRequests(BasicStream& stream, Int requestId, Int invokeNum)
+{
+    if(!_admissionControl || invokeNum == 0)
+    {
+        return true;
+    }
+
+    if(_admissionControl->admit(invokeNum))
+    {
+        _admittedCount += invokeNum;
+        return true;
+    }
+
+    //
+    // The adapter is overloaded: the requests aren't dispatched and
+    // a twoway request gets an UnknownLocalException reply with the
+    // overloaded reason. The connection stays open and its other
+    // requests aren't affected. Clients recognize the reason and retry
+    // the request, possibly with another endpoint, even if it isn't
+    // idempotent since it wasn't dispatched.
+    //
+    trace("received request while overloaded\n(rejected by server)", stream, _logger, _traceLevels);
+
+    //
+    // Report the rejected requests as failed dispatches.
+    //
+    const CommunicatorObserverPtr& obsv = _instance->initializationData().observer;
+    if(obsv)
+    {
+        try
+        {
+            Current current;
+            current.adapter = _adapter;
+            current.con = this;
+            current.requestId = requestId;
+            for(Int n = invokeNum; n > 0; --n)
+            {
+                BasicStream::Container::iterator start = stream.i;
+                stream.read(current.id);
+                vector<string> facetPath;
+                stream.read(facetPath);
+                current.facet = facetPath.empty() ? string() : facetPath[0];
+                stream.read(current.operation, false);
+                Byte mode;
+                stream.read(mode);
+                current.mode = static_cast<OperationMode>(mode);
+                current.ctx.clear();
+                stream.read(current.ctx);
+                Int sz;
+                stream.read(sz);
+                stream.i -= 4;
+
+                IceInternal::DispatchObserver observer;
+                observer.attach(obsv->getDispatchObserver(current, static_cast<Int>(stream.i - start + sz)));
+                observer.failed(UnknownLocalException(__FILE__, __LINE__).ice_name());
+                stream.skipEncaps();
+            }
+        }
+        catch(const LocalException&)
+        {
+            // Ignore, the requests are rejected anyway.
+        }
+    }
+
+    if(requestId != 0)
+    {
+        BasicStream os(_instance.get(), currentProtocolEncoding);
+        os.writeBlob(replyHdr, sizeof(replyHdr));
+        os.write(requestId);
+        os.write(replyUnknownLocalException);
+        os.write(overloadedReason, false);
+        OutgoingMessage message(&os, false);
+        sendMessage(message);
+    }
+    return false;
+}
+
+void
+Ice::ConnectionI::finishRequests(int count)
+{
+    if(_admittedCount > 0)
+    {
+        count = count < _admittedCount ? count : _admittedCount;
+        _admittedCount -= count;
+        _admissionControl->finished(count);
+    }
+}
+
 void
 Ice::ConnectionI::scheduleTimeout(SocketOperation status)
 {
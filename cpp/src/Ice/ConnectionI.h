@@ -25,6 +25,7 @@
 #include <Ice/TransceiverF.h>
 #include <Ice/ObjectAdapterF.h>
 #include <Ice/ServantManagerF.h>
+#include <Ice/AdmissionControlF.h>
 #include <Ice/EndpointIF.h>
 #include <Ice/ConnectorF.h>
 #include <Ice/LoggerF.h>
@@ -156,6 +157,12 @@ public:
     virtual void close(bool); // From Connection.
 
     bool isActiveOrHolding() const;
+
+    //
+    // Returns the smoothed round-trip time of the requests sent over
+    // the connection in microseconds, or -1 if it's unknown.
+    //
+    IceUtil::Int64 roundTripTime();
     bool isFinished() const;
 
     void throwException() const; // Throws the connection exception if destroyed.
@@ -233,7 +240,7 @@ public:
     void dispatch(const StartCallbackPtr&, const std::vector<OutgoingMessage>&, Byte, Int, Int,
                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&,
                   const IceInternal::OutgoingAsyncBasePtr&,
-                  const ConnectionCallbackPtr&, IceInternal::BasicStream&);
+                  const ConnectionCallbackPtr&, const IceUtil::Time&, IceInternal::BasicStream&);
     void finish(bool);
 
     void closeCallback(const ConnectionCallbackPtr&);
@@ -281,7 +288,12 @@ private:
                                               IceInternal::OutgoingAsyncBasePtr&, ConnectionCallbackPtr&, int&);
 
     void invokeAll(IceInternal::BasicStream&, Int, Int, Byte,
-                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&);
+                   const IceInternal::ServantManagerPtr&, const ObjectAdapterPtr&, const IceUtil::Time&);
+
+    void updateRoundTripTime();
+
+    bool admitRequests(IceInternal::BasicStream&, Int, Int);
+    void finishRequests(int);
 
     void scheduleTimeout(IceInternal::SocketOperation status);
     void unscheduleTimeout(IceInternal::SocketOperation status);
@@ -309,6 +321,8 @@ private:
 
     ObjectAdapterPtr _adapter;
     IceInternal::ServantManagerPtr _servantManager;
+    IceInternal::AdmissionControlPtr _admissionControl;
+    int _admittedCount; // The number of requests admitted by _admissionControl and not answered yet.
 
     const bool _dispatcher;
     const LoggerPtr _logger;
@@ -332,6 +346,11 @@ private:
 
     Int _nextRequestId;
 
+    Int _timedRequestId;
+    IceUtil::Time _timedRequestTime;
+    IceUtil::Int64 _roundTripTime;
+    IceUtil::Time _roundTripTimeUpdate;
+
     std::map<Int, IceInternal::OutgoingBase*> _requests;
     std::map<Int, IceInternal::OutgoingBase*>::iterator _requestsHint;
 
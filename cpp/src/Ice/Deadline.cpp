@@ -0,0 +1,260 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Deadline.h>
+#include <Ice/BasicStream.h>
+#include <Ice/ImplicitContextI.h>
+#include <Ice/Initialize.h>
+#include <Ice/Instance.h>
+#include <Ice/Protocol.h>
+#include <Ice/Reference.h>
+#include <IceUtil/InputUtil.h>
+
+#include <sstream>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+#if defined(ICE_OS_WINRT)
+
+const Long*
+getCurrent()
+{
+    return 0;
+}
+
+void
+setCurrent(const Long*)
+{
+}
+
+#else
+
+bool keyInitialized = false;
+#   if defined(_WIN32)
+DWORD key;
+#   else
+pthread_key_t key;
+#   endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+        //
+        // The key is never deleted, dispatches can still be in progress
+        // when static objects are destroyed.
+        //
+#   if defined(_WIN32)
+        key = TlsAlloc();
+        keyInitialized = key != TLS_OUT_OF_INDEXES;
+#   else
+        keyInitialized = pthread_key_create(&key, 0) == 0;
+#   endif
+    }
+};
+
+Init init;
+
+const Long*
+getCurrent()
+{
+    if(!keyInitialized)
+    {
+        return 0;
+    }
+#   if defined(_WIN32)
+    return static_cast<const Long*>(TlsGetValue(key));
+#   else
+    return static_cast<const Long*>(pthread_getspecific(key));
+#   endif
+}
+
+void
+setCurrent(const Long* deadline)
+{
+    if(keyInitialized)
+    {
+#   if defined(_WIN32)
+        TlsSetValue(key, const_cast<Long*>(deadline));
+#   else
+        pthread_setspecific(key, deadline);
+#   endif
+    }
+}
+
+#endif
+
+}
+
+Long
+IceInternal::currentDeadline()
+{
+    const Long* deadline = getCurrent();
+    return deadline ? *deadline : 0;
+}
+
+Long
+Ice::getDispatchDeadline()
+{
+    return IceInternal::currentDeadline();
+}
+
+IceInternal::DeadlineScope::DeadlineScope(const Long* deadline) :
+    _previous(getCurrent())
+{
+    setCurrent(deadline);
+}
+
+IceInternal::DeadlineScope::~DeadlineScope()
+{
+    setCurrent(_previous);
+}
+
+void
+IceInternal::writeRequestContext(BasicStream* os, Reference* ref, const Context* context, const TraceSpan& span)
+{
+    Long remaining = -1;
+    int invocationTimeout = ref->getInvocationTimeout();
+    if(invocationTimeout > 0)
+    {
+        remaining = invocationTimeout;
+    }
+    Long deadline = currentDeadline();
+    if(deadline > 0)
+    {
+        //
+        // The dispatch deadline is sent even if it already expired,
+        // the receiver then drops the request without dispatching it.
+        //
+        Long left = deadline - deadlineNow();
+        left = left > 0 ? left : 0;
+        remaining = remaining < 0 || left < remaining ? left : remaining;
+    }
+
+    const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
+    if(remaining < 0 && !span.isStarted())
+    {
+        if(context != 0)
+        {
+            //
+            // Explicit context
+            //
+            os->write(*context);
+        }
+        else
+        {
+            //
+            // Implicit context
+            //
+            const Context& prxContext = ref->getContext()->getValue();
+            if(implicitContext == 0)
+            {
+                os->write(prxContext);
+            }
+            else
+            {
+                implicitContext->write(prxContext, os);
+            }
+        }
+        return;
+    }
+
+    Context ctx;
+    if(context != 0)
+    {
+        ctx = *context;
+    }
+    else if(implicitContext == 0)
+    {
+        ctx = ref->getContext()->getValue();
+    }
+    else
+    {
+        implicitContext->combine(ref->getContext()->getValue(), ctx);
+    }
+    if(remaining >= 0)
+    {
+        ostringstream v;
+        v << remaining;
+        ctx[deadlineContextKey] = v.str();
+    }
+    if(span.isStarted())
+    {
+        span.writeContext(ctx);
+    }
+    os->write(ctx);
+}
+
+Long
+IceInternal::readRequestDeadline(Context& ctx, const IceUtil::Time& received)
+{
+    Context::iterator p = ctx.find(deadlineContextKey);
+    if(p == ctx.end())
+    {
+        return 0;
+    }
+
+    Long remaining;
+    bool valid = IceUtilInternal::stringToInt64(p->second, remaining) && remaining >= 0;
+    ctx.erase(p);
+    if(!valid)
+    {
+        return 0;
+    }
+    return (received != IceUtil::Time() ? received.toMilliSeconds() : deadlineNow()) + remaining;
+}
+
+void
+IceInternal::copyRequest(BasicStream* os, const BasicStream& request, const IceUtil::Time& elapsed)
+{
+    BasicStream is(request.instance(), currentProtocolEncoding);
+    is.writeBlob(request.b.begin(), request.b.size());
+    is.i = is.b.begin() + headerSize + sizeof(Int);
+
+    Identity id;
+    is.read(id);
+    vector<string> facetPath;
+    is.read(facetPath);
+    string operation;
+    is.read(operation, false);
+    Byte mode;
+    is.read(mode);
+
+    BasicStream::Container::iterator contextStart = is.i;
+    Context ctx;
+    is.read(ctx);
+
+    Long remaining;
+    Context::iterator p = ctx.find(deadlineContextKey);
+    if(p == ctx.end() || !IceUtilInternal::stringToInt64(p->second, remaining))
+    {
+        os->writeBlob(request.b.begin(), request.b.size());
+        return;
+    }
+
+    remaining -= elapsed.toMilliSeconds();
+    ostringstream v;
+    v << (remaining > 0 ? remaining : 0);
+    p->second = v.str();
+
+    os->writeBlob(is.b.begin(), contextStart - is.b.begin());
+    os->write(ctx);
+    os->writeBlob(is.i, is.b.end() - is.i);
+}
@@ -0,0 +1,88 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_DEADLINE_H
+#define ICE_DEADLINE_H
+
+#include <Ice/Config.h>
+#include <Ice/Current.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/TraceSpan.h>
+#include <IceUtil/Time.h>
+
+namespace IceInternal
+{
+
+class BasicStream;
+
+//
+// The deadline of an invocation is sent in the request context as the
+// number of milliseconds left before the caller gives up on it. The
+// receiver converts it back to an absolute time on its own monotonic
+// clock, counted from when the request was read from the connection,
+// and exposes it with Ice::getDispatchDeadline().
+//
+const char* const deadlineContextKey = "_deadline";
+
+inline Ice::Long
+deadlineNow()
+{
+    return IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+}
+
+//
+// Returns the deadline of the dispatch in progress in the calling
+// thread, or 0 if there's none or it doesn't have a deadline.
+//
+Ice::Long currentDeadline();
+
+//
+// Makes the deadline of a dispatch the current deadline of the calling
+// thread for the lifetime of the object, nested invocations made from
+// the dispatch thread then propagate it.
+//
+class DeadlineScope : private IceUtil::noncopyable
+{
+public:
+
+    DeadlineScope(const Ice::Long*);
+    ~DeadlineScope();
+
+private:
+
+    const Ice::Long* _previous;
+};
+
+//
+// Writes the context of a request: the given context or, if null, the
+// proxy and implicit contexts, with the invocation deadline if the
+// proxy has an invocation timeout or the calling thread is dispatching
+// a request with a deadline, and with the trace entry if the span of
+// the invocation is started.
+//
+void writeRequestContext(BasicStream*, Reference*, const Ice::Context*, const TraceSpan&);
+
+//
+// Removes the deadline entry from the context of a received request
+// and returns the corresponding absolute deadline, or 0 if the request
+// doesn't have a deadline. The remaining time is counted from the
+// given monotonic time at which the request was received so that the
+// time the request spent queued before its dispatch is charged.
+//
+Ice::Long readRequestDeadline(Ice::Context&, const IceUtil::Time&);
+
+//
+// Writes a copy of an encoded request whose deadline entry, if any,
+// is reduced by the given time elapsed since the request was encoded.
+//
+void copyRequest(BasicStream*, const BasicStream&, const IceUtil::Time&);
+
+}
+
+#endif
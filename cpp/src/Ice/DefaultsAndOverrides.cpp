@@ -165,4 +165,7 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
 
     bool slicedFormat = properties->getPropertyAsIntWithDefault("Ice.Default.SlicedFormat", 0) > 0;
     const_cast<FormatType&>(defaultFormat) = slicedFormat ? SlicedFormat : CompactFormat;
+
+    const_cast<bool&>(latencyAwareEndpointSelection) =
+        properties->getPropertyAsIntWithDefault("Ice.LatencyAwareEndpointSelection", 0) > 0;
 }
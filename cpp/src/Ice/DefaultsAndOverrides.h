@@ -40,6 +40,14 @@ public:
     Ice::EncodingVersion defaultEncoding;
     Ice::FormatType defaultFormat;
 
+    //
+    // With Ice.LatencyAwareEndpointSelection, proxies with the Random
+    // endpoint selection prefer the endpoints with the lowest round-trip
+    // times. This is specific to the C++ run time, so it's a property
+    // rather than an EndpointSelectionType value.
+    //
+    bool latencyAwareEndpointSelection;
+
     bool overrideTimeout;
     Ice::Int overrideTimeoutValue;
     bool overrideConnectTimeout;
@@ -0,0 +1,157 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/FlightRecorderI.h>
+#include <Ice/Properties.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/Time.h>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+typedef unsigned long long UInt64;
+
+Int
+currentThread()
+{
+#ifdef _WIN32
+    return static_cast<Int>(GetCurrentThreadId());
+#else
+    //
+    // pthread_t is an opaque type, its bytes are folded into an int.
+    //
+    pthread_t self = pthread_self();
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(&self);
+    unsigned int id = 0;
+    for(size_t i = 0; i < sizeof(pthread_t); ++i)
+    {
+        id = id * 31 + p[i];
+    }
+    return static_cast<Int>(id);
+#endif
+}
+
+void
+writeLittleEndian(vector<Byte>& bytes, Long value, int size)
+{
+    UInt64 v = static_cast<UInt64>(value);
+    for(int i = 0; i < size; ++i, v >>= 8)
+    {
+        bytes.push_back(static_cast<Byte>(v & 0xff));
+    }
+}
+
+}
+
+IceInternal::FlightRecorderI::FlightRecorderI(const PropertiesPtr& properties) :
+    _mask(0),
+    _next(0)
+{
+    //
+    // The size is rounded up to a power of 2 to compute the position of
+    // the events with a mask.
+    //
+    Int size = min(max(properties->getPropertyAsInt("Ice.FlightRecorder.Size"), 16), 1 << 24);
+    unsigned int capacity = 1;
+    while(capacity < static_cast<unsigned int>(size))
+    {
+        capacity <<= 1;
+    }
+    _mask = capacity - 1;
+
+    Event empty = { 0, 0, 0, 0, 0, 0, 0 };
+    _events.resize(capacity, empty);
+}
+
+void
+IceInternal::FlightRecorderI::record(FlightEventType type, const void* source, Int a, Int b)
+{
+    Event& event = _events[static_cast<unsigned int>(_next.fetch_add(1)) & _mask];
+    event.time = IceUtil::Time::now().toMicroSeconds();
+    event.source = static_cast<Long>(reinterpret_cast<size_t>(source));
+    event.thread = currentThread();
+    event.type = static_cast<Short>(type);
+    event.a = a;
+    event.b = b;
+}
+
+vector<Byte>
+IceInternal::FlightRecorderI::snapshot() const
+{
+    unsigned int next = static_cast<unsigned int>(_next.load());
+    unsigned int count = min(next, _mask + 1);
+
+    vector<Event> events;
+    events.reserve(count);
+    for(unsigned int i = next - count; i != next; ++i)
+    {
+        const Event& event = _events[i & _mask];
+        if(event.type != 0)
+        {
+            events.push_back(event);
+        }
+    }
+
+    vector<Byte> bytes;
+    bytes.reserve(flightRecorderHeaderSize + events.size() * flightEventSize);
+    bytes.insert(bytes.end(), flightRecorderMagic, flightRecorderMagic + sizeof(flightRecorderMagic));
+    bytes.push_back(flightRecorderVersion);
+    writeLittleEndian(bytes, static_cast<Long>(events.size()), 4);
+    for(vector<Event>::const_iterator p = events.begin(); p != events.end(); ++p)
+    {
+        writeLittleEndian(bytes, p->time, 8);
+        writeLittleEndian(bytes, p->source, 8);
+        writeLittleEndian(bytes, p->thread, 4);
+        writeLittleEndian(bytes, p->type, 2);
+        writeLittleEndian(bytes, 0, 2);
+        writeLittleEndian(bytes, p->a, 4);
+        writeLittleEndian(bytes, p->b, 4);
+    }
+    return bytes;
+}
+
+void
+IceInternal::FlightRecorderI::save(const string& path) const
+{
+    vector<Byte> bytes = snapshot();
+
+    FILE* file = IceUtilInternal::fopen(path, "wb");
+    if(file == 0)
+    {
+        FileException ex(__FILE__, __LINE__);
+        ex.path = path;
+        ex.error = getSystemErrno();
+        throw ex;
+    }
+    size_t written = fwrite(&bytes[0], 1, bytes.size(), file);
+    int error = getSystemErrno();
+    fclose(file);
+    if(written != bytes.size())
+    {
+        FileException ex(__FILE__, __LINE__);
+        ex.path = path;
+        ex.error = error;
+        throw ex;
+    }
+}
+
+ByteSeq
+IceInternal::FlightRecorderI::dump(const Current&)
+{
+    return snapshot();
+}
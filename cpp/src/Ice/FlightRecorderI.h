@@ -0,0 +1,103 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_FLIGHT_RECORDER_I_H
+#define ICE_FLIGHT_RECORDER_I_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Atomic.h>
+#include <Ice/FlightRecorder.h>
+#include <Ice/PropertiesF.h>
+
+#include <vector>
+
+namespace IceInternal
+{
+
+//
+// The events of the flight recorder, with the meaning of their a and b
+// arguments. The source of an event is the connection or thread pool
+// which recorded it.
+//
+enum FlightEventType
+{
+    FlightConnectionState = 1,  // Connection state change, a = old state, b = new state.
+    FlightMessageSent = 2,      // Message sent or queued, a = message type, b = size.
+    FlightMessageReceived = 3,  // Message received, a = message type, b = size.
+    FlightDispatchStart = 4,    // Dispatch started, a = request id.
+    FlightDispatchEnd = 5,      // Dispatch completed, a = request id.
+    FlightFollowerPromoted = 6, // Thread pool follower promoted, a = threads in use, b = threads in use for IO.
+    FlightSelectorWakeup = 7,   // Thread pool selector returned, a = ready handlers.
+    FlightAcmHeartbeat = 8,     // ACM heartbeat sent.
+    FlightAcmClose = 9          // ACM closed the connection, a = 1 if forcefully.
+};
+
+//
+// A dump of the flight recorder starts with a header of 8 bytes: the
+// magic "IFR", the format version and the number of events. Each event
+// then takes 32 bytes: the time (long, microseconds since the epoch),
+// the source (long), the thread (int), the type (short), 2 reserved
+// bytes and the a and b arguments (int). All the values are in
+// little-endian byte order.
+//
+const Ice::Byte flightRecorderMagic[] = { 0x49, 0x46, 0x52 }; // 'I', 'F', 'R'
+const Ice::Byte flightRecorderVersion = 1;
+const int flightRecorderHeaderSize = 8;
+const int flightEventSize = 32;
+
+//
+// The flight recorder of a communicator, enabled with the
+// Ice.FlightRecorder.Size property. The events are recorded in a ring
+// which is shared by all the threads, recording an event only costs an
+// atomic increment and a few stores so the recorder can be left enabled
+// in production. The oldest events are overwritten once the ring is
+// full. An event recorded while the ring is dumped might be incomplete.
+//
+class FlightRecorderI : public Ice::FlightRecorder
+{
+public:
+
+    FlightRecorderI(const Ice::PropertiesPtr&);
+
+    void record(FlightEventType, const void*, Ice::Int = 0, Ice::Int = 0);
+
+    //
+    // Returns the events in the binary format described above.
+    //
+    std::vector<Ice::Byte> snapshot() const;
+
+    //
+    // Saves the events to the given file.
+    //
+    void save(const std::string&) const;
+
+    virtual Ice::ByteSeq dump(const Ice::Current&);
+
+private:
+
+    struct Event
+    {
+        Ice::Long time;
+        Ice::Long source;
+        Ice::Int thread;
+        Ice::Short type;
+        Ice::Short reserved;
+        Ice::Int a;
+        Ice::Int b;
+    };
+
+    std::vector<Event> _events;
+    unsigned int _mask;
+    IceUtilInternal::Atomic _next;
+};
+typedef IceUtil::Handle<FlightRecorderI> FlightRecorderIPtr;
+
+}
+
+#endif
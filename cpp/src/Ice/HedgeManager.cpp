@@ -0,0 +1,433 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/HedgeManager.h>
+#include <Ice/Outgoing.h>
+#include <Ice/ConnectionI.h>
+#include <Ice/Deadline.h>
+#include <Ice/CollocatedRequestHandler.h>
+#include <Ice/RequestHandler.h>
+#include <Ice/Instance.h>
+#include <Ice/Reference.h>
+#include <Ice/LocatorInfo.h>
+#include <Ice/EndpointI.h>
+#include <Ice/ThreadPool.h>
+#include <Ice/TraceLevels.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+#include <Ice/Properties.h>
+#include <Ice/MetricsAdminI.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(HedgeManager* p) { return p; }
+IceUtil::Shared* IceInternal::upCast(HedgeRequest* p) { return p; }
+
+namespace
+{
+
+//
+// The histogram of an operation, which uses the buckets of the IceMX
+// latency histograms, is used once it has enough samples. The samples
+// are halved once there's too many to favor the recent ones.
+//
+const int minSamples = 100;
+const int maxSamples = 1024;
+
+//
+// The budget is counted in hundredths of a token, at most 10 tokens
+// can be saved for bursts.
+//
+const int tokenCost = 100;
+const int maxTokens = 10 * tokenCost;
+
+const size_t maxOperations = 1000;
+
+class HedgeCallback : public CallbackBase
+{
+public:
+
+    virtual void completed(const AsyncResultPtr& result) const
+    {
+        HedgeRequestPtr::dynamicCast(result)->replied();
+    }
+
+    virtual CallbackBasePtr verify(const LocalObjectPtr&)
+    {
+        return this;
+    }
+
+    virtual void sent(const AsyncResultPtr&) const
+    {
+    }
+
+    virtual bool hasSentCallback() const
+    {
+        return false;
+    }
+};
+
+class CancelHedge : public DispatchWorkItem
+{
+public:
+
+    CancelHedge(const HedgeRequestPtr& hedge) : _hedge(hedge)
+    {
+    }
+
+    virtual void run()
+    {
+        _hedge->cancel();
+    }
+
+private:
+
+    const HedgeRequestPtr _hedge;
+};
+
+}
+
+IceInternal::HedgeManager::Histogram::Histogram() : buckets(IceMX::latencyBucketCount), count(0)
+{
+}
+
+IceInternal::HedgeManager::HedgeManager(const PropertiesPtr& properties) :
+    _percentile(properties->getPropertyAsIntWithDefault("Ice.HedgePercentile", 0)),
+    _budget(properties->getPropertyAsIntWithDefault("Ice.HedgeBudget", 5)),
+    _tokens(0)
+{
+    if(_percentile < 0 || _percentile > 99)
+    {
+        const_cast<int&>(_percentile) = _percentile < 0 ? 0 : 99;
+    }
+    if(_budget < 0 || _budget > 100)
+    {
+        const_cast<int&>(_budget) = _budget < 0 ? 0 : 100;
+    }
+}
+
+bool
+IceInternal::HedgeManager::canHedge(const ReferencePtr& ref, OperationMode mode) const
+{
+    //
+    // Only idempotent two-way requests can be sent twice. Requests
+    // sent through a router are not hedged, the router would forward
+    // both to the same server.
+    //
+    return _percentile > 0 && _budget > 0 && mode != Normal && ref->getMode() == Reference::ModeTwoway &&
+        !ref->getRouterInfo() && (ref->isIndirect() ? ref->getLocatorInfo() : ref->getEndpoints().size() > 1);
+}
+
+IceUtil::Time
+IceInternal::HedgeManager::getDelay(const string& operation)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    _tokens = min(_tokens + _budget, maxTokens);
+
+    map<string, Histogram>::const_iterator p = _histograms.find(operation);
+    if(p == _histograms.end() || p->second.count < minSamples)
+    {
+        return IceUtil::Time();
+    }
+
+    const Histogram& histogram = p->second;
+    const int target = (histogram.count * _percentile + 99) / 100;
+    int count = 0;
+    for(int i = 0; i < IceMX::latencyBucketCount; ++i)
+    {
+        count += histogram.buckets[i];
+        if(count >= target)
+        {
+            return IceUtil::Time::microSeconds(IceMX::getLatencyBucketUpperBound(i));
+        }
+    }
+    return IceUtil::Time::microSeconds(IceMX::getLatencyBucketUpperBound(IceMX::latencyBucketCount - 1));
+}
+
+void
+IceInternal::HedgeManager::addLatency(const string& operation, const IceUtil::Time& latency)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    map<string, Histogram>::iterator p = _histograms.find(operation);
+    if(p == _histograms.end())
+    {
+        if(_histograms.size() >= maxOperations)
+        {
+            return;
+        }
+        p = _histograms.insert(make_pair(operation, Histogram())).first;
+    }
+
+    Histogram& histogram = p->second;
+    ++histogram.buckets[IceMX::getLatencyBucket(latency.toMicroSeconds())];
+    if(++histogram.count >= maxSamples)
+    {
+        histogram.count = 0;
+        for(vector<int>::iterator q = histogram.buckets.begin(); q != histogram.buckets.end(); ++q)
+        {
+            *q /= 2;
+            histogram.count += *q;
+        }
+    }
+}
+
+ObjectPrx
+IceInternal::HedgeManager::getProxy(const ObjectPrx& proxy, const EndpointIPtr& endpoint) const
+{
+    ReferencePtr ref = proxy->__reference();
+    vector<EndpointIPtr> endpoints;
+    if(ref->isIndirect())
+    {
+        //
+        // The endpoints of the replicas are provided by the locator. They
+        // are usually cached since the invocation already resolved them
+        // to establish its connection.
+        //
+        try
+        {
+            bool cached;
+            endpoints = ref->getLocatorInfo()->getEndpoints(ref, ref->getLocatorCacheTimeout(), cached);
+        }
+        catch(const LocalException&)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        endpoints = ref->getEndpoints();
+    }
+
+    //
+    // The hedged request is sent to the other endpoints, the proxy is
+    // direct if the endpoints come from the locator.
+    //
+    EndpointSeq others;
+    for(vector<EndpointIPtr>::const_iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        if(!endpoint || !(*p)->equivalent(endpoint))
+        {
+            others.push_back(*p);
+        }
+    }
+    if(others.empty())
+    {
+        return 0;
+    }
+    return proxy->ice_endpoints(others);
+}
+
+bool
+IceInternal::HedgeManager::acquire()
+{
+    IceUtil::Mutex::Lock sync(*this);
+    if(_tokens < tokenCost)
+    {
+        return false;
+    }
+    _tokens -= tokenCost;
+    return true;
+}
+
+IceInternal::HedgeRequest::HedgeRequest(const ObjectPrx& proxy, const string& operation, OperationMode mode,
+                                        const BasicStream& os, const IceUtil::Time& elapsed) :
+    ProxyOutgoingAsyncBase(proxy, operation, new HedgeCallback, 0),
+    _outgoing(0),
+    _replied(false),
+    _canceling(false)
+{
+    _mode = mode;
+
+    //
+    // The deadline sent with the request is charged with the time
+    // elapsed since the invocation started.
+    //
+    copyRequest(&_os, os, elapsed);
+}
+
+void
+IceInternal::HedgeRequest::invoke(ProxyOutgoingBase* outgoing, const RequestHandlerPtr& handler)
+{
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _outgoing = outgoing;
+        _outgoingHandler = handler;
+    }
+    invoke();
+}
+
+void
+IceInternal::HedgeRequest::invoke(const ProxyOutgoingAsyncBasePtr& outAsync)
+{
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _outAsync = outAsync;
+    }
+    invoke();
+}
+
+bool
+IceInternal::HedgeRequest::sent()
+{
+    return ProxyOutgoingAsyncBase::sent(false);
+}
+
+AsyncStatus
+IceInternal::HedgeRequest::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
+{
+    _cachedConnection = connection;
+    return connection->sendAsyncRequest(this, compress, response, 0);
+}
+
+AsyncStatus
+IceInternal::HedgeRequest::invokeCollocated(CollocatedRequestHandler* handler)
+{
+    return handler->invokeAsyncRequest(this, 0);
+}
+
+bool
+IceInternal::HedgeRequest::completed()
+{
+    //
+    // Called with the connection locked, the invocation is canceled
+    // by replied() from a client thread pool thread.
+    //
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _replied = true;
+    }
+    return finished(true);
+}
+
+bool
+IceInternal::HedgeRequest::takeReply(BasicStream& is)
+{
+    IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+    if(!_replied)
+    {
+        return false;
+    }
+    _replied = false;
+    is.swap(_is);
+    return true;
+}
+
+void
+IceInternal::HedgeRequest::detach()
+{
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+
+        //
+        // Wait for replied() to cancel the request of the synchronous
+        // invocation, which must not be destroyed before.
+        //
+        while(_canceling)
+        {
+            _monitor.wait();
+        }
+
+        _outgoing = 0;
+        _outgoingHandler = 0;
+        _outAsync = 0;
+        if(_replied || isCompleted())
+        {
+            return;
+        }
+    }
+
+    //
+    // The request is canceled from a client thread pool thread, this
+    // is called by the invocation which might hold the lock of its
+    // connection.
+    //
+    try
+    {
+        _instance->clientThreadPool()->dispatch(new CancelHedge(this));
+    }
+    catch(const CommunicatorDestroyedException&)
+    {
+    }
+}
+
+void
+IceInternal::HedgeRequest::replied()
+{
+    ProxyOutgoingBase* outgoing = 0;
+    RequestHandlerPtr handler;
+    ProxyOutgoingAsyncBasePtr outAsync;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        if(!_replied)
+        {
+            return; // The request failed or the reply was taken.
+        }
+        if(_outgoing)
+        {
+            outgoing = _outgoing;
+            handler = _outgoingHandler;
+            _canceling = true;
+        }
+        else
+        {
+            outAsync = _outAsync;
+        }
+    }
+
+    if(outgoing)
+    {
+        //
+        // The synchronous invocation takes the reply once its request
+        // is canceled. The request is canceled without holding our lock
+        // since the handler locks the connection.
+        //
+        handler->requestCanceled(outgoing, InvocationCanceledException(__FILE__, __LINE__));
+
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _canceling = false;
+        _monitor.notifyAll();
+    }
+    else if(outAsync)
+    {
+        outAsync->hedgeReplied();
+    }
+}
+
+void
+IceInternal::HedgeRequest::invoke()
+{
+    if(_instance->traceLevels()->retry >= 1)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->retryCat);
+        out << "hedging operation call `" << getOperation() << "'\nproxy = " << _proxy;
+    }
+
+    try
+    {
+        invokeImpl(true);
+    }
+    catch(const Exception&)
+    {
+        //
+        // The hedged request failed, the invocation carries on.
+        //
+    }
+}
+
+IceInternal::HedgeTimerTask::HedgeTimerTask(const ProxyOutgoingAsyncBasePtr& outAsync) : _outAsync(outAsync)
+{
+}
+
+void
+IceInternal::HedgeTimerTask::runTimerTask()
+{
+    _outAsync->hedge();
+}
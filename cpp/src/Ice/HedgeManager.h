@@ -0,0 +1,156 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_HEDGE_MANAGER_H
+#define ICE_HEDGE_MANAGER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Time.h>
+#include <IceUtil/Timer.h>
+#include <Ice/HedgeManagerF.h>
+#include <Ice/OutgoingAsync.h>
+#include <Ice/ReferenceF.h>
+#include <Ice/EndpointIF.h>
+#include <Ice/PropertiesF.h>
+#include <Ice/RequestHandlerF.h>
+
+#include <map>
+
+namespace IceInternal
+{
+
+class ProxyOutgoingBase;
+
+//
+// The hedging policy of a communicator, configured with the
+// Ice.HedgePercentile and Ice.HedgeBudget properties.
+//
+// An idempotent two-way invocation on a proxy with several endpoints
+// or an indirect proxy is hedged if it doesn't get a reply within the
+// given percentile of the latency of the previous invocations of the
+// same operation: a copy of the request is sent to another endpoint or
+// replica and the first reply is kept. The budget is the number of
+// hedged requests allowed for 100 invocations.
+//
+class HedgeManager : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    HedgeManager(const Ice::PropertiesPtr&);
+
+    bool canHedge(const ReferencePtr&, Ice::OperationMode) const;
+
+    //
+    // Returns the delay after which an invocation of the operation is
+    // hedged, or IceUtil::Time() if there are not enough latency
+    // measurements yet. Each call also credits the budget.
+    //
+    IceUtil::Time getDelay(const std::string&);
+    void addLatency(const std::string&, const IceUtil::Time&);
+
+    //
+    // Returns the proxy for the hedged request, or null if there's no
+    // other endpoint than the one used by the invocation. Also used to
+    // retry a request rejected by an overloaded server.
+    //
+    Ice::ObjectPrx getProxy(const Ice::ObjectPrx&, const EndpointIPtr&) const;
+
+    //
+    // Takes a token from the budget, returns false if it's exhausted.
+    //
+    bool acquire();
+
+private:
+
+    struct Histogram
+    {
+        Histogram();
+
+        std::vector<int> buckets;
+        int count;
+    };
+
+    const int _percentile;
+    const int _budget;
+    int _tokens;
+    std::map<std::string, Histogram> _histograms;
+};
+
+//
+// The hedged request of an invocation, it sends a copy of the
+// invocation request. Once it gets a reply, the invocation request is
+// canceled and the invocation takes the reply over.
+//
+class HedgeRequest : public ProxyOutgoingAsyncBase
+{
+public:
+
+    HedgeRequest(const Ice::ObjectPrx&, const std::string&, Ice::OperationMode, const BasicStream&,
+                 const IceUtil::Time&);
+
+    void invoke(ProxyOutgoingBase*, const RequestHandlerPtr&);
+    void invoke(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual bool sent();
+
+    virtual AsyncStatus invokeRemote(const Ice::ConnectionIPtr&, bool, bool);
+    virtual AsyncStatus invokeCollocated(CollocatedRequestHandler*);
+
+    using ProxyOutgoingAsyncBase::completed;
+    virtual bool completed();
+
+    virtual BasicStream* getIs()
+    {
+        return &_is;
+    }
+
+    //
+    // Swaps the reply with the given stream, returns false if there's
+    // no reply.
+    //
+    bool takeReply(BasicStream&);
+
+    //
+    // Called once the invocation is completed, the request is canceled
+    // if it's still in progress.
+    //
+    void detach();
+
+    void replied();
+
+private:
+
+    void invoke();
+
+    IceUtil::Monitor<IceUtil::Mutex> _monitor;
+    ProxyOutgoingBase* _outgoing;
+    RequestHandlerPtr _outgoingHandler;
+    ProxyOutgoingAsyncBasePtr _outAsync;
+    bool _replied;
+    bool _canceling;
+};
+
+class HedgeTimerTask : public IceUtil::TimerTask
+{
+public:
+
+    HedgeTimerTask(const ProxyOutgoingAsyncBasePtr&);
+
+    virtual void runTimerTask();
+
+private:
+
+    const ProxyOutgoingAsyncBasePtr _outAsync;
+};
+
+}
+
+#endif
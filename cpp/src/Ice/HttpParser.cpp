@@ -680,6 +680,66 @@ IceInternal::HttpParser::getHeader(const string& name, string& value, bool toLow
     return false;
 }
 
+bool
+IceInternal::HttpParser::getHeaderTokens(const string& name, HeaderTokenSeq& tokens) const
+{
+    string value;
+    if(!getHeader(name, value, true))
+    {
+        return false;
+    }
+
+    //
+    // The value is a comma-separated list of tokens, each followed by
+    // optional parameters in the form "; name" or "; name=value". Quotes
+    // around values are removed by splitString. For example:
+    //
+    // permessage-deflate; client_max_window_bits, permessage-deflate
+    //
+    vector<string> elements;
+    if(!IceUtilInternal::splitString(value, ",", elements))
+    {
+        throw WebSocketException("invalid value `" + value + "' for " + name + " field");
+    }
+
+    tokens.clear();
+    for(vector<string>::const_iterator p = elements.begin(); p != elements.end(); ++p)
+    {
+        vector<string> params;
+        if(!IceUtilInternal::splitString(*p, ";", params) || params.empty())
+        {
+            throw WebSocketException("invalid value `" + value + "' for " + name + " field");
+        }
+
+        HeaderToken token;
+        token.name = IceUtilInternal::trim(params[0]);
+        if(token.name.empty())
+        {
+            throw WebSocketException("invalid value `" + value + "' for " + name + " field");
+        }
+
+        for(vector<string>::const_iterator q = params.begin() + 1; q != params.end(); ++q)
+        {
+            string paramName = IceUtilInternal::trim(*q);
+            string paramValue;
+            string::size_type pos = paramName.find('=');
+            if(pos != string::npos)
+            {
+                paramValue = IceUtilInternal::trim(paramName.substr(pos + 1));
+                paramName = IceUtilInternal::trim(paramName.substr(0, pos));
+            }
+
+            if(paramName.empty() || token.params.find(paramName) != token.params.end())
+            {
+                throw WebSocketException("invalid value `" + value + "' for " + name + " field");
+            }
+            token.params[paramName] = paramValue;
+        }
+        tokens.push_back(token);
+    }
+    return true;
+}
+
 map<string, string>
 IceInternal::HttpParser::getHeaders() const
 {
@@ -21,6 +21,17 @@ std::vector<unsigned char> calcSHA1(const std::vector<unsigned char>&);
 
 typedef std::map<std::string, std::pair<std::string, std::string> > HeaderFields;
 
+//
+// An element of a header field such as Sec-WebSocket-Extensions, that
+// is a token followed by optional semicolon-separated parameters.
+//
+struct HeaderToken
+{
+    std::string name;
+    std::map<std::string, std::string> params;
+};
+typedef std::vector<HeaderToken> HeaderTokenSeq;
+
 class WebSocketException
 {
 public:
@@ -57,6 +68,7 @@ public:
     std::string reason() const;
 
     bool getHeader(const std::string&, std::string&, bool) const;
+    bool getHeaderTokens(const std::string&, HeaderTokenSeq&) const;
 
     std::map<std::string, std::string> getHeaders() const;
 
@@ -15,6 +15,8 @@
 #include <Ice/ServantManager.h>
 #include <Ice/Object.h>
 #include <Ice/ConnectionI.h>
+#include <Ice/Deadline.h>
+#include <Ice/Tracer.h>
 #include <Ice/LocalException.h>
 #include <Ice/Instance.h>
 #include <Ice/Properties.h>
@@ -22,6 +24,7 @@
 #include <Ice/Protocol.h>
 #include <Ice/ReplyStatus.h>
 #include <Ice/ResponseHandler.h>
+#include <Ice/AdmissionControl.h>
 #include <IceUtil/StringUtil.h>
 #include <typeinfo>
 
@@ -40,6 +43,7 @@ extern bool ICE_UTIL_API printStackTraces;
 IceInternal::IncomingBase::IncomingBase(Instance* instance, ResponseHandler* responseHandler,
                                         Ice::Connection* connection, const ObjectAdapterPtr& adapter,
                                         bool response, Byte compress, Int requestId) :
+    _deadline(0),
     _response(response),
     _compress(compress),
     _os(instance, Ice::currentProtocolEncoding),
@@ -52,6 +56,7 @@ IceInternal::IncomingBase::IncomingBase(Instance* instance, ResponseHandler* res
 
 IceInternal::IncomingBase::IncomingBase(IncomingBase& in) :
     _current(in._current), // copy
+    _deadline(in._deadline),
     _os(in._os.instance(), Ice::currentProtocolEncoding),
     _interceptorAsyncCallbackQueue(in._interceptorAsyncCallbackQueue) // copy
 {
@@ -62,6 +67,7 @@ void
 IceInternal::IncomingBase::__adopt(IncomingBase& other)
 {
     _observer.adopt(other._observer);
+    _span.adopt(other._span);
 
     _servant = other._servant;
     other._servant = 0;
@@ -242,6 +248,7 @@ IceInternal::IncomingBase::__servantLocatorFinished(bool amd)
         }
 
         _observer.detach();
+        _span.finish();
         _responseHandler = 0;
     }
     catch(const std::exception& ex)
@@ -297,6 +304,7 @@ IceInternal::IncomingBase::__handleException(const std::exception& exc, bool amd
         {
             _observer.failed(rfe->ice_name());
         }
+        _span.failed();
 
         if(_response)
         {
@@ -353,6 +361,7 @@ IceInternal::IncomingBase::__handleException(const std::exception& exc, bool amd
         {
             _observer.failed(ex->ice_name());
         }
+        _span.failed();
 
         if(_response)
         {
@@ -360,7 +369,20 @@ IceInternal::IncomingBase::__handleException(const std::exception& exc, bool amd
             if(const UnknownLocalException* ule = dynamic_cast<const UnknownLocalException*>(&exc))
             {
                 _os.write(replyUnknownLocalException);
-                _os.write(ule->unknown, false);
+                if(ule->unknown == overloadedReason)
+                {
+                    //
+                    // Raised by a nested invocation, this request was
+                    // dispatched and must not be taken for a rejected one.
+                    //
+                    ostringstream str;
+                    str << *ule;
+                    _os.write(str.str(), false);
+                }
+                else
+                {
+                    _os.write(ule->unknown, false);
+                }
             }
             else if(const UnknownUserException* uue = dynamic_cast<const UnknownUserException*>(&exc))
             {
@@ -425,6 +447,7 @@ IceInternal::IncomingBase::__handleException(const std::exception& exc, bool amd
         {
             _observer.failed(typeid(exc).name());
         }
+        _span.failed();
 
         if(_response)
         {
@@ -444,6 +467,7 @@ IceInternal::IncomingBase::__handleException(const std::exception& exc, bool amd
     }
 
     _observer.detach();
+    _span.finish();
     _responseHandler = 0;
 }
 
@@ -461,6 +485,7 @@ IceInternal::IncomingBase::__handleException(bool amd)
     {
         _observer.failed("unknown");
     }
+    _span.failed();
 
     if(_response)
     {
@@ -477,6 +502,7 @@ IceInternal::IncomingBase::__handleException(bool amd)
     }
 
     _observer.detach();
+    _span.finish();
     _responseHandler = 0;
 }
 
@@ -559,7 +585,8 @@ IceInternal::Incoming::setActive(IncomingAsync& cb)
 }
 
 void
-IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStream* stream)
+IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStream* stream,
+                              const IceUtil::Time& received)
 {
     _is = stream;
 
@@ -602,6 +629,18 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStre
         _is->read(pr.second);
         _current.ctx.insert(_current.ctx.end(), pr);
     }
+    if(!_current.ctx.empty())
+    {
+        _deadline = readRequestDeadline(_current.ctx, received);
+        _span.startDispatch(_os.instance(), _current.operation, _current.ctx, received);
+    }
+
+    //
+    // Invocations made from this thread during the dispatch propagate
+    // the deadline and the trace.
+    //
+    DeadlineScope deadlineScope(&_deadline);
+    TraceScope traceScope(_span);
 
     const CommunicatorObserverPtr& obsv = _is->instance()->initializationData().observer;
     if(obsv)
@@ -614,6 +653,44 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStre
         _observer.attach(obsv->getDispatchObserver(_current, static_cast<Int>(_is->i - start + sz)));
     }
 
+    if(_deadline > 0 && _deadline <= deadlineNow())
+    {
+        //
+        // The caller already gave up on the request, drop it without
+        // dispatching it. This is expected when the server is
+        // overloaded so it's only reported with Ice.Warn.Dispatch > 1.
+        //
+        _is->skipEncaps(); // Required for batch requests.
+
+        InvocationTimeoutException ex(__FILE__, __LINE__);
+        if(_os.instance()->initializationData().properties->getPropertyAsIntWithDefault("Ice.Warn.Dispatch", 1) > 1)
+        {
+            __warning("request dropped, its deadline expired");
+        }
+
+        _observer.failed(ex.ice_name());
+        _span.failed();
+
+        if(_response)
+        {
+            ostringstream str;
+            str << ex;
+            _os.write(replyUnknownLocalException);
+            _os.write(str.str(), false);
+            _observer.reply(static_cast<Int>(_os.b.size() - headerSize - 4));
+            _responseHandler->sendResponse(_current.requestId, &_os, _compress, false);
+        }
+        else
+        {
+            _responseHandler->sendNoResponse();
+        }
+
+        _observer.detach();
+        _span.finish();
+        _responseHandler = 0;
+        return;
+    }
+
     //
     // Don't put the code above into the try block below. Exceptions
     // in the code above are considered fatal, and must propagate to
@@ -658,6 +735,7 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStre
                     }
 
                     _observer.detach();
+                    _span.finish();
                     _responseHandler = 0;
                     return;
                 }
@@ -749,6 +827,7 @@ IceInternal::Incoming::invoke(const ServantManagerPtr& servantManager, BasicStre
     }
 
     _observer.detach();
+    _span.finish();
     _responseHandler = 0;
 }
 
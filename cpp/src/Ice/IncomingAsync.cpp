@@ -209,6 +209,7 @@ IceInternal::IncomingAsync::__response()
         }
 
         _observer.detach();
+        _span.finish();
         _responseHandler = 0;
     }
     catch(const LocalException& ex)
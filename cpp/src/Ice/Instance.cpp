@@ -33,6 +33,9 @@
 #include <Ice/WSEndpoint.h>
 #include <Ice/RequestHandlerFactory.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/HedgeManager.h>
+#include <Ice/Tracer.h>
+#include <Ice/FlightRecorderI.h>
 #include <Ice/DynamicLibrary.h>
 #include <Ice/PluginManagerI.h>
 #include <Ice/Initialize.h>
@@ -1232,7 +1235,8 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 #endif
             if(!logfile.empty())
             {
-                _initData.logger = new LoggerI(_initData.properties->getProperty("Ice.ProgramName"), logfile);
+                _initData.logger = new LoggerI(_initData.properties->getProperty("Ice.ProgramName"), logfile, true, 0,
+                                               _initData.properties);
             }
             else
             {
@@ -1240,7 +1244,7 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
                 if(LoggerIPtr::dynamicCast(_initData.logger))
                 {
                     _initData.logger = new LoggerI(_initData.properties->getProperty("Ice.ProgramName"), "",
-                                                   logStdErrConvert, _stringConverter);
+                                                   logStdErrConvert, _stringConverter, _initData.properties);
                 }
             }
         }
@@ -1305,6 +1309,19 @@ IceInternal::Instance::Instance(const CommunicatorPtr& communicator, const Initi
 
         const_cast<bool&>(_collectObjects) = _initData.properties->getPropertyAsInt("Ice.CollectObjects") > 0;
 
+        const_cast<HedgeManagerPtr&>(_hedgeManager) = new HedgeManager(_initData.properties);
+
+        if(_initData.properties->getPropertyAsInt("Ice.Tracing.Enabled") > 0 ||
+           _initData.properties->getPropertyAsInt("Ice.Tracing.Sample") > 0)
+        {
+            const_cast<TracerPtr&>(_tracer) = new Tracer(_initData.properties, _initData.logger);
+        }
+
+        if(_initData.properties->getPropertyAsInt("Ice.FlightRecorder.Size") > 0)
+        {
+            const_cast<FlightRecorderIPtr&>(_flightRecorder) = new FlightRecorderI(_initData.properties);
+        }
+
         //
         // Client ACM enabled by default. Server ACM disabled by default.
         //
@@ -1539,6 +1556,16 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
                 propsAdmin->addUpdateCallback(observer->getFacet());
             }
         }
+
+        //
+        // FlightRecorder facet
+        //
+        const string flightRecorderFacetName = "FlightRecorder";
+        if(_flightRecorder &&
+           (_adminFacetFilter.empty() || _adminFacetFilter.find(flightRecorderFacetName) != _adminFacetFilter.end()))
+        {
+            _adminFacets.insert(make_pair(flightRecorderFacetName, _flightRecorder));
+        }
     }
 
     //
@@ -1572,6 +1599,11 @@ IceInternal::Instance::finishSetup(int& argc, char* argv[], const Ice::Communica
         throw;
     }
 
+    if(_tracer)
+    {
+        _tracer->start(_timer);
+    }
+
     try
     {
         _endpointHostResolver = new EndpointHostResolver(this);
@@ -1751,6 +1783,10 @@ IceInternal::Instance::destroy()
     {
         _endpointHostResolver->destroy();
     }
+    if(_tracer)
+    {
+        _tracer->destroy(); // Writes the remaining spans.
+    }
     if(_timer)
     {
         _timer->destroy();
@@ -1816,6 +1852,20 @@ IceInternal::Instance::destroy()
         _pluginManager->destroy();
     }
 
+    //
+    // Write the messages queued by the asynchronous logger, the messages
+    // logged from now on are written synchronously.
+    //
+    LoggerIPtr loggerI = LoggerIPtr::dynamicCast(_initData.logger);
+    if(!loggerI && logger)
+    {
+        loggerI = LoggerIPtr::dynamicCast(logger->getLocalLogger());
+    }
+    if(loggerI)
+    {
+        loggerI->destroy();
+    }
+
     {
         Lock sync(*this);
 
@@ -33,6 +33,8 @@
 #include <Ice/EndpointFactoryManagerF.h>
 #include <Ice/IPEndpointIF.h>
 #include <Ice/RetryQueueF.h>
+#include <Ice/HedgeManagerF.h>
+#include <Ice/TraceSpan.h>
 #include <Ice/DynamicLibraryF.h>
 #include <Ice/PluginF.h>
 #include <Ice/NetworkF.h>
@@ -60,6 +62,9 @@ typedef IceUtil::Handle<Timer> TimerPtr;
 class MetricsAdminI;
 typedef IceUtil::Handle<MetricsAdminI> MetricsAdminIPtr;
 
+class FlightRecorderI;
+typedef IceUtil::Handle<FlightRecorderI> FlightRecorderIPtr;
+
 class RequestHandlerFactory;
 typedef IceUtil::Handle<RequestHandlerFactory> RequestHandlerFactoryPtr;
 
@@ -111,6 +116,9 @@ public:
     size_t messageSizeMax() const { return _messageSizeMax; }
     size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
     bool collectObjects() const { return _collectObjects; }
+    HedgeManagerPtr hedgeManager() const { return _hedgeManager; }
+    const TracerPtr& tracer() const { return _tracer; }
+    const FlightRecorderIPtr& flightRecorder() const { return _flightRecorder; }
     const ACMConfig& clientACM() const;
     const ACMConfig& serverACM() const;
     Ice::Identity stringToIdentity(const std::string&) const;
@@ -171,6 +179,9 @@ private:
     const size_t _messageSizeMax; // Immutable, not reset by destroy().
     const size_t _batchAutoFlushSize; // Immutable, not reset by destroy().
     const bool _collectObjects; // Immutable, not reset by destroy().
+    const HedgeManagerPtr _hedgeManager; // Immutable, not reset by destroy().
+    const TracerPtr _tracer; // Immutable, not reset by destroy(), null if tracing is disabled.
+    const FlightRecorderIPtr _flightRecorder; // Immutable, not reset by destroy(), null if disabled.
     ACMConfig _clientACM;
     ACMConfig _serverACM;
     RouterManagerPtr _routerManager;
@@ -9,6 +9,7 @@
 
 #include <Ice/InstrumentationI.h>
 
+#include <Ice/Reference.h>
 #include <Ice/Connection.h>
 #include <Ice/Endpoint.h>
 #include <Ice/ObjectAdapter.h>
@@ -271,14 +272,18 @@ public:
         return _current.adapter->getName();
     }
 
-    ConnectionInfoPtr
+    const ConnectionInfoPtr&
     getConnectionInfo() const
     {
-        if(_current.con)
+        //
+        // Cached, each connection attribute would otherwise lock the
+        // connection to get its information.
+        //
+        if(_current.con && !_connectionInfo)
         {
-            return _current.con->getInfo();
+            _connectionInfo = _current.con->getInfo();
         }
-        return 0;
+        return _connectionInfo;
     }
 
     EndpointPtr
@@ -324,6 +329,7 @@ private:
     const Current& _current;
     const int _size;
     mutable string _id;
+    mutable ConnectionInfoPtr _connectionInfo;
     mutable EndpointInfoPtr _endpointInfo;
 };
 
@@ -354,8 +360,9 @@ public:
     };
     static Attributes attributes;
     
-    InvocationHelper(const ObjectPrx& proxy, const string& op, const Context& ctx = emptyCtx) :
-        _proxy(proxy), _operation(op), _context(ctx)
+    InvocationHelper(const ObjectPrx& proxy, const string& op, const Context& ctx = emptyCtx,
+                     InvocationIdCache* ids = 0) :
+        _proxy(proxy), _operation(op), _context(ctx), _ids(ids)
     {
     }
 
@@ -416,25 +423,14 @@ public:
     {
         if(_id.empty())
         {
-            ostringstream os;
             if(_proxy)
             {
-                try
-                {
-                    os << _proxy->ice_endpoints(Ice::EndpointSeq()) << " [" << _operation << ']';
-                }
-                catch(const Exception&)
-                {
-                    // Either a fixed proxy or the communicator is destroyed.
-                    os << _proxy->ice_getCommunicator()->identityToString(_proxy->ice_getIdentity());
-                    os << " [" << _operation << ']';
-                }
+                _id = (_ids ? _ids->getProxyId(_proxy) : getProxyId(_proxy)) + " [" + _operation + ']';
             }
             else
             {
-                os << _operation;
+                _id = _operation;
             }
-            _id = os.str();
         }
         return _id;
     }
@@ -471,11 +467,28 @@ public:
         return _operation;
     }
 
+    static string
+    getProxyId(const ObjectPrx& proxy)
+    {
+        try
+        {
+            ostringstream os;
+            os << proxy->ice_endpoints(Ice::EndpointSeq());
+            return os.str();
+        }
+        catch(const Exception&)
+        {
+            // Either a fixed proxy or the communicator is destroyed.
+            return proxy->ice_getCommunicator()->identityToString(proxy->ice_getIdentity());
+        }
+    }
+
 private:
 
     const ObjectPrx& _proxy;
     const string& _operation;
     const Context& _context;
+    InvocationIdCache* _ids;
     mutable string _id;
 };
 
@@ -838,6 +851,17 @@ InvocationObserverI::retried()
     }
 }
 
+void
+InvocationObserverI::hedged()
+{
+    forEach(inc(&InvocationMetrics::hedged));
+    HedgedInvocationObserverPtr delegate = HedgedInvocationObserverPtr::dynamicCast(_delegate);
+    if(delegate)
+    {
+        delegate->hedged();
+    }
+}
+
 void
 InvocationObserverI::userException()
 {
@@ -1028,7 +1052,7 @@ CommunicatorObserverI::getInvocationObserver(const ObjectPrx& proxy, const strin
             {
                 delegate = _delegate->getInvocationObserver(proxy, op, ctx);
             }
-            return _invocations.getObserverWithDelegate(InvocationHelper(proxy, op, ctx), delegate);
+            return _invocations.getObserverWithDelegate(InvocationHelper(proxy, op, ctx, &_invocationIds), delegate);
         }
         catch(const exception& ex)
         {
@@ -1079,5 +1103,42 @@ CommunicatorObserverI::destroy()
     _connects.destroy();
     _endpointLookups.destroy();
 
+    _invocationIds.clear();
+
     _metrics->destroy();
 }
+
+string
+IceInternal::InvocationIdCache::getProxyId(const ObjectPrx& proxy)
+{
+    const Reference* ref = proxy->__reference().get();
+    Shard& shard = _shards[(reinterpret_cast<size_t>(ref) / sizeof(void*)) % ShardCount];
+    {
+        IceUtil::Mutex::Lock sync(shard);
+        map<const Reference*, pair<ReferencePtr, string> >::const_iterator p = shard.ids.find(ref);
+        if(p != shard.ids.end())
+        {
+            return p->second.second;
+        }
+    }
+
+    string id = InvocationHelper::getProxyId(proxy);
+
+    IceUtil::Mutex::Lock sync(shard);
+    if(shard.ids.size() >= MaxShardSize)
+    {
+        shard.ids.clear();
+    }
+    shard.ids.insert(make_pair(ref, make_pair(proxy->__reference(), id)));
+    return id;
+}
+
+void
+IceInternal::InvocationIdCache::clear()
+{
+    for(int i = 0; i < ShardCount; ++i)
+    {
+        IceUtil::Mutex::Lock sync(_shards[i]);
+        _shards[i].ids.clear();
+    }
+}
@@ -12,6 +12,7 @@
 
 #include <Ice/MetricsObserverI.h>
 #include <Ice/Connection.h>
+#include <Ice/ReferenceF.h>
 
 namespace IceInternal
 {
@@ -193,11 +194,13 @@ public:
 };
 
 class InvocationObserverI : public ObserverWithDelegateT<IceMX::InvocationMetrics, 
-                                                         Ice::Instrumentation::InvocationObserver>
+                                                         Ice::Instrumentation::InvocationObserver>,
+                            public Ice::Instrumentation::HedgedInvocationObserver
 {
 public:
 
     virtual void retried();
+    virtual void hedged();
 
     virtual void userException();
 
@@ -210,6 +213,33 @@ public:
 
 typedef ObserverWithDelegateT<IceMX::Metrics, Ice::Instrumentation::Observer> ObserverI;
 
+//
+// The invocation metrics id is the stringified proxy without its
+// endpoints, which is too costly to compute for each invocation. It's
+// cached by proxy reference, the references are spread over shards so
+// that invocations on different proxies don't contend. A shard is
+// cleared once it's full.
+//
+class InvocationIdCache
+{
+public:
+
+    std::string getProxyId(const Ice::ObjectPrx&);
+
+    void clear();
+
+private:
+
+    struct Shard : public IceUtil::Mutex
+    {
+        std::map<const Reference*, std::pair<ReferencePtr, std::string> > ids;
+    };
+
+    enum { ShardCount = 16, MaxShardSize = 128 };
+
+    Shard _shards[ShardCount];
+};
+
 class ICE_API CommunicatorObserverI : public Ice::Instrumentation::CommunicatorObserver
 {
 public:
@@ -254,6 +284,8 @@ private:
     ObserverFactoryWithDelegateT<ThreadObserverI> _threads;
     ObserverFactoryWithDelegateT<ObserverI> _connects;
     ObserverFactoryWithDelegateT<ObserverI> _endpointLookups;
+
+    InvocationIdCache _invocationIds;
 };
 typedef IceUtil::Handle<CommunicatorObserverI> CommunicatorObserverIPtr;
 
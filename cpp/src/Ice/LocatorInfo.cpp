@@ -18,6 +18,7 @@
 #include <Ice/Reference.h>
 #include <Ice/Functional.h>
 #include <Ice/Properties.h>
+#include <IceUtil/Random.h>
 #include <iterator>
 
 using namespace std;
@@ -87,6 +88,8 @@ public:
 
 IceInternal::LocatorManager::LocatorManager(const Ice::PropertiesPtr& properties) :
     _background(properties->getPropertyAsInt("Ice.BackgroundLocatorCacheUpdates") > 0),
+    _refreshAhead(max(0, min(99, properties->getPropertyAsInt("Ice.LocatorCacheRefreshAhead")))),
+    _jitter(max(0, min(99, properties->getPropertyAsInt("Ice.LocatorCacheJitter")))),
     _tableHint(_table.end())
 {
 }
@@ -148,7 +151,7 @@ IceInternal::LocatorManager::get(const LocatorPrx& loc)
         {
             t = _locatorTables.insert(_locatorTables.begin(),
                                       pair<const pair<Identity, EncodingVersion>, LocatorTablePtr>(
-                                          locatorKey, new LocatorTable()));
+                                          locatorKey, new LocatorTable(_refreshAhead, _jitter)));
         }
 
         _tableHint = _table.insert(_tableHint,
@@ -164,7 +167,9 @@ IceInternal::LocatorManager::get(const LocatorPrx& loc)
     return _tableHint->second;
 }
 
-IceInternal::LocatorTable::LocatorTable()
+IceInternal::LocatorTable::LocatorTable(int refreshAhead, int jitter) :
+    _refreshAhead(refreshAhead),
+    _jitter(jitter)
 {
 }
 
@@ -178,8 +183,10 @@ IceInternal::LocatorTable::clear()
 }
 
 bool
-IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints)
+IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, vector<EndpointIPtr>& endpoints,
+                                               bool& refresh)
 {
+    refresh = false;
     if(ttl == 0) // No locator cache.
     {
         return false;
@@ -187,12 +194,12 @@ IceInternal::LocatorTable::getAdapterEndpoints(const string& adapter, int ttl, v
 
     IceUtil::Mutex::Lock sync(*this);
     
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, Entry<vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
     
     if(p != _adapterEndpointsMap.end())
     {
-        endpoints = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        endpoints = p->second.value;
+        return checkTTL(p->second, ttl, refresh);
     }
     return false;
 }
@@ -202,16 +209,15 @@ IceInternal::LocatorTable::addAdapterEndpoints(const string& adapter, const vect
 {
     IceUtil::Mutex::Lock sync(*this);
     
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, Entry<vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
     
     if(p != _adapterEndpointsMap.end())
     {
-        p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints);
+        p->second = Entry<vector<EndpointIPtr> >(endpoints, newJitter());
     }
     else
     {
-        _adapterEndpointsMap.insert(
-            make_pair(adapter, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), endpoints)));
+        _adapterEndpointsMap.insert(make_pair(adapter, Entry<vector<EndpointIPtr> >(endpoints, newJitter())));
     }
 }
 
@@ -220,13 +226,13 @@ IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 {
     IceUtil::Mutex::Lock sync(*this);
     
-    map<string, pair<IceUtil::Time, vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
+    map<string, Entry<vector<EndpointIPtr> > >::iterator p = _adapterEndpointsMap.find(adapter);
     if(p == _adapterEndpointsMap.end())
     {
         return vector<EndpointIPtr>();
     }
 
-    vector<EndpointIPtr> endpoints = p->second.second;
+    vector<EndpointIPtr> endpoints = p->second.value;
 
     _adapterEndpointsMap.erase(p);
     
@@ -234,8 +240,9 @@ IceInternal::LocatorTable::removeAdapterEndpoints(const string& adapter)
 }
 
 bool 
-IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref)
+IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, ReferencePtr& ref, bool& refresh)
 {
+    refresh = false;
     if(ttl == 0) // No locator cache
     {
         return false;
@@ -243,12 +250,12 @@ IceInternal::LocatorTable::getObjectReference(const Identity& id, int ttl, Refer
 
     IceUtil::Mutex::Lock sync(*this);
     
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, Entry<ReferencePtr> >::iterator p = _objectMap.find(id);
     
     if(p != _objectMap.end())
     {
-        ref = p->second.second;
-        return checkTTL(p->second.first, ttl);
+        ref = p->second.value;
+        return checkTTL(p->second, ttl, refresh);
     }
     return false;
 }
@@ -258,15 +265,15 @@ IceInternal::LocatorTable::addObjectReference(const Identity& id, const Referenc
 {
     IceUtil::Mutex::Lock sync(*this);
 
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, Entry<ReferencePtr> >::iterator p = _objectMap.find(id);
     
     if(p != _objectMap.end())
     {
-        p->second = make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref);
+        p->second = Entry<ReferencePtr>(ref, newJitter());
     }
     else
     {
-        _objectMap.insert(make_pair(id, make_pair(IceUtil::Time::now(IceUtil::Time::Monotonic), ref)));
+        _objectMap.insert(make_pair(id, Entry<ReferencePtr>(ref, newJitter())));
     }
 }
 
@@ -275,29 +282,49 @@ IceInternal::LocatorTable::removeObjectReference(const Identity& id)
 {
     IceUtil::Mutex::Lock sync(*this);
     
-    map<Identity, pair<IceUtil::Time, ReferencePtr> >::iterator p = _objectMap.find(id);
+    map<Identity, Entry<ReferencePtr> >::iterator p = _objectMap.find(id);
     if(p == _objectMap.end())
     {
         return 0;
     }
 
-    ReferencePtr ref = p->second.second;
+    ReferencePtr ref = p->second.value;
     _objectMap.erase(p);
     return ref;
 }
 
-bool
-IceInternal::LocatorTable::checkTTL(const IceUtil::Time& time, int ttl) const
+template<typename T> bool
+IceInternal::LocatorTable::checkTTL(Entry<T>& entry, int ttl, bool& refresh) const
 {
     assert(ttl != 0);
     if (ttl < 0) // TTL = infinite
     {
         return true;
     }
-    else
+
+    IceUtil::Time timeout = IceUtil::Time::seconds(ttl) * (1.0 - entry.jitter);
+    IceUtil::Time age = IceUtil::Time::now(IceUtil::Time::Monotonic) - entry.time;
+    if(age > timeout)
+    {
+        return false;
+    }
+
+    //
+    // Only the first lookup past the refresh-ahead delay requests a
+    // refresh. If it fails, the entry is kept until it expires.
+    //
+    if(_refreshAhead > 0 && !entry.refreshing && age >= timeout * (_refreshAhead / 100.0))
     {
-        return IceUtil::Time::now(IceUtil::Time::Monotonic) - time <= IceUtil::Time::seconds(ttl);
+        entry.refreshing = true;
+        refresh = true;
     }
+    return true;
+}
+
+double
+IceInternal::LocatorTable::newJitter() const
+{
+    return _jitter > 0 ? IceUtilInternal::random(_jitter * 10 + 1) / 1000.0 : 0.0;
 }
 
 void
@@ -563,9 +590,10 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref, const ReferenceP
 {
     assert(ref->isIndirect());
     vector<EndpointIPtr> endpoints;
+    bool refresh;
     if(!ref->isWellKnown())
     {
-        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, refresh))
         {
             if(_background && !endpoints.empty())
             {
@@ -576,11 +604,15 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref, const ReferenceP
                 return getAdapterRequest(ref)->getEndpoints(ref, wellKnownRef, ttl, cached);
             }
         }
+        else if(refresh)
+        {
+            getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
+        }
     }
     else
     {
         ReferencePtr r;
-        if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        if(!_table->getObjectReference(ref->getIdentity(), ttl, r, refresh))
         {
             if(_background && r)
             {
@@ -591,6 +623,10 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref, const ReferenceP
                 return getObjectRequest(ref)->getEndpoints(ref, 0, ttl, cached);
             }
         }
+        else if(refresh)
+        {
+            getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
+        }
 
         if(!r->isIndirect())
         {
@@ -619,9 +655,10 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
 {
     assert(ref->isIndirect());
     vector<EndpointIPtr> endpoints;
+    bool refresh;
     if(!ref->isWellKnown())
     {
-        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints))
+        if(!_table->getAdapterEndpoints(ref->getAdapterId(), ttl, endpoints, refresh))
         {
             if(_background && !endpoints.empty())
             {
@@ -633,11 +670,15 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                 return;
             }
         }
+        else if(refresh)
+        {
+            getAdapterRequest(ref)->addCallback(ref, wellKnownRef, ttl, 0);
+        }
     }
     else
     {
         ReferencePtr r;
-        if(!_table->getObjectReference(ref->getIdentity(), ttl, r))
+        if(!_table->getObjectReference(ref->getIdentity(), ttl, r, refresh))
         {
             if(_background && r)
             {
@@ -649,6 +690,10 @@ IceInternal::LocatorInfo::getEndpoints(const ReferencePtr& ref,
                 return;
             }
         }
+        else if(refresh)
+        {
+            getObjectRequest(ref)->addCallback(ref, 0, ttl, 0);
+        }
 
         if(!r->isIndirect())
         {
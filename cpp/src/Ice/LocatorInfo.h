@@ -44,6 +44,8 @@ public:
 private:
 
     const bool _background;
+    const int _refreshAhead;
+    const int _jitter;
 
     std::map<Ice::LocatorPrx, LocatorInfoPtr> _table;
     std::map<Ice::LocatorPrx, LocatorInfoPtr>::iterator _tableHint;
@@ -51,28 +53,56 @@ private:
     std::map<std::pair<Ice::Identity, Ice::EncodingVersion>, LocatorTablePtr> _locatorTables;
 };
 
+//
+// The locator cache. An entry is valid for the locator cache timeout
+// of the proxy looking it up, shortened by a random amount of up to
+// Ice.LocatorCacheJitter percent of the timeout so that the entries
+// cached at the same time don't all expire together.
+//
+// If Ice.LocatorCacheRefreshAhead is set, an entry older than this
+// percentage of its timeout is still returned but the first lookup
+// also requests a refresh, the entry is then usually updated before
+// it expires.
+//
 class LocatorTable : public IceUtil::Shared, public IceUtil::Mutex
 {
 public:
 
-    LocatorTable();
+    LocatorTable(int, int);
 
     void clear();
     
-    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&);
+    bool getAdapterEndpoints(const std::string&, int, ::std::vector<EndpointIPtr>&, bool&);
     void addAdapterEndpoints(const std::string&, const ::std::vector<EndpointIPtr>&);
     ::std::vector<EndpointIPtr> removeAdapterEndpoints(const std::string&);
 
-    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&);
+    bool getObjectReference(const Ice::Identity&, int, ReferencePtr&, bool&);
     void addObjectReference(const Ice::Identity&, const ReferencePtr&);
     ReferencePtr removeObjectReference(const Ice::Identity&);
     
 private:
 
-    bool checkTTL(const IceUtil::Time&, int) const;
+    template<typename T> struct Entry
+    {
+        Entry(const T& v, double j) :
+            time(IceUtil::Time::now(IceUtil::Time::Monotonic)), jitter(j), refreshing(false), value(v)
+        {
+        }
+
+        IceUtil::Time time;
+        double jitter;
+        bool refreshing;
+        T value;
+    };
+
+    template<typename T> bool checkTTL(Entry<T>&, int, bool&) const;
+    double newJitter() const;
+
+    const int _refreshAhead;
+    const int _jitter;
 
-    std::map<std::string, std::pair<IceUtil::Time, std::vector<EndpointIPtr> > > _adapterEndpointsMap;
-    std::map<Ice::Identity, std::pair<IceUtil::Time, ReferencePtr> > _objectMap;
+    std::map<std::string, Entry<std::vector<EndpointIPtr> > > _adapterEndpointsMap;
+    std::map<Ice::Identity, Entry<ReferencePtr> > _objectMap;
 };
 
 class LocatorInfo : public IceUtil::Shared, public IceUtil::Mutex
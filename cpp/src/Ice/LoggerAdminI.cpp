@@ -144,7 +144,7 @@ public:
    
     virtual void destroy();
 
-    const LoggerPtr& getLocalLogger() const
+    virtual const LoggerPtr& getLocalLogger() const
     {
         return _localLogger;
     }
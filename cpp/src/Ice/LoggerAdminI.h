@@ -30,6 +30,11 @@ public:
     //
     virtual Ice::ObjectPtr getFacet() const = 0;
 
+    //
+    // Return the logger to which this logger forwards the log messages
+    //
+    virtual const Ice::LoggerPtr& getLocalLogger() const = 0;
+
     //
     // Destroy this logger, in particular join any thread
     // that this logger may have started
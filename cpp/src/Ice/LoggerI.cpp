@@ -9,20 +9,33 @@
 
 #include <IceUtil/Time.h>
 #include <Ice/LoggerI.h>
+#include <Ice/Properties.h>
 #include <IceUtil/Mutex.h>
 #include <IceUtil/MutexPtrLock.h>
 
 #ifdef _WIN32
 #  include <IceUtil/StringUtil.h>
 #  include <IceUtil/ScopedArray.h>
+#  include <io.h>
+#else
+#  include <unistd.h>
 #endif
 
 #include <Ice/LocalException.h>
 
+#include <algorithm>
+#include <sstream>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+#if defined(_WIN32)
+extern "C" void WINAPI iceLogBufferThreadDestructor(void*);
+#else
+extern "C" void iceLogBufferThreadDestructor(void*);
+#endif
+
 namespace
 {
 
@@ -46,10 +59,397 @@ public:
 
 Init init;
 
+bool
+logged(const LogBuffer::Entry& lhs, const LogBuffer::Entry& rhs)
+{
+    //
+    // The sequence numbers wrap around.
+    //
+    return static_cast<int>(lhs.sequence - rhs.sequence) < 0;
+}
+
+}
+
+extern "C" void
+#if defined(_WIN32)
+WINAPI
+#endif
+iceLogBufferThreadDestructor(void* p)
+{
+    //
+    // The buffer is released by the writer once it's drained.
+    //
+    if(p)
+    {
+        static_cast<LogBuffer*>(p)->orphaned();
+    }
+}
+
+IceInternal::LogBuffer::LogBuffer(size_t size) :
+    _mask(static_cast<unsigned int>(size - 1)),
+    _head(0),
+    _tail(0),
+    _orphaned(0)
+{
+    assert((size & (size - 1)) == 0);
+    _entries.resize(size);
+}
+
+bool
+IceInternal::LogBuffer::push(unsigned int sequence, const string& message)
+{
+    unsigned int head = static_cast<unsigned int>(_head.load());
+    if(head - static_cast<unsigned int>(_tail.load()) > _mask)
+    {
+        return false;
+    }
+    Entry& entry = _entries[head & _mask];
+    entry.sequence = sequence;
+    entry.message = message;
+    _head.fetch_add(1); // Publishes the entry.
+    return true;
+}
+
+void
+IceInternal::LogBuffer::drain(vector<Entry>& entries)
+{
+    unsigned int tail = static_cast<unsigned int>(_tail.load());
+    unsigned int head = static_cast<unsigned int>(_head.load());
+    for(; tail != head; ++tail)
+    {
+        Entry& entry = _entries[tail & _mask];
+        entries.push_back(Entry());
+        entries.back().sequence = entry.sequence;
+        entries.back().message.swap(entry.message);
+    }
+    _tail.exchange(static_cast<int>(tail)); // Releases the slots.
+}
+
+bool
+IceInternal::LogBuffer::isFilling() const
+{
+    return static_cast<unsigned int>(_head.load()) - static_cast<unsigned int>(_tail.load()) > _mask / 2;
+}
+
+void
+IceInternal::LogBuffer::orphaned()
+{
+    _orphaned.exchange(1);
+}
+
+bool
+IceInternal::LogBuffer::isOrphaned() const
+{
+    return _orphaned.load() != 0;
+}
+
+IceInternal::AsyncLogWriter::AsyncLogWriter(const PropertiesPtr& properties, const string& file) :
+    IceUtil::Thread("Ice.Logger"),
+    _file(file),
+    _bufferSize(static_cast<size_t>(max(properties->getPropertyAsIntWithDefault("Ice.Logger.BufferSize", 1024),
+                                        16))),
+    _flushInterval(IceUtil::Time::milliSeconds(
+                       max(properties->getPropertyAsIntWithDefault("Ice.Logger.FlushInterval", 100), 1))),
+    _fsync(properties->getPropertyAsInt("Ice.Logger.Fsync") > 0),
+    _maxSize(max(properties->getPropertyAsInt("Ice.LogFile.MaxSize"), 0)),
+    _rotateInterval(IceUtil::Time::seconds(max(properties->getPropertyAsInt("Ice.LogFile.RotateInterval"), 0))),
+    _maxFiles(max(properties->getPropertyAsIntWithDefault("Ice.LogFile.MaxFiles", 5), 1)),
+    _sequence(0),
+    _dropped(0),
+    _wakeup(0),
+    _destroyed(0),
+    _keyInitialized(false),
+    _out(stderr),
+    _size(0),
+    _opened(IceUtil::Time::now(IceUtil::Time::Monotonic))
+{
+    size_t bufferSize = 1;
+    while(bufferSize < _bufferSize)
+    {
+        bufferSize <<= 1;
+    }
+    const_cast<size_t&>(_bufferSize) = bufferSize;
+
+    if(!_file.empty())
+    {
+        _out = IceUtilInternal::fopen(_file, "a");
+        if(!_out)
+        {
+            throw InitializationException(__FILE__, __LINE__, "FileLogger: cannot open " + _file);
+        }
+        fseek(_out, 0, SEEK_END);
+        _size = static_cast<Long>(ftell(_out));
+    }
+
+#if !defined(ICE_OS_WINRT)
+#   if defined(_WIN32)
+    _key = FlsAlloc(&iceLogBufferThreadDestructor);
+    _keyInitialized = _key != FLS_OUT_OF_INDEXES;
+#   else
+    _keyInitialized = pthread_key_create(&_key, &iceLogBufferThreadDestructor) == 0;
+#   endif
+#endif
+    if(!_keyInitialized)
+    {
+        _sharedBuffer = new LogBuffer(_bufferSize);
+        _buffers.push_back(_sharedBuffer);
+    }
+}
+
+IceInternal::AsyncLogWriter::~AsyncLogWriter()
+{
+    if(_keyInitialized)
+    {
+#if defined(_WIN32)
+        FlsFree(_key);
+#else
+        pthread_key_delete(_key);
+#endif
+    }
+    if(_out && _out != stderr)
+    {
+        fclose(_out);
+    }
+}
+
+void
+IceInternal::AsyncLogWriter::write(const string& message)
+{
+    unsigned int sequence = static_cast<unsigned int>(_sequence.fetch_add(1));
+    bool pushed;
+    bool filling;
+    if(_keyInitialized)
+    {
+        LogBuffer* buffer = getBuffer();
+        pushed = buffer->push(sequence, message);
+        filling = buffer->isFilling();
+    }
+    else
+    {
+        IceUtil::Mutex::Lock sync(_buffersMutex);
+        pushed = _sharedBuffer->push(sequence, message);
+        filling = _sharedBuffer->isFilling();
+    }
+
+    if(!pushed)
+    {
+        _dropped.fetch_add(1);
+    }
+
+    if(_destroyed.load() != 0)
+    {
+        //
+        // The writer thread is gone, the caller writes the message.
+        //
+        flush();
+    }
+    else if((filling || !pushed) && _wakeup.exchange(1) == 0)
+    {
+        //
+        // The writer thread only holds the monitor to wait, waking it
+        // up doesn't block.
+        //
+        Lock sync(*this);
+        notify();
+    }
+}
+
+void
+IceInternal::AsyncLogWriter::destroy()
+{
+    {
+        Lock sync(*this);
+        if(_destroyed.exchange(1) != 0)
+        {
+            return;
+        }
+        notify();
+    }
+    getThreadControl().join();
+}
+
+void
+IceInternal::AsyncLogWriter::run()
+{
+    while(true)
+    {
+        bool destroyed;
+        {
+            Lock sync(*this);
+            if(_wakeup.exchange(0) == 0 && _destroyed.load() == 0)
+            {
+                timedWait(_flushInterval);
+                _wakeup.exchange(0);
+            }
+            destroyed = _destroyed.load() != 0;
+        }
+
+        flush();
+
+        if(destroyed)
+        {
+            return;
+        }
+    }
+}
+
+LogBuffer*
+IceInternal::AsyncLogWriter::getBuffer()
+{
+#if defined(_WIN32)
+    LogBuffer* buffer = static_cast<LogBuffer*>(FlsGetValue(_key));
+#else
+    LogBuffer* buffer = static_cast<LogBuffer*>(pthread_getspecific(_key));
+#endif
+    if(!buffer)
+    {
+        LogBufferPtr b = new LogBuffer(_bufferSize);
+        {
+            IceUtil::Mutex::Lock sync(_buffersMutex);
+            _buffers.push_back(b);
+        }
+        buffer = b.get();
+#if defined(_WIN32)
+        FlsSetValue(_key, buffer);
+#else
+        pthread_setspecific(_key, buffer);
+#endif
+    }
+    return buffer;
+}
+
+void
+IceInternal::AsyncLogWriter::flush()
+{
+    IceUtil::Mutex::Lock flushSync(_flushMutex);
+
+    vector<LogBufferPtr> buffers;
+    {
+        IceUtil::Mutex::Lock sync(_buffersMutex);
+        buffers = _buffers;
+    }
+
+    vector<LogBuffer*> orphaned;
+    for(vector<LogBufferPtr>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        //
+        // An orphaned buffer doesn't get new messages, it's released
+        // once it's drained.
+        //
+        if((*p)->isOrphaned())
+        {
+            orphaned.push_back(p->get());
+        }
+        (*p)->drain(_entries);
+    }
+
+    if(!orphaned.empty())
+    {
+        IceUtil::Mutex::Lock sync(_buffersMutex);
+        for(vector<LogBuffer*>::const_iterator p = orphaned.begin(); p != orphaned.end(); ++p)
+        {
+            for(vector<LogBufferPtr>::iterator q = _buffers.begin(); q != _buffers.end(); ++q)
+            {
+                if(q->get() == *p)
+                {
+                    _buffers.erase(q);
+                    break;
+                }
+            }
+        }
+    }
+
+    //
+    // The messages of the different threads are merged in the order
+    // in which they were logged.
+    //
+    sort(_entries.begin(), _entries.end(), logged);
+
+    int dropped = _dropped.exchange(0);
+    if(!_entries.empty() || dropped > 0)
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(outputMutex);
+        for(vector<LogBuffer::Entry>::const_iterator p = _entries.begin(); p != _entries.end(); ++p)
+        {
+            output(p->message);
+        }
+        if(dropped > 0)
+        {
+            ostringstream os;
+            os << "-! " << IceUtil::Time::now().toDateTime() << " warning: Logger: " << dropped
+               << " messages were dropped, consider increasing Ice.Logger.BufferSize";
+            output(os.str());
+        }
+        fflush(_out);
+        if(_fsync && _out != stderr)
+        {
+#ifdef _WIN32
+            _commit(_fileno(_out));
+#else
+            fsync(fileno(_out));
+#endif
+        }
+        _entries.clear();
+    }
+
+    if(_rotateInterval > IceUtil::Time() && _out != stderr && _size > 0 &&
+       IceUtil::Time::now(IceUtil::Time::Monotonic) - _opened >= _rotateInterval)
+    {
+        IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(outputMutex);
+        rotate();
+    }
+}
+
+void
+IceInternal::AsyncLogWriter::output(const string& message)
+{
+    fwrite(message.data(), 1, message.size(), _out);
+    fputc('\n', _out);
+    _size += static_cast<Long>(message.size() + 1);
+
+    if(_maxSize > 0 && _size >= _maxSize && _out != stderr)
+    {
+        rotate();
+    }
+}
+
+void
+IceInternal::AsyncLogWriter::rotate()
+{
+    //
+    // The log file is renamed to <file>.1, the previous <file>.1 to
+    // <file>.2 and so on, up to Ice.LogFile.MaxFiles files.
+    //
+    fclose(_out);
+
+    ostringstream last;
+    last << _file << '.' << _maxFiles;
+    IceUtilInternal::remove(last.str());
+    for(int i = _maxFiles - 1; i > 0; --i)
+    {
+        ostringstream from;
+        from << _file << '.' << i;
+        ostringstream to;
+        to << _file << '.' << i + 1;
+        IceUtilInternal::rename(from.str(), to.str());
+    }
+    IceUtilInternal::rename(_file, _file + ".1");
+
+    _size = 0;
+    _opened = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    _out = IceUtilInternal::fopen(_file, "a");
+    if(!_out)
+    {
+        _out = stderr;
+        string message = "-! " + IceUtil::Time::now().toDateTime() + " warning: Logger: cannot open " + _file +
+            " after rotation, logging to stderr";
+        output(message);
+    }
 }
 
 Ice::LoggerI::LoggerI(const string& prefix, const string& file,
-                      bool convert, const IceUtil::StringConverterPtr& converter) :
+                      bool convert, const IceUtil::StringConverterPtr& converter,
+                      const PropertiesPtr& properties) :
     _prefix(prefix),
     _convert(convert),
     _converter(converter)
@@ -63,7 +463,27 @@ Ice::LoggerI::LoggerI(const string& prefix, const string& file,
         _formattedPrefix = prefix + ": ";
     }
 
-    if(!file.empty())
+    //
+    // The log file can only be rotated by the asynchronous logger, it
+    // has a single writer for all the loggers cloned from this logger.
+    //
+    bool async = false;
+#ifndef ICE_OS_WINRT
+    if(properties)
+    {
+        async = properties->getPropertyAsInt("Ice.Logger.Async") > 0 ||
+            (!file.empty() && (properties->getPropertyAsInt("Ice.LogFile.MaxSize") > 0 ||
+                               properties->getPropertyAsInt("Ice.LogFile.RotateInterval") > 0));
+    }
+#endif
+
+    if(async)
+    {
+        _file = file;
+        _writer = new AsyncLogWriter(properties, file);
+        _writer->start();
+    }
+    else if(!file.empty())
     {
         _file = file;
         _out.open(file, fstream::out | fstream::app);
@@ -74,6 +494,24 @@ Ice::LoggerI::LoggerI(const string& prefix, const string& file,
     }
 }
 
+Ice::LoggerI::LoggerI(const string& prefix, const string& file,
+                      bool convert, const IceUtil::StringConverterPtr& converter,
+                      const AsyncLogWriterPtr& writer) :
+    _prefix(prefix),
+    _convert(convert),
+    _converter(converter),
+    _file(file),
+    _writer(writer)
+#if defined(_WIN32) && !defined(ICE_OS_WINRT)
+    , _consoleConverter(new IceUtil::WindowsStringConverter(GetConsoleOutputCP()))
+#endif
+{
+    if(!prefix.empty())
+    {
+        _formattedPrefix = prefix + ": ";
+    }
+}
+
 Ice::LoggerI::~LoggerI()
 {
     if(_out.is_open())
@@ -122,14 +560,25 @@ Ice::LoggerI::getPrefix()
 LoggerPtr
 Ice::LoggerI::cloneWithPrefix(const std::string& prefix)
 {
+    if(_writer)
+    {
+        return new LoggerI(prefix, _file, _convert, _converter, _writer);
+    }
     return new LoggerI(prefix, _file, _convert, _converter);
 }
 
 void
-Ice::LoggerI::write(const string& message, bool indent)
+Ice::LoggerI::destroy()
 {
-    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(outputMutex);
+    if(_writer)
+    {
+        _writer->destroy();
+    }
+}
 
+void
+Ice::LoggerI::write(const string& message, bool indent)
+{
     string s = message;
 
     if(indent)
@@ -142,6 +591,18 @@ Ice::LoggerI::write(const string& message, bool indent)
         }
     }
 
+    if(_writer)
+    {
+#if defined(_WIN32) && !defined(ICE_OS_WINRT)
+        _writer->write(_file.empty() ? toConsole(s) : s);
+#else
+        _writer->write(s);
+#endif
+        return;
+    }
+
+    IceUtilInternal::MutexPtrLock<IceUtil::Mutex> sync(outputMutex);
+
     if(_out.is_open())
     {
         _out << s << endl;
@@ -152,50 +613,58 @@ Ice::LoggerI::write(const string& message, bool indent)
         OutputDebugString(IceUtil::stringToWstring(s).c_str());
 #elif defined(_WIN32)
         //
-        // Convert the message from the native narrow string encoding to the console
-        // code page encoding for printing. If the _convert member is set to false
-        // we don't do any conversion.
+        // Use fprintf_s to avoid encoding conversion when stderr is connected
+        // to Windows console.
         //
-        if(!_convert)
-        {
-            //
-            // Use fprintf_s to avoid encoding conversion when stderr is connected
-            // to Windows console. When _convert is set to false we always output
-            // UTF-8 encoded messages.
-            //
-            fprintf_s(stderr, "%s\n", IceUtil::nativeToUTF8(s, _converter).c_str());
-            fflush(stderr);
-        }
-        else
-        {
-            try
-            {
-                // Convert message to UTF-8
-                string u8s = IceUtil::nativeToUTF8(s, _converter);
-
-                // Then from UTF-8 to console CP
-                string consoleString;
-                _consoleConverter->fromUTF8(reinterpret_cast<const Byte*>(u8s.data()),
-                                            reinterpret_cast<const Byte*>(u8s.data() + u8s.size()),
-                                            consoleString);
-
-                // We cannot use cerr here as writing to console using cerr
-                // will do its own conversion and will corrupt the messages.
-                //
-                fprintf_s(stderr, "%s\n", consoleString.c_str());
-            }
-            catch(const IceUtil::IllegalConversionException&)
-            {
-                //
-                // If there is a problem with the encoding conversions we just
-                // write the original message without encoding conversions.
-                //
-                fprintf_s(stderr, "%s\n", s.c_str());
-            }
-            fflush(stderr);
-        }
+        fprintf_s(stderr, "%s\n", toConsole(s).c_str());
+        fflush(stderr);
 #else
         cerr << s << endl;
 #endif
     }
 }
+
+#if defined(_WIN32) && !defined(ICE_OS_WINRT)
+string
+Ice::LoggerI::toConsole(const string& s) const
+{
+    //
+    // Convert the message from the native narrow string encoding to the console
+    // code page encoding for printing. If the _convert member is set to false
+    // we don't do any conversion.
+    //
+    if(!_convert)
+    {
+        //
+        // When _convert is set to false we always output UTF-8 encoded
+        // messages.
+        //
+        return IceUtil::nativeToUTF8(s, _converter);
+    }
+
+    try
+    {
+        // Convert message to UTF-8
+        string u8s = IceUtil::nativeToUTF8(s, _converter);
+
+        // Then from UTF-8 to console CP
+        string consoleString;
+        _consoleConverter->fromUTF8(reinterpret_cast<const Byte*>(u8s.data()),
+                                    reinterpret_cast<const Byte*>(u8s.data() + u8s.size()),
+                                    consoleString);
+
+        // We cannot use cerr here as writing to console using cerr
+        // will do its own conversion and will corrupt the messages.
+        //
+        return consoleString;
+    }
+    catch(const IceUtil::IllegalConversionException&)
+    {
+        //
+        // If there is a problem with the encoding conversions we just
+        // write the original message without encoding conversions.
+        //
+        return s;
+    }
+}
+#endif
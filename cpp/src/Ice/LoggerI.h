@@ -11,8 +11,129 @@
 #define ICE_LOGGER_I_H
 
 #include <Ice/Logger.h>
+#include <Ice/PropertiesF.h>
 #include <IceUtil/FileUtil.h>
 #include <IceUtil/StringConverter.h>
+#include <IceUtil/Thread.h>
+#include <IceUtil/Monitor.h>
+#include <IceUtil/Atomic.h>
+
+#include <vector>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+namespace IceInternal
+{
+
+//
+// A ring buffer of log messages, with a single producer thread and the
+// log writer as the single consumer.
+//
+class LogBuffer : public IceUtil::Shared
+{
+public:
+
+    struct Entry
+    {
+        unsigned int sequence;
+        std::string message;
+    };
+
+    LogBuffer(size_t);
+
+    //
+    // Returns false if the buffer is full.
+    //
+    bool push(unsigned int, const std::string&);
+    void drain(std::vector<Entry>&);
+
+    //
+    // Returns true if the buffer is more than half full.
+    //
+    bool isFilling() const;
+
+    void orphaned();
+    bool isOrphaned() const;
+
+private:
+
+    std::vector<Entry> _entries;
+    const unsigned int _mask;
+    IceUtilInternal::Atomic _head;
+    IceUtilInternal::Atomic _tail;
+    IceUtilInternal::Atomic _orphaned;
+};
+typedef IceUtil::Handle<LogBuffer> LogBufferPtr;
+
+//
+// The writer of the asynchronous logger, configured with the
+// Ice.Logger.* and Ice.LogFile.* properties. The messages are queued
+// without locking in per-thread buffers, the writer thread drains the
+// buffers every Ice.Logger.FlushInterval milliseconds, or sooner if a
+// buffer fills up, and writes the messages in the order in which they
+// were logged. Messages are dropped if a buffer is full, the number of
+// dropped messages is then written to the log. The log file is rotated
+// by the writer thread once it reaches Ice.LogFile.MaxSize bytes or
+// every Ice.LogFile.RotateInterval seconds.
+//
+class AsyncLogWriter : public IceUtil::Thread, private IceUtil::Monitor<IceUtil::Mutex>
+{
+public:
+
+    AsyncLogWriter(const Ice::PropertiesPtr&, const std::string&);
+    ~AsyncLogWriter();
+
+    void write(const std::string&);
+
+    //
+    // Writes the queued messages and joins the writer thread, the
+    // messages logged after destroy are written by the calling thread.
+    //
+    void destroy();
+
+    virtual void run();
+
+private:
+
+    LogBuffer* getBuffer();
+    void flush();
+    void output(const std::string&);
+    void rotate();
+
+    const std::string _file;
+    const size_t _bufferSize;
+    const IceUtil::Time _flushInterval;
+    const bool _fsync;
+    const Ice::Long _maxSize;
+    const IceUtil::Time _rotateInterval;
+    const int _maxFiles;
+
+    IceUtilInternal::Atomic _sequence;
+    IceUtilInternal::Atomic _dropped;
+    IceUtilInternal::Atomic _wakeup;
+    IceUtilInternal::Atomic _destroyed;
+
+    bool _keyInitialized;
+#if defined(_WIN32)
+    DWORD _key;
+#else
+    pthread_key_t _key;
+#endif
+    IceUtil::Mutex _buffersMutex;
+    std::vector<LogBufferPtr> _buffers;
+    LogBufferPtr _sharedBuffer;
+
+    IceUtil::Mutex _flushMutex;
+    FILE* _out;
+    Ice::Long _size;
+    IceUtil::Time _opened;
+    std::vector<LogBuffer::Entry> _entries;
+};
+typedef IceUtil::Handle<AsyncLogWriter> AsyncLogWriterPtr;
+
+}
 
 namespace Ice
 {
@@ -21,8 +142,12 @@ class LoggerI : public Logger
 {
 public:
 
+    //
+    // The logger is asynchronous if the given properties enable it,
+    // see IceInternal::AsyncLogWriter.
+    //
     LoggerI(const std::string&, const std::string&, bool convert = true,
-            const IceUtil::StringConverterPtr& converter = 0);
+            const IceUtil::StringConverterPtr& converter = 0, const Ice::PropertiesPtr& = 0);
     ~LoggerI();
 
     virtual void print(const std::string&);
@@ -32,10 +157,23 @@ public:
     virtual std::string getPrefix();
     virtual LoggerPtr cloneWithPrefix(const std::string&);
 
+    //
+    // Writes the messages queued by the asynchronous logger, called
+    // when the communicator is destroyed.
+    //
+    void destroy();
+
 private:
 
+    LoggerI(const std::string&, const std::string&, bool, const IceUtil::StringConverterPtr&,
+            const IceInternal::AsyncLogWriterPtr&);
+
     void write(const std::string&, bool);
 
+#if defined(_WIN32) && !defined(ICE_OS_WINRT)
+    std::string toConsole(const std::string&) const;
+#endif
+
     const std::string _prefix;
     std::string _formattedPrefix;
     const bool _convert;
@@ -44,6 +182,8 @@ private:
 
     std::string _file;
 
+    IceInternal::AsyncLogWriterPtr _writer;
+
 #if defined(_WIN32) && !defined(ICE_OS_WINRT)
     const IceUtil::StringConverterPtr _consoleConverter;
 #endif
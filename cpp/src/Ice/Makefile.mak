@@ -24,6 +24,7 @@ SLICE_OBJS	= .\BuiltinSequences.obj \
 		  .\EndpointF.obj \
 		  .\EndpointTypes.obj \
 		  .\FacetMap.obj \
+		  .\FlightRecorder.obj \
 		  .\Identity.obj \
 		  .\ImplicitContext.obj \
 		  .\ImplicitContextF.obj \
@@ -58,7 +59,9 @@ WINDOWS_OBJS   =  .\DLLMain.obj
 
 OBJS	       =  .\Acceptor.obj \
 		  .\ACM.obj \
+		  .\AdmissionControl.obj \
 		  .\Application.obj \
+		  .\Arena.obj \
 		  .\AsyncResult.obj \
 		  .\Base64.obj \
 		  .\BasicStream.obj \
@@ -71,6 +74,7 @@ OBJS	       =  .\Acceptor.obj \
 		  .\ConnectionRequestHandler.obj \
 		  .\Connector.obj \
 		  .\ConnectRequestHandler.obj \
+		  .\Deadline.obj \
 		  .\DefaultsAndOverrides.obj \
 		  .\DeprecatedStringConverter.obj \
 		  .\DispatchInterceptor.obj \
@@ -82,7 +86,9 @@ OBJS	       =  .\Acceptor.obj \
 		  .\Exception.obj \
 		  .\FactoryTable.obj \
 		  .\FactoryTableInit.obj \
+		  .\FlightRecorderI.obj \
 		  .\GCObject.obj \
+		  .\HedgeManager.obj \
 		  .\HttpParser.obj \
 		  .\ImplicitContextI.obj \
 		  .\Incoming.obj \
@@ -106,6 +112,7 @@ OBJS	       =  .\Acceptor.obj \
 		  .\ObjectFactoryManager.obj \
 		  .\ObserverHelper.obj \
 		  .\OpaqueEndpointI.obj \
+		  .\OpenMetricsPlugin.obj \
 		  .\Outgoing.obj \
 		  .\OutgoingAsync.obj \
 		  .\PluginManagerI.obj \
@@ -141,6 +148,7 @@ OBJS	       =  .\Acceptor.obj \
 		  .\ThreadPool.obj \
 		  .\TraceLevels.obj \
 		  .\TraceUtil.obj \
+		  .\Tracer.obj \
 		  .\Transceiver.obj \
 		  .\UdpConnector.obj \
 		  .\UdpEndpointI.obj \
@@ -198,6 +206,7 @@ clean::
 	-del /q EndpointF.cpp $(HDIR)\EndpointF.h
 	-del /q EndpointTypes.cpp $(HDIR)\EndpointTypes.h
 	-del /q FacetMap.cpp $(HDIR)\FacetMap.h
+	-del /q FlightRecorder.cpp $(HDIR)\FlightRecorder.h
 	-del /q Identity.cpp $(HDIR)\Identity.h
 	-del /q ImplicitContext.cpp $(HDIR)\ImplicitContext.h
 	-del /q ImplicitContextF.cpp $(HDIR)\ImplicitContextF.h
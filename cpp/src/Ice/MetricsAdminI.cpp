@@ -92,6 +92,71 @@ parseRule(const PropertiesPtr& properties, const string& name)
 
 }
 
+int
+IceMX::getLatencyBucket(Ice::Long us)
+{
+    if(us < 4)
+    {
+        return us < 0 ? 0 : static_cast<int>(us);
+    }
+
+    int e = 2;
+    while((us >> (e + 1)) != 0)
+    {
+        ++e;
+    }
+    int bucket = (e - 1) * 4 + static_cast<int>((us >> (e - 2)) & 3);
+    return bucket < latencyBucketCount ? bucket : latencyBucketCount - 1;
+}
+
+Ice::Long
+IceMX::getLatencyBucketUpperBound(int bucket)
+{
+    if(bucket < 4)
+    {
+        return bucket + 1;
+    }
+    const int e = bucket / 4 + 1;
+    return static_cast<Ice::Long>(5 + bucket % 4) << (e - 2);
+}
+
+void
+IceMX::addLatency(LatencyHistogram& histogram, Ice::Long latency)
+{
+    const size_t bucket = static_cast<size_t>(getLatencyBucket(latency));
+    if(bucket >= histogram.size())
+    {
+        histogram.resize(bucket + 1);
+    }
+    ++histogram[bucket];
+}
+
+Ice::Long
+IceMX::getLatencyPercentile(const LatencyHistogram& histogram, double percentile)
+{
+    Ice::Long total = 0;
+    for(LatencyHistogram::const_iterator p = histogram.begin(); p != histogram.end(); ++p)
+    {
+        total += *p;
+    }
+    if(total == 0)
+    {
+        return 0;
+    }
+
+    const double target = static_cast<double>(total) * percentile / 100.0;
+    Ice::Long count = 0;
+    for(size_t i = 0; i < histogram.size(); ++i)
+    {
+        count += histogram[i];
+        if(static_cast<double>(count) >= target && histogram[i] > 0)
+        {
+            return getLatencyBucketUpperBound(static_cast<int>(i));
+        }
+    }
+    return getLatencyBucketUpperBound(static_cast<int>(histogram.size()) - 1);
+}
+
 MetricsMapI::RegExp::RegExp(const string& attribute, const string& regexp) : _attribute(attribute)
 {
 #ifdef __MINGW32__
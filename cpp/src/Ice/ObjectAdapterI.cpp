@@ -18,6 +18,7 @@
 #include <Ice/EndpointFactoryManager.h>
 #include <Ice/ConnectionFactory.h>
 #include <Ice/ServantManager.h>
+#include <Ice/AdmissionControl.h>
 #include <Ice/RouterInfo.h>
 #include <Ice/LocalException.h>
 #include <Ice/Properties.h>
@@ -834,6 +835,16 @@ Ice::ObjectAdapterI::getServantManager() const
     return _servantManager;
 }
 
+AdmissionControlPtr
+Ice::ObjectAdapterI::getAdmissionControl() const
+{
+    //
+    // No mutex lock necessary, _admissionControl is immutable after
+    // initialization.
+    //
+    return _admissionControl;
+}
+
 IceInternal::ACMConfig
 Ice::ObjectAdapterI::getACM() const
 {
@@ -937,6 +948,14 @@ Ice::ObjectAdapterI::initialize(const RouterPrx& router)
             }
         }
 
+        int maxInFlight = properties->getPropertyAsInt(_name + ".MaxInFlight");
+        int targetQueueDelay = properties->getPropertyAsInt(_name + ".TargetQueueDelay");
+        if(maxInFlight > 0 || targetQueueDelay > 0)
+        {
+            int queueDelayInterval = properties->getPropertyAsIntWithDefault(_name + ".QueueDelayInterval", 100);
+            _admissionControl = new AdmissionControl(maxInFlight, targetQueueDelay, queueDelayInterval);
+        }
+
         int threadPoolSize = properties->getPropertyAsInt(_name + ".ThreadPool.Size");
         int threadPoolSizeMax = properties->getPropertyAsInt(_name + ".ThreadPool.SizeMax");
         bool hasPriority = properties->getProperty(_name + ".ThreadPool.ThreadPriority") != "";
@@ -1429,8 +1448,10 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Locator.PreferSecure",
         "Locator.CollocationOptimized",
         "Locator.Router",
+        "MaxInFlight",
         "MessageSizeMax",
         "PublishedEndpoints",
+        "QueueDelayInterval",
         "RegisterProcess",
         "ReplicaGroupId",
         "Router",
@@ -1449,6 +1470,7 @@ Ice::ObjectAdapterI::filterProperties(StringSeq& unknownProps)
         "Router.LocatorCacheTimeout",
         "Router.InvocationTimeout",
         "ProxyOptions",
+        "TargetQueueDelay",
         "ThreadPool.Size",
         "ThreadPool.SizeMax",
         "ThreadPool.SizeWarn",
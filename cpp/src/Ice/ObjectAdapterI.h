@@ -19,6 +19,7 @@
 #include <Ice/CommunicatorF.h>
 #include <Ice/ConnectionFactoryF.h>
 #include <Ice/ServantManagerF.h>
+#include <Ice/AdmissionControlF.h>
 #include <Ice/ProxyF.h>
 #include <Ice/ObjectF.h>
 #include <Ice/RouterInfoF.h>
@@ -97,6 +98,7 @@ public:
 
     IceInternal::ThreadPoolPtr getThreadPool() const;
     IceInternal::ServantManagerPtr getServantManager() const;
+    IceInternal::AdmissionControlPtr getAdmissionControl() const;
     IceInternal::ACMConfig getACM() const;
     size_t messageSizeMax() const { return _messageSizeMax; }
 
@@ -135,6 +137,7 @@ private:
     IceInternal::ThreadPoolPtr _threadPool;
     IceInternal::ACMConfig _acm;
     IceInternal::ServantManagerPtr _servantManager;
+    IceInternal::AdmissionControlPtr _admissionControl;
     const std::string _name;
     const std::string _id;
     const std::string _replicaGroupId;
@@ -0,0 +1,625 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceUtil/StringUtil.h>
+#include <Ice/OpenMetricsPlugin.h>
+#include <Ice/HttpParser.h>
+#include <Ice/Instance.h>
+#include <Ice/Communicator.h>
+#include <Ice/Initialize.h>
+#include <Ice/Properties.h>
+#include <Ice/LocalException.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/Metrics.h>
+
+#include <iomanip>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+using namespace IceMX;
+
+namespace
+{
+
+const size_t maxRequestSize = 8192;
+
+//
+// Converts a metrics map name such as "ConnectionEstablishment" to
+// the "connection_establishment" metric name prefix.
+//
+string
+toMetricName(const string& name)
+{
+    string result;
+    for(string::const_iterator p = name.begin(); p != name.end(); ++p)
+    {
+        if(isupper(static_cast<unsigned char>(*p)))
+        {
+            if(p != name.begin())
+            {
+                result += '_';
+            }
+            result += static_cast<char>(tolower(static_cast<unsigned char>(*p)));
+        }
+        else if(isalnum(static_cast<unsigned char>(*p)))
+        {
+            result += *p;
+        }
+        else
+        {
+            result += '_';
+        }
+    }
+    return result;
+}
+
+string
+escapeLabelValue(const string& value)
+{
+    string result;
+    for(string::const_iterator p = value.begin(); p != value.end(); ++p)
+    {
+        switch(*p)
+        {
+        case '\\':
+            result += "\\\\";
+            break;
+        case '"':
+            result += "\\\"";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        default:
+            result += *p;
+            break;
+        }
+    }
+    return result;
+}
+
+string
+toSeconds(Ice::Long us)
+{
+    ostringstream os;
+    os << fixed << setprecision(6) << static_cast<double>(us) / 1000000.0;
+    return os.str();
+}
+
+template<typename T> string
+toString(T value)
+{
+    ostringstream os;
+    os << value;
+    return os.str();
+}
+
+//
+// The samples are grouped by metric family, the samples of a family
+// must be contiguous and the families are written in the order they
+// are first seen.
+//
+class MetricsWriter
+{
+public:
+
+    void add(const string& family, const string& type, const string& help, const string& suffix,
+             const string& labels, const string& value)
+    {
+        map<string, Family>::iterator p = _families.find(family);
+        if(p == _families.end())
+        {
+            p = _families.insert(make_pair(family, Family())).first;
+            p->second.type = type;
+            p->second.help = help;
+            _order.push_back(family);
+        }
+        p->second.samples.push_back(family + suffix + "{" + labels + "} " + value + "\n");
+    }
+
+    void addCounter(const string& family, const string& help, const string& labels, Ice::Long value)
+    {
+        add(family, "counter", help, "_total", labels, toString(value));
+    }
+
+    void addGauge(const string& family, const string& help, const string& labels, Ice::Long value)
+    {
+        add(family, "gauge", help, "", labels, toString(value));
+    }
+
+    //
+    // The latency histogram buckets are aggregated to power of two
+    // bounds, up to the last non-empty bucket. The sum is the total
+    // lifetime of the metrics objects, which is the sum of the
+    // latencies measured by the histogram.
+    //
+    void addHistogram(const string& family, const string& help, const string& labels,
+                      const LatencyHistogram& histogram, Ice::Long sum)
+    {
+        Ice::Long count = 0;
+        size_t i = 0;
+        for(int bucket = 3; bucket < latencyBucketCount; bucket += 4)
+        {
+            for(; i < histogram.size() && i <= static_cast<size_t>(bucket); ++i)
+            {
+                count += histogram[i];
+            }
+            add(family, "histogram", help, "_bucket",
+                labels + ",le=\"" + toSeconds(getLatencyBucketUpperBound(bucket)) + "\"", toString(count));
+            if(i >= histogram.size())
+            {
+                break;
+            }
+        }
+        for(; i < histogram.size(); ++i)
+        {
+            count += histogram[i];
+        }
+        add(family, "histogram", help, "_bucket", labels + ",le=\"+Inf\"", toString(count));
+        add(family, "histogram", help, "_count", labels, toString(count));
+        add(family, "histogram", help, "_sum", labels, toSeconds(sum));
+    }
+
+    //
+    // The labels of a sample are the labels of its map (the view and, for
+    // the remote and collocated children, the parent invocation) followed
+    // by the metrics id.
+    //
+    void addMetrics(const string& prefix, const string& mapLabels, const MetricsPtr& m)
+    {
+        const string labels = mapLabels + ",id=\"" + escapeLabelValue(m->id) + "\"";
+        addCounter(prefix, "Number of monitored objects.", labels, m->total);
+        addGauge(prefix + "_current", "Number of monitored objects currently active.", labels, m->current);
+        addCounter(prefix + "_failures", "Number of failures.", labels, m->failures);
+        add(prefix + "_lifetime_seconds", "counter", "Lifetime of the monitored objects.", "_total", labels,
+            toSeconds(m->totalLifetime));
+
+        if(ConnectionMetricsPtr c = ConnectionMetricsPtr::dynamicCast(m))
+        {
+            addCounter(prefix + "_received_bytes", "Number of bytes received.", labels, c->receivedBytes);
+            addCounter(prefix + "_sent_bytes", "Number of bytes sent.", labels, c->sentBytes);
+        }
+        else if(ThreadMetricsPtr t = ThreadMetricsPtr::dynamicCast(m))
+        {
+            addGauge(prefix + "_in_use_for_io", "Number of threads doing I/O.", labels, t->inUseForIO);
+            addGauge(prefix + "_in_use_for_user", "Number of threads dispatching.", labels, t->inUseForUser);
+            addGauge(prefix + "_in_use_for_other", "Number of threads busy with other tasks.", labels,
+                     t->inUseForOther);
+        }
+        else if(DispatchMetricsPtr d = DispatchMetricsPtr::dynamicCast(m))
+        {
+            addCounter(prefix + "_user_exceptions", "Number of user exceptions.", labels, d->userException);
+            addCounter(prefix + "_request_bytes", "Size of the request parameters.", labels, d->size);
+            addCounter(prefix + "_reply_bytes", "Size of the reply parameters.", labels, d->replySize);
+            addHistogram(prefix + "_duration_seconds", "Latency of the dispatches.", labels,
+                         d->latency ? *d->latency : LatencyHistogram(), d->totalLifetime);
+        }
+        else if(ChildInvocationMetricsPtr c = ChildInvocationMetricsPtr::dynamicCast(m))
+        {
+            addCounter(prefix + "_request_bytes", "Size of the request parameters.", labels, c->size);
+            addCounter(prefix + "_reply_bytes", "Size of the reply parameters.", labels, c->replySize);
+            addHistogram(prefix + "_duration_seconds", "Latency of the requests.", labels,
+                         c->latency ? *c->latency : LatencyHistogram(), c->totalLifetime);
+        }
+        else if(InvocationMetricsPtr i = InvocationMetricsPtr::dynamicCast(m))
+        {
+            addCounter(prefix + "_retries", "Number of retries.", labels, i->retry);
+            addCounter(prefix + "_hedged", "Number of hedged requests.", labels, i->hedged ? *i->hedged : 0);
+            addCounter(prefix + "_user_exceptions", "Number of user exceptions.", labels, i->userException);
+            addHistogram(prefix + "_duration_seconds", "Latency of the invocations.", labels,
+                         i->latency ? *i->latency : LatencyHistogram(), i->totalLifetime);
+
+            string invocation = ",invocation=\"" + escapeLabelValue(m->id) + "\"";
+            addMetricsMap(prefix + "_remote", mapLabels + invocation, i->remotes);
+            addMetricsMap(prefix + "_collocated", mapLabels + invocation, i->collocated);
+        }
+    }
+
+    void addMetricsMap(const string& prefix, const string& labels, const MetricsMap& metrics)
+    {
+        for(MetricsMap::const_iterator p = metrics.begin(); p != metrics.end(); ++p)
+        {
+            if(*p)
+            {
+                addMetrics(prefix, labels, *p);
+            }
+        }
+    }
+
+    string str() const
+    {
+        string result;
+        for(vector<string>::const_iterator p = _order.begin(); p != _order.end(); ++p)
+        {
+            const Family& family = _families.find(*p)->second;
+            result += "# TYPE " + *p + " " + family.type + "\n";
+            result += "# HELP " + *p + " " + family.help + "\n";
+            for(vector<string>::const_iterator q = family.samples.begin(); q != family.samples.end(); ++q)
+            {
+                result += *q;
+            }
+        }
+        result += "# EOF\n";
+        return result;
+    }
+
+private:
+
+    struct Family
+    {
+        string type;
+        string help;
+        vector<string> samples;
+    };
+
+    map<string, Family> _families;
+    vector<string> _order;
+};
+
+}
+
+//
+// The entry point for the OpenMetrics plugin built-in the Ice library.
+//
+extern "C"
+{
+
+ICE_API Plugin*
+createIceOpenMetrics(const CommunicatorPtr& communicator, const string&, const StringSeq&)
+{
+    return new OpenMetricsPlugin(communicator);
+}
+
+}
+
+IceInternal::OpenMetricsPlugin::OpenMetricsPlugin(const CommunicatorPtr& communicator) :
+    IceUtil::Thread("IceOpenMetrics listener thread"),
+    _communicator(communicator),
+    _logger(communicator->getLogger()),
+    _timeout(0),
+    _fd(INVALID_SOCKET),
+    _fdIntrRead(INVALID_SOCKET),
+    _fdIntrWrite(INVALID_SOCKET)
+{
+}
+
+void
+IceInternal::OpenMetricsPlugin::initialize()
+{
+    _metricsAdmin = MetricsAdminIPtr::dynamicCast(_communicator->findAdminFacet("Metrics"));
+    if(!_metricsAdmin)
+    {
+        throw PluginInitializationException(__FILE__, __LINE__,
+                                            "IceOpenMetrics: the Metrics admin facet is not enabled, "
+                                            "set Ice.Admin.Enabled to enable it");
+    }
+
+    PropertiesPtr properties = _communicator->getProperties();
+    int port = properties->getPropertyAsInt("IceOpenMetrics.Port");
+    if(port <= 0 || port > 65535)
+    {
+        throw PluginInitializationException(__FILE__, __LINE__, "IceOpenMetrics: invalid IceOpenMetrics.Port");
+    }
+    string host = properties->getPropertyWithDefault("IceOpenMetrics.Host", "localhost");
+    _path = properties->getPropertyWithDefault("IceOpenMetrics.Path", "/metrics");
+    _timeout = properties->getPropertyAsIntWithDefault("IceOpenMetrics.Timeout", 5000);
+    if(_timeout <= 0)
+    {
+        _timeout = 5000;
+    }
+
+    InstancePtr instance = getInstance(_communicator);
+    Address addr = getAddressForServer(host, port, instance->protocolSupport(), instance->preferIPv6());
+    _fd = createServerSocket(false, addr, instance->protocolSupport());
+    setBlock(_fd, false);
+#ifndef _WIN32
+    setReuseAddress(_fd, true);
+#endif
+    doBind(_fd, addr);
+    doListen(_fd, 16);
+
+    SOCKET fds[2];
+    try
+    {
+        createPipe(fds);
+    }
+    catch(...)
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+        throw;
+    }
+    _fdIntrRead = fds[0];
+    _fdIntrWrite = fds[1];
+    setBlock(_fdIntrRead, false);
+
+    start();
+}
+
+void
+IceInternal::OpenMetricsPlugin::destroy()
+{
+    if(_fd == INVALID_SOCKET)
+    {
+        return;
+    }
+
+    char c = 0;
+#ifdef _WIN32
+    while(::send(_fdIntrWrite, &c, 1, 0) == SOCKET_ERROR)
+#else
+    while(::write(_fdIntrWrite, &c, 1) == SOCKET_ERROR)
+#endif
+    {
+        if(!interrupted())
+        {
+            break;
+        }
+    }
+    getThreadControl().join();
+
+    closeSocketNoThrow(_fd);
+    closeSocketNoThrow(_fdIntrRead);
+    closeSocketNoThrow(_fdIntrWrite);
+    _fd = INVALID_SOCKET;
+    _metricsAdmin = 0;
+}
+
+void
+IceInternal::OpenMetricsPlugin::run()
+{
+    while(true)
+    {
+#ifdef _WIN32
+        fd_set fdSet;
+        FD_ZERO(&fdSet);
+        FD_SET(_fd, &fdSet);
+        FD_SET(_fdIntrRead, &fdSet);
+        int ret = ::select(0, &fdSet, 0, 0, 0); // The first parameter is ignored on Windows
+#else
+        //
+        // poll() rather than select(), the descriptors can be greater
+        // than FD_SETSIZE in a process with many connections.
+        //
+        struct pollfd pollFdSet[2];
+        pollFdSet[0].fd = _fd;
+        pollFdSet[0].events = POLLIN;
+        pollFdSet[1].fd = _fdIntrRead;
+        pollFdSet[1].events = POLLIN;
+        int ret = ::poll(pollFdSet, 2, -1);
+#endif
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            Error out(_logger);
+            out << "IceOpenMetrics: failed to wait for connections:\n"
+                << IceUtilInternal::errorToString(getSocketErrno());
+            return;
+        }
+
+#ifdef _WIN32
+        if(FD_ISSET(_fdIntrRead, &fdSet))
+#else
+        if(pollFdSet[1].revents != 0)
+#endif
+        {
+            return;
+        }
+
+        SOCKET fd;
+        try
+        {
+            fd = doAccept(_fd);
+        }
+        catch(const SocketException&)
+        {
+            continue; // The client closed the connection or there's no pending connection.
+        }
+
+        try
+        {
+            handleRequest(fd);
+        }
+        catch(const Ice::Exception& ex)
+        {
+            Warning out(_logger);
+            out << "IceOpenMetrics: failed to handle request:\n" << ex;
+        }
+        closeSocketNoThrow(fd);
+    }
+}
+
+string
+IceInternal::OpenMetricsPlugin::getMetrics() const
+{
+    MetricsWriter writer;
+    StringSeq disabled;
+    StringSeq views = _metricsAdmin->getMetricsViewNames(disabled, Current());
+    for(StringSeq::const_iterator p = views.begin(); p != views.end(); ++p)
+    {
+        MetricsView view;
+        try
+        {
+            Ice::Long timestamp;
+            view = _metricsAdmin->getMetricsView(*p, timestamp, Current());
+        }
+        catch(const UnknownMetricsView&)
+        {
+            continue; // The view was disabled or removed.
+        }
+
+        string labels = "view=\"" + escapeLabelValue(*p) + "\"";
+        for(MetricsView::const_iterator q = view.begin(); q != view.end(); ++q)
+        {
+            writer.addMetricsMap("ice_" + toMetricName(q->first), labels, q->second);
+        }
+    }
+    return writer.str();
+}
+
+void
+IceInternal::OpenMetricsPlugin::handleRequest(SOCKET fd)
+{
+    setBlock(fd, false);
+
+    vector<Ice::Byte> buf;
+    const Ice::Byte* end = 0;
+    try
+    {
+        while(!end)
+        {
+            if(buf.size() >= maxRequestSize || !wait(fd, false))
+            {
+                return;
+            }
+
+            size_t pos = buf.size();
+            buf.resize(pos + 1024);
+            int ret = static_cast<int>(::recv(fd, reinterpret_cast<char*>(&buf[pos]), 1024, 0));
+            if(ret == 0)
+            {
+                return;
+            }
+            else if(ret == SOCKET_ERROR)
+            {
+                buf.resize(pos);
+                if(interrupted() || wouldBlock())
+                {
+                    continue;
+                }
+                return;
+            }
+            buf.resize(pos + static_cast<size_t>(ret));
+            end = HttpParser().isCompleteMessage(&buf[0], &buf[0] + buf.size());
+        }
+    }
+    catch(const WebSocketException&)
+    {
+        end = 0;
+    }
+
+    string status = "200 OK";
+    string body;
+    string extraHeaders;
+    HttpParser parser;
+    try
+    {
+        if(!end || !parser.parse(&buf[0], end) || parser.type() != HttpParser::TypeRequest)
+        {
+            status = "400 Bad Request";
+        }
+    }
+    catch(const WebSocketException&)
+    {
+        status = "400 Bad Request";
+    }
+
+    if(status == "200 OK")
+    {
+        string uri = parser.uri();
+        string::size_type pos = uri.find('?');
+        if(pos != string::npos)
+        {
+            uri = uri.substr(0, pos);
+        }
+
+        if(uri != _path)
+        {
+            status = "404 Not Found";
+        }
+        else if(parser.method() != "GET" && parser.method() != "HEAD")
+        {
+            status = "405 Method Not Allowed";
+            extraHeaders = "Allow: GET, HEAD\r\n";
+        }
+        else
+        {
+            body = getMetrics();
+            extraHeaders = "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n";
+        }
+    }
+
+    ostringstream os;
+    os << "HTTP/1.1 " << status << "\r\n" << extraHeaders << "Content-Length: " << body.size() << "\r\n"
+       << "Connection: close\r\n\r\n";
+    string response = os.str();
+    if(parser.method() != "HEAD")
+    {
+        response += body;
+    }
+
+    size_t sent = 0;
+    while(sent < response.size())
+    {
+        if(!wait(fd, true))
+        {
+            return;
+        }
+
+        int ret = static_cast<int>(::send(fd, response.data() + sent, static_cast<int>(response.size() - sent), 0));
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted() || wouldBlock())
+            {
+                continue;
+            }
+            return;
+        }
+        sent += static_cast<size_t>(ret);
+    }
+}
+
+bool
+IceInternal::OpenMetricsPlugin::wait(SOCKET fd, bool write)
+{
+    //
+    // Returns false if the socket isn't ready before the timeout or
+    // if the plugin is destroyed.
+    //
+    while(true)
+    {
+#ifdef _WIN32
+        fd_set readSet;
+        fd_set writeSet;
+        FD_ZERO(&readSet);
+        FD_ZERO(&writeSet);
+        FD_SET(_fdIntrRead, &readSet);
+        FD_SET(fd, write ? &writeSet : &readSet);
+
+        struct timeval tv;
+        tv.tv_sec = _timeout / 1000;
+        tv.tv_usec = (_timeout % 1000) * 1000;
+        int ret = ::select(0, &readSet, &writeSet, 0, &tv); // The first parameter is ignored on Windows
+#else
+        struct pollfd pollFdSet[2];
+        pollFdSet[0].fd = fd;
+        pollFdSet[0].events = write ? POLLOUT : POLLIN;
+        pollFdSet[1].fd = _fdIntrRead;
+        pollFdSet[1].events = POLLIN;
+        int ret = ::poll(pollFdSet, 2, _timeout);
+#endif
+        if(ret == SOCKET_ERROR)
+        {
+            if(interrupted())
+            {
+                continue;
+            }
+            return false;
+        }
+#ifdef _WIN32
+        return ret > 0 && !FD_ISSET(_fdIntrRead, &readSet);
+#else
+        return ret > 0 && pollFdSet[1].revents == 0;
+#endif
+    }
+}
@@ -0,0 +1,70 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_OPEN_METRICS_PLUGIN_H
+#define ICE_OPEN_METRICS_PLUGIN_H
+
+#include <IceUtil/Thread.h>
+#include <Ice/Plugin.h>
+#include <Ice/CommunicatorF.h>
+#include <Ice/LoggerF.h>
+#include <Ice/MetricsAdminI.h>
+#include <Ice/Network.h>
+
+namespace IceInternal
+{
+
+//
+// The IceOpenMetrics plugin serves the enabled IceMX metrics views of
+// the communicator in the OpenMetrics text format. It requires the
+// Ice.Admin facets to be enabled and listens for HTTP requests on the
+// address given by the IceOpenMetrics.Host and IceOpenMetrics.Port
+// properties. The requests are handled one at a time by the listener
+// thread, the metrics are only collected when they are scraped.
+//
+// Since requests are handled serially, a client which connects and
+// doesn't send its request, or doesn't read the response, blocks the
+// other scrapes for up to IceOpenMetrics.Timeout milliseconds (5000
+// by default) for each read or write.
+//
+class OpenMetricsPlugin : public Ice::Plugin, public IceUtil::Thread
+{
+public:
+
+    OpenMetricsPlugin(const Ice::CommunicatorPtr&);
+
+    virtual void initialize();
+    virtual void destroy();
+
+    virtual void run();
+
+    //
+    // Returns the metrics views in the OpenMetrics text format.
+    //
+    std::string getMetrics() const;
+
+private:
+
+    void handleRequest(SOCKET);
+    bool wait(SOCKET, bool);
+
+    const Ice::CommunicatorPtr _communicator;
+    const Ice::LoggerPtr _logger;
+    IceInternal::MetricsAdminIPtr _metricsAdmin;
+    std::string _path;
+    int _timeout;
+    SOCKET _fd;
+    SOCKET _fdIntrRead;
+    SOCKET _fdIntrWrite;
+};
+typedef IceUtil::Handle<OpenMetricsPlugin> OpenMetricsPluginPtr;
+
+}
+
+#endif
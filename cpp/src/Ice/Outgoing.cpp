@@ -15,7 +15,9 @@
 #include <Ice/Instance.h>
 #include <Ice/LocalException.h>
 #include <Ice/ReplyStatus.h>
-#include <Ice/ImplicitContextI.h>
+#include <Ice/Deadline.h>
+#include <Ice/HedgeManager.h>
+#include <Ice/AdmissionControl.h>
 
 using namespace std;
 using namespace IceUtil;
@@ -31,7 +33,8 @@ ProxyOutgoingBase::ProxyOutgoingBase(IceProxy::Ice::Object* proxy, OperationMode
     OutgoingBase(proxy->__reference()->getInstance().get()),
     _proxy(proxy),
     _mode(mode),
-    _state(StateUnsent)
+    _state(StateUnsent),
+    _hedgeOperation(0)
 {
     int invocationTimeout = _proxy->__reference()->getInvocationTimeout();
     if(invocationTimeout > 0)
@@ -42,6 +45,10 @@ ProxyOutgoingBase::ProxyOutgoingBase(IceProxy::Ice::Object* proxy, OperationMode
 
 ProxyOutgoingBase::~ProxyOutgoingBase()
 {
+    if(_hedge)
+    {
+        _hedge->detach();
+    }
 }
 
 void
@@ -53,6 +60,7 @@ ProxyOutgoingBase::sent()
         _childObserver.detach();
         _state = StateOK;
     }
+    _span.sent();
     _sent = true;
     _monitor.notify();
 
@@ -150,6 +158,11 @@ ProxyOutgoingBase::invokeImpl()
                 }
             }
 
+            if(_hedgeDeadline != Time())
+            {
+                hedge();
+            }
+
             bool timedOut = false;
             {
                 Monitor<Mutex>::Lock sync(_monitor);
@@ -207,6 +220,21 @@ ProxyOutgoingBase::invokeImpl()
                 }
             }
 
+            if(_hedge && _state == StateFailed)
+            {
+                //
+                // The request is canceled once the hedged request gets
+                // a reply, take the reply over.
+                //
+                BasicStream is(_proxy->__reference()->getInstance().get(), Ice::currentProtocolEncoding);
+                if(_hedge->takeReply(is))
+                {
+                    _state = StateInProgress;
+                    _exception.reset(0);
+                    completed(is);
+                }
+            }
+
             if(_exception.get())
             {
                 _exception->ice_throw();
@@ -219,6 +247,11 @@ ProxyOutgoingBase::invokeImpl()
             else
             {
                 assert(_state != StateInProgress);
+                if(_hedgeOperation)
+                {
+                    _proxy->__reference()->getInstance()->hedgeManager()->addLatency(
+                        *_hedgeOperation, Time::now(Time::Monotonic) - _hedgeStart);
+                }
                 return _state == StateOK;
             }
         }
@@ -272,6 +305,7 @@ ProxyOutgoingBase::invokeImpl()
             catch(const Ice::Exception& ex)
             {
                 _observer.failed(ex.ice_name());
+                _span.failed();
                 throw;
             }
         }
@@ -281,6 +315,72 @@ ProxyOutgoingBase::invokeImpl()
     return false;
 }
 
+void
+ProxyOutgoingBase::startHedging(const string& operation)
+{
+    HedgeManagerPtr hedgeManager = _proxy->__reference()->getInstance()->hedgeManager();
+    if(hedgeManager->canHedge(_proxy->__reference(), _mode))
+    {
+        _hedgeOperation = &operation;
+        _hedgeStart = Time::now(Time::Monotonic);
+        Time delay = hedgeManager->getDelay(operation);
+        if(delay != Time())
+        {
+            _hedgeDeadline = _hedgeStart + delay;
+        }
+    }
+}
+
+void
+ProxyOutgoingBase::hedge()
+{
+    {
+        //
+        // Wait for the reply until the hedging delay expires.
+        //
+        Monitor<Mutex>::Lock sync(_monitor);
+        Time deadline = _hedgeDeadline;
+        if(_invocationTimeoutDeadline != Time() && _invocationTimeoutDeadline < deadline)
+        {
+            deadline = _invocationTimeoutDeadline;
+        }
+        Time now = Time::now(Time::Monotonic);
+        while(_state == StateInProgress && now < deadline)
+        {
+            _monitor.timedWait(deadline - now);
+            now = Time::now(Time::Monotonic);
+        }
+        const bool expired = now >= _hedgeDeadline;
+        _hedgeDeadline = Time();
+        if(_state != StateInProgress || !_sent || !expired)
+        {
+            return; // The invocation completed, isn't sent yet or timed out.
+        }
+    }
+
+    ConnectionIPtr connection;
+    try
+    {
+        connection = _handler->getConnection();
+    }
+    catch(const Ice::LocalException&)
+    {
+    }
+    if(!connection)
+    {
+        return; // Collocated invocation.
+    }
+
+    HedgeManagerPtr hedgeManager = _proxy->__reference()->getInstance()->hedgeManager();
+    ObjectPrx proxy = hedgeManager->getProxy(_proxy, connection->endpoint());
+    if(proxy && hedgeManager->acquire())
+    {
+        _hedge = new HedgeRequest(proxy, *_hedgeOperation, _mode, _os, Time::now(Time::Monotonic) - _hedgeStart);
+        _observer.hedged();
+        _hedge->invoke(this, _handler);
+    }
+}
+
 Outgoing::Outgoing(IceProxy::Ice::Object* proxy, const string& operation, OperationMode mode, const Context* context) :
     ProxyOutgoingBase(proxy, mode),
     _encoding(getCompatibleEncoding(proxy->__reference()->getEncoding())),
@@ -296,6 +396,7 @@ Outgoing::Outgoing(IceProxy::Ice::Object* proxy, const string& operation, Operat
         case Reference::ModeOneway:
         case Reference::ModeDatagram:
         {
+            _span.startInvocation(_proxy->__reference()->getInstance().get(), operation);
             _os.writeBlob(requestHdr, sizeof(requestHdr));
             break;
         }
@@ -329,29 +430,7 @@ Outgoing::Outgoing(IceProxy::Ice::Object* proxy, const string& operation, Operat
 
         _os.write(static_cast<Ice::Byte>(mode));
 
-        if(context != 0)
-        {
-            //
-            // Explicit context
-            //
-            _os.write(*context);
-        }
-        else
-        {
-            //
-            // Implicit context
-            //
-            const ImplicitContextIPtr& implicitContext = _proxy->__reference()->getInstance()->getImplicitContext();
-            const Context& prxContext = _proxy->__reference()->getContext()->getValue();
-            if(implicitContext == 0)
-            {
-                _os.write(prxContext);
-            }
-            else
-            {
-                implicitContext->write(prxContext, &_os);
-            }
-        }
+        writeRequestContext(&_os, _proxy->__reference().get(), context, _span);
     }
     catch(const LocalException& ex)
     {
@@ -385,6 +464,11 @@ Outgoing::invoke()
         _proxy->__getBatchRequestQueue()->finishBatchRequest(&_os, _proxy, _operation);
         return true;
     }
+
+    if(_mode != Normal)
+    {
+        startHedging(_operation);
+    }
     return invokeImpl();
 }
 
@@ -420,6 +504,7 @@ Outgoing::completed(BasicStream& is)
         _childObserver->reply(static_cast<Int>(is.b.size() - headerSize - 4));
     }
     _childObserver.detach();
+    _span.replied();
 
     _is.swap(is);
 
@@ -532,7 +617,14 @@ Outgoing::completed(BasicStream& is)
 
                 case replyUnknownLocalException:
                 {
-                    ex = new UnknownLocalException(__FILE__, __LINE__);
+                    if(unknown == overloadedReason)
+                    {
+                        ex = new OverloadedException(__FILE__, __LINE__);
+                    }
+                    else
+                    {
+                        ex = new UnknownLocalException(__FILE__, __LINE__);
+                    }
                     break;
                 }
 
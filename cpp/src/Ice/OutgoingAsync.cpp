@@ -15,9 +15,11 @@
 #include <Ice/Instance.h>
 #include <Ice/LocalException.h>
 #include <Ice/ReplyStatus.h>
-#include <Ice/ImplicitContextI.h>
+#include <Ice/Deadline.h>
 #include <Ice/ThreadPool.h>
 #include <Ice/RetryQueue.h>
+#include <Ice/HedgeManager.h>
+#include <Ice/AdmissionControl.h>
 
 using namespace std;
 using namespace Ice;
@@ -159,6 +161,11 @@ ProxyOutgoingAsyncBase::cancelable(const CancellationHandlerPtr& handler)
             _instance->timer()->schedule(this, IceUtil::Time::milliSeconds(timeout));
         }
     }
+    if(_hedgeStart != IceUtil::Time())
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        _hedgeConnection = ConnectionIPtr::dynamicCast(handler);
+    }
     AsyncResult::cancelable(handler);
 }
 
@@ -188,6 +195,61 @@ ProxyOutgoingAsyncBase::abort(const Ice::Exception& ex)
     }
 }
 
+void
+ProxyOutgoingAsyncBase::hedge()
+{
+    ConnectionIPtr connection;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        if(!_hedgeTask)
+        {
+            return; // The invocation completed.
+        }
+        _hedgeTask = 0;
+        connection = _hedgeConnection;
+    }
+
+    if(!connection)
+    {
+        return; // The request isn't sent yet or it's collocated.
+    }
+
+    HedgeManagerPtr hedgeManager = _instance->hedgeManager();
+    ObjectPrx proxy = hedgeManager->getProxy(_proxy, connection->endpoint());
+    if(!proxy || !hedgeManager->acquire())
+    {
+        return;
+    }
+
+    //
+    // The request stream is only modified by the cancellation of the
+    // invocation, which doesn't run concurrently: the invocation
+    // timeout runs on the timer thread as well.
+    //
+    HedgeRequestPtr hedge = new HedgeRequest(proxy, getOperation(), _mode, _os,
+                                              IceUtil::Time::now(IceUtil::Time::Monotonic) - _hedgeStart);
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        if(!_hedgeConnection)
+        {
+            return; // The invocation completed.
+        }
+        _hedge = hedge;
+        _observer.hedged();
+    }
+    hedge->invoke(this);
+}
+
+void
+ProxyOutgoingAsyncBase::hedgeReplied()
+{
+    //
+    // The reply of the hedged request is taken by finished() once the
+    // request is canceled.
+    //
+    cancel(InvocationCanceledException(__FILE__, __LINE__));
+}
+
 ProxyOutgoingAsyncBase::ProxyOutgoingAsyncBase(const ObjectPrx& prx,
                                                const string& operation,
                                                const CallbackBasePtr& delegate,
@@ -200,6 +262,22 @@ ProxyOutgoingAsyncBase::ProxyOutgoingAsyncBase(const ObjectPrx& prx,
 {
 }
 
+void
+ProxyOutgoingAsyncBase::startHedging()
+{
+    HedgeManagerPtr hedgeManager = _instance->hedgeManager();
+    if(hedgeManager->canHedge(_proxy->__reference(), _mode))
+    {
+        _hedgeStart = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        IceUtil::Time delay = hedgeManager->getDelay(getOperation());
+        if(delay != IceUtil::Time())
+        {
+            _hedgeTask = new HedgeTimerTask(this);
+            _instance->timer()->schedule(_hedgeTask, delay);
+        }
+    }
+}
+
 void
 ProxyOutgoingAsyncBase::invokeImpl(bool userThread)
 {
@@ -290,12 +368,14 @@ bool
 ProxyOutgoingAsyncBase::sent(bool done)
 {
     _sent = true;
+    _span.sent();
     if(done)
     {
         if(_proxy->__reference()->getInvocationTimeout() != -1)
         {
             _instance->timer()->cancel(this);
         }
+        _span.finish();
     }
     return OutgoingAsyncBase::sent(done);
 }
@@ -307,6 +387,21 @@ ProxyOutgoingAsyncBase::finished(const Exception& ex)
     {
         _instance->timer()->cancel(this);
     }
+    if(_hedgeStart != IceUtil::Time())
+    {
+        HedgeRequestPtr hedge = stopHedging();
+        if(hedge)
+        {
+            bool replied = hedge->takeReply(_is);
+            hedge->detach();
+            if(replied)
+            {
+                return completed(); // The hedged request got the reply first.
+            }
+        }
+    }
+    _span.failed();
+    _span.finish();
     return OutgoingAsyncBase::finished(ex);
 }
 
@@ -317,9 +412,46 @@ ProxyOutgoingAsyncBase::finished(bool ok)
     {
         _instance->timer()->cancel(this);
     }
+    if(_hedgeStart != IceUtil::Time())
+    {
+        HedgeRequestPtr hedge = stopHedging();
+        if(hedge)
+        {
+            hedge->detach();
+        }
+        _instance->hedgeManager()->addLatency(getOperation(),
+                                              IceUtil::Time::now(IceUtil::Time::Monotonic) - _hedgeStart);
+    }
+    _span.finish();
     return AsyncResult::finished(ok);
 }
 
+HedgeRequestPtr
+ProxyOutgoingAsyncBase::stopHedging()
+{
+    IceUtil::TimerTaskPtr task;
+    HedgeRequestPtr hedge;
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_monitor);
+        task = _hedgeTask;
+        _hedgeTask = 0;
+        _hedgeConnection = 0;
+        hedge = _hedge;
+        _hedge = 0;
+    }
+    if(task)
+    {
+        try
+        {
+            _instance->timer()->cancel(task);
+        }
+        catch(const CommunicatorDestroyedException&)
+        {
+        }
+    }
+    return hedge;
+}
+
 int
 ProxyOutgoingAsyncBase::handleException(const Exception& exc)
 {
@@ -362,6 +494,7 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
         case Reference::ModeOneway:
         case Reference::ModeDatagram:
         {
+            _span.startInvocation(_instance.get(), operation);
             _os.writeBlob(requestHdr, sizeof(requestHdr));
             break;
         }
@@ -395,29 +528,7 @@ OutgoingAsync::prepare(const string& operation, OperationMode mode, const Contex
 
     _os.write(static_cast<Byte>(_mode));
 
-    if(context != 0)
-    {
-        //
-        // Explicit context
-        //
-        _os.write(*context);
-    }
-    else
-    {
-        //
-        // Implicit context
-        //
-        const ImplicitContextIPtr& implicitContext = ref->getInstance()->getImplicitContext();
-        const Context& prxContext = ref->getContext()->getValue();
-        if(implicitContext == 0)
-        {
-            _os.write(prxContext);
-        }
-        else
-        {
-            implicitContext->write(prxContext, &_os);
-        }
-    }
+    writeRequestContext(&_os, ref, context, _span);
 }
 
 bool
@@ -468,6 +579,11 @@ OutgoingAsync::invoke()
         return; // Don't call sent/completed callback for batch AMI requests
     }
 
+    if(_mode != Normal)
+    {
+        startHedging();
+    }
+
     //
     // NOTE: invokeImpl doesn't throw so this can be called from the
     // try block with the catch block calling abort() in case of an
@@ -491,6 +607,7 @@ OutgoingAsync::completed()
         _childObserver->reply(static_cast<Int>(_is.b.size() - headerSize - 4));
         _childObserver.detach();
     }
+    _span.replied();
 
     Byte replyStatus;
     try
@@ -586,7 +703,14 @@ OutgoingAsync::completed()
 
                     case replyUnknownLocalException:
                     {
-                        ex.reset(new UnknownLocalException(__FILE__, __LINE__));
+                        if(unknown == overloadedReason)
+                        {
+                            ex.reset(new OverloadedException(__FILE__, __LINE__));
+                        }
+                        else
+                        {
+                            ex.reset(new UnknownLocalException(__FILE__, __LINE__));
+                        }
                         break;
                     }
 
@@ -65,6 +65,9 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Ice.Admin.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Ice.Admin.MessageSizeMax", false, 0),
+    IceInternal::Property("Ice.Admin.MaxInFlight", false, 0),
+    IceInternal::Property("Ice.Admin.TargetQueueDelay", false, 0),
+    IceInternal::Property("Ice.Admin.QueueDelayInterval", false, 0),
     IceInternal::Property("Ice.Admin.DelayCreation", false, 0),
     IceInternal::Property("Ice.Admin.Enabled", false, 0),
     IceInternal::Property("Ice.Admin.Facets", false, 0),
@@ -116,13 +119,27 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Default.Timeout", false, 0),
     IceInternal::Property("Ice.EventLog.Source", false, 0),
     IceInternal::Property("Ice.FactoryAssemblies", false, 0),
+    IceInternal::Property("Ice.FlightRecorder.File", false, 0),
+    IceInternal::Property("Ice.FlightRecorder.Size", false, 0),
+    IceInternal::Property("Ice.HedgeBudget", false, 0),
+    IceInternal::Property("Ice.HedgePercentile", false, 0),
     IceInternal::Property("Ice.HTTPProxyHost", false, 0),
     IceInternal::Property("Ice.HTTPProxyPort", false, 0),
     IceInternal::Property("Ice.ImplicitContext", false, 0),
     IceInternal::Property("Ice.InitPlugins", false, 0),
     IceInternal::Property("Ice.IPv4", false, 0),
     IceInternal::Property("Ice.IPv6", false, 0),
+    IceInternal::Property("Ice.LatencyAwareEndpointSelection", false, 0),
+    IceInternal::Property("Ice.LocatorCacheJitter", false, 0),
+    IceInternal::Property("Ice.LocatorCacheRefreshAhead", false, 0),
     IceInternal::Property("Ice.LogFile", false, 0),
+    IceInternal::Property("Ice.LogFile.MaxFiles", false, 0),
+    IceInternal::Property("Ice.LogFile.MaxSize", false, 0),
+    IceInternal::Property("Ice.LogFile.RotateInterval", false, 0),
+    IceInternal::Property("Ice.Logger.Async", false, 0),
+    IceInternal::Property("Ice.Logger.BufferSize", false, 0),
+    IceInternal::Property("Ice.Logger.FlushInterval", false, 0),
+    IceInternal::Property("Ice.Logger.Fsync", false, 0),
     IceInternal::Property("Ice.LogStdErr.Convert", false, 0),
     IceInternal::Property("Ice.MessageSizeMax", false, 0),
     IceInternal::Property("Ice.Nohup", false, 0),
@@ -170,11 +187,21 @@ const IceInternal::Property IcePropsData[] =
     IceInternal::Property("Ice.Trace.Retry", false, 0),
     IceInternal::Property("Ice.Trace.Slicing", false, 0),
     IceInternal::Property("Ice.Trace.ThreadPool", false, 0),
+    IceInternal::Property("Ice.Tracing.BufferSize", false, 0),
+    IceInternal::Property("Ice.Tracing.Enabled", false, 0),
+    IceInternal::Property("Ice.Tracing.File", false, 0),
+    IceInternal::Property("Ice.Tracing.FlushInterval", false, 0),
+    IceInternal::Property("Ice.Tracing.Sample", false, 0),
     IceInternal::Property("Ice.UDP.RcvSize", false, 0),
     IceInternal::Property("Ice.UDP.SndSize", false, 0),
     IceInternal::Property("Ice.TCP.Backlog", false, 0),
     IceInternal::Property("Ice.TCP.RcvSize", false, 0),
     IceInternal::Property("Ice.TCP.SndSize", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate.ClientMaxWindowBits", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate.ClientNoContextTakeover", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate.ServerMaxWindowBits", false, 0),
+    IceInternal::Property("Ice.WS.PerMessageDeflate.ServerNoContextTakeover", false, 0),
     IceInternal::Property("Ice.UseApplicationClassLoader", false, 0),
     IceInternal::Property("Ice.UseSyslog", false, 0),
     IceInternal::Property("Ice.Warn.AMICallback", false, 0),
@@ -246,6 +273,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Multicast.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.MaxInFlight", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Multicast.QueueDelayInterval", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ACM.Close", false, 0),
@@ -283,6 +313,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.MaxInFlight", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Reply.QueueDelayInterval", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ACM.Close", false, 0),
@@ -320,6 +353,9 @@ const IceInternal::Property IceDiscoveryPropsData[] =
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.MaxInFlight", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceDiscovery.Locator.QueueDelayInterval", false, 0),
     IceInternal::Property("IceDiscovery.Lookup", false, 0),
     IceInternal::Property("IceDiscovery.Timeout", false, 0),
     IceInternal::Property("IceDiscovery.RetryCount", false, 0),
@@ -373,6 +409,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridDiscovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.MaxInFlight", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGridDiscovery.Reply.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Timeout", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Heartbeat", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ACM.Close", false, 0),
@@ -410,6 +449,9 @@ const IceInternal::Property IceGridDiscoveryPropsData[] =
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridDiscovery.Locator.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.MaxInFlight", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGridDiscovery.Locator.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGridDiscovery.Lookup", false, 0),
     IceInternal::Property("IceGridDiscovery.Timeout", false, 0),
     IceInternal::Property("IceGridDiscovery.RetryCount", false, 0),
@@ -424,6 +466,18 @@ const IceInternal::PropertyArray
     IceInternal::PropertyNames::IceGridDiscoveryProps(IceGridDiscoveryPropsData,
                                                 sizeof(IceGridDiscoveryPropsData)/sizeof(IceGridDiscoveryPropsData[0]));
 
+const IceInternal::Property IceOpenMetricsPropsData[] = 
+{
+    IceInternal::Property("IceOpenMetrics.Host", false, 0),
+    IceInternal::Property("IceOpenMetrics.Port", false, 0),
+    IceInternal::Property("IceOpenMetrics.Path", false, 0),
+    IceInternal::Property("IceOpenMetrics.Timeout", false, 0),
+};
+
+const IceInternal::PropertyArray
+    IceInternal::PropertyNames::IceOpenMetricsProps(IceOpenMetricsPropsData,
+                                                sizeof(IceOpenMetricsPropsData)/sizeof(IceOpenMetricsPropsData[0]));
+
 const IceInternal::Property IceBoxPropsData[] = 
 {
     IceInternal::Property("IceBox.InheritProperties", false, 0),
@@ -517,6 +571,9 @@ const IceInternal::Property IceGridAdminPropsData[] =
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGridAdmin.Discovery.Reply.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.MaxInFlight", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGridAdmin.Discovery.Reply.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.Observers", false, 0),
     IceInternal::Property("IceGridAdmin.Trace.SaveToRegistry", false, 0),
 };
@@ -564,6 +621,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.AdminRouter.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.AdminRouter.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.InstanceName", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Node.ACM.Heartbeat", false, 0),
@@ -602,6 +662,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Node.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Node.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Node.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Node.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Node.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Node.AllowRunningServersAsRoot", false, 0),
     IceInternal::Property("IceGrid.Node.AllowEndpointsOverride", false, 0),
     IceInternal::Property("IceGrid.Node.CollocateRegistry", false, 0),
@@ -679,6 +742,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.AdminSessionManager.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.ConnectionCached", false, 0),
     IceInternal::Property("IceGrid.Registry.AdminSSLPermissionsVerifier.PreferSecure", false, 0),
@@ -726,6 +792,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Client.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Registry.CryptPasswords", false, 0),
     IceInternal::Property("IceGrid.Registry.Data", false, 0),
     IceInternal::Property("IceGrid.Registry.DefaultTemplates", false, 0),
@@ -766,6 +835,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Discovery.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Enabled", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Address", false, 0),
     IceInternal::Property("IceGrid.Registry.Discovery.Port", false, 0),
@@ -808,6 +880,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Internal.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Internal.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Registry.NodeSessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.PermissionsVerifier.ConnectionCached", false, 0),
@@ -860,6 +935,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.Server.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionFilters", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Timeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ACM.Heartbeat", false, 0),
@@ -898,6 +976,9 @@ const IceInternal::Property IceGridPropsData[] =
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionManager.MessageSizeMax", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.MaxInFlight", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.TargetQueueDelay", false, 0),
+    IceInternal::Property("IceGrid.Registry.SessionManager.QueueDelayInterval", false, 0),
     IceInternal::Property("IceGrid.Registry.SessionTimeout", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.EndpointSelection", false, 0),
     IceInternal::Property("IceGrid.Registry.SSLPermissionsVerifier.ConnectionCached", false, 0),
@@ -974,6 +1055,9 @@ const IceInternal::Property IcePatch2PropsData[] =
     IceInternal::Property("IcePatch2.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("IcePatch2.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("IcePatch2.MessageSizeMax", false, 0),
+    IceInternal::Property("IcePatch2.MaxInFlight", false, 0),
+    IceInternal::Property("IcePatch2.TargetQueueDelay", false, 0),
+    IceInternal::Property("IcePatch2.QueueDelayInterval", false, 0),
     IceInternal::Property("IcePatch2.Directory", false, 0),
     IceInternal::Property("IcePatch2.InstanceName", false, 0),
 };
@@ -1099,6 +1183,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Client.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Glacier2.Client.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Client.MaxInFlight", false, 0),
+    IceInternal::Property("Glacier2.Client.TargetQueueDelay", false, 0),
+    IceInternal::Property("Glacier2.Client.QueueDelayInterval", false, 0),
     IceInternal::Property("Glacier2.Client.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Client.Buffered", false, 0),
     IceInternal::Property("Glacier2.Client.ForwardContext", false, 0),
@@ -1174,6 +1261,9 @@ const IceInternal::Property Glacier2PropsData[] =
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadIdleTime", false, 0),
     IceInternal::Property("Glacier2.Server.ThreadPool.ThreadPriority", false, 0),
     IceInternal::Property("Glacier2.Server.MessageSizeMax", false, 0),
+    IceInternal::Property("Glacier2.Server.MaxInFlight", false, 0),
+    IceInternal::Property("Glacier2.Server.TargetQueueDelay", false, 0),
+    IceInternal::Property("Glacier2.Server.QueueDelayInterval", false, 0),
     IceInternal::Property("Glacier2.Server.AlwaysBatch", false, 0),
     IceInternal::Property("Glacier2.Server.Buffered", false, 0),
     IceInternal::Property("Glacier2.Server.ForwardContext", false, 0),
@@ -1260,6 +1350,7 @@ const IceInternal::PropertyArray IceInternal::PropertyNames::validProps[] =
     IceMXProps,
     IceDiscoveryProps,
     IceGridDiscoveryProps,
+    IceOpenMetricsProps,
     IceBoxProps,
     IceBoxAdminProps,
     IceGridAdminProps,
@@ -1281,6 +1372,7 @@ const char* IceInternal::PropertyNames::clPropNames[] =
     "IceMX",
     "IceDiscovery",
     "IceGridDiscovery",
+    "IceOpenMetrics",
     "IceBox",
     "IceBoxAdmin",
     "IceGridAdmin",
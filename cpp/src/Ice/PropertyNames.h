@@ -60,6 +60,7 @@ public:
     static const PropertyArray IceMXProps;
     static const PropertyArray IceDiscoveryProps;
     static const PropertyArray IceGridDiscoveryProps;
+    static const PropertyArray IceOpenMetricsProps;
     static const PropertyArray IceBoxProps;
     static const PropertyArray IceBoxAdminProps;
     static const PropertyArray IceGridAdminProps;
@@ -24,6 +24,8 @@
 #include <Ice/ConnectionI.h> // To convert from ConnectionIPtr to ConnectionPtr in ice_getConnection().
 #include <Ice/Stream.h>
 #include <Ice/ImplicitContextI.h>
+#include <Ice/AdmissionControl.h>
+#include <Ice/HedgeManager.h>
 
 using namespace std;
 using namespace Ice;
@@ -40,6 +42,45 @@ const string ice_invoke_name = "ice_invoke";
 const string ice_getConnection_name = "ice_getConnection";
 const string ice_flushBatchRequests_name = "ice_flushBatchRequests";
 
+void
+excludeOverloadedEndpoint(const ObjectPrx& proxy, const RequestHandlerPtr& handler)
+{
+    //
+    // The connection to the overloaded server is still open, the retry
+    // would use it again. Instead, the proxy gets the request handler of
+    // its other endpoints if it has several. The endpoints of an indirect
+    // proxy aren't resolved here, this could require a locator request
+    // from a thread pool thread.
+    //
+    ReferencePtr ref = proxy->__reference();
+    if(!handler || ref->isIndirect() || ref->getRouterInfo() || ref->getEndpoints().size() < 2)
+    {
+        return;
+    }
+
+    try
+    {
+        ConnectionIPtr connection = handler->getConnection();
+        if(connection)
+        {
+            ObjectPrx other = ref->getInstance()->hedgeManager()->getProxy(proxy, connection->endpoint());
+            if(other)
+            {
+                //
+                // The proxy is given the request handler if it caches its
+                // connection, otherwise the retry selects an endpoint among
+                // all the proxy endpoints again.
+                //
+                other->__reference()->getRequestHandler(proxy);
+            }
+        }
+    }
+    catch(const LocalException&)
+    {
+        // Ignore, the retry uses the proxy endpoints.
+    }
+}
+
 }
 
 ::Ice::ObjectPrx
@@ -1491,18 +1532,29 @@ IceProxy::Ice::Object::__handleException(const Exception& ex,
     // "at-most-once" (see the implementation of the checkRetryAfterException method
     //  of the ProxyFactory class for the reasons why it can be useful).
     //
+    // The same is true for an OverloadedException, the server rejected the request
+    // without dispatching it (see AdmissionControl.h).
+    //
     // If the request didn't get sent or if it's non-mutating or idempotent it can
     // also always be retried if the retry count isn't reached.
     //
     const LocalException* localEx = dynamic_cast<const LocalException*>(&ex);
+    const bool overloaded = dynamic_cast<const OverloadedException*>(&ex) != 0;
     if(localEx && (!sent ||
                    mode == Nonmutating || mode == Idempotent ||
                    dynamic_cast<const CloseConnectionException*>(&ex) ||
-                   dynamic_cast<const ObjectNotExistException*>(&ex)))
+                   dynamic_cast<const ObjectNotExistException*>(&ex) ||
+                   overloaded))
     {
         try
         {
-            return _reference->getInstance()->proxyFactory()->checkRetryAfterException(*localEx, _reference, cnt);
+            int interval = _reference->getInstance()->proxyFactory()->checkRetryAfterException(*localEx, _reference,
+                                                                                                 cnt);
+            if(overloaded)
+            {
+                excludeOverloadedEndpoint(this, handler);
+            }
+            return interval;
         }
         catch(const CommunicatorDestroyedException&)
         {
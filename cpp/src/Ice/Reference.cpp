@@ -70,6 +70,75 @@ struct RandomNumberGenerator : public std::unary_function<ptrdiff_t, ptrdiff_t>
     }
 };
 
+struct RoundTripTimeIsOutlier : public std::unary_function<pair<EndpointIPtr, IceUtil::Int64>, bool>
+{
+    RoundTripTimeIsOutlier(IceUtil::Int64 limit) : _limit(limit)
+    {
+    }
+
+    bool operator()(const pair<EndpointIPtr, IceUtil::Int64>& p) const
+    {
+        return p.second > _limit;
+    }
+
+private:
+
+    const IceUtil::Int64 _limit;
+};
+
+//
+// Sorts the randomly ordered endpoints for the Random endpoint
+// selection when Ice.LatencyAwareEndpointSelection is set. The
+// endpoints whose round-trip time is far above the fastest one are
+// moved last, then the best of the first two endpoints is picked
+// (power of two choices): this spreads the load over the endpoints
+// with similar latencies rather than sending everything to the
+// fastest one. Endpoints without measurements are preferred so that
+// they get measured.
+//
+void
+sortByLatency(vector<EndpointIPtr>& endpoints, const OutgoingConnectionFactoryPtr& factory)
+{
+    if(endpoints.size() < 2)
+    {
+        return;
+    }
+
+    vector<IceUtil::Int64> roundTripTimes = factory->getRoundTripTimes(endpoints);
+    vector<pair<EndpointIPtr, IceUtil::Int64> > sorted;
+    IceUtil::Int64 fastest = -1;
+    for(size_t i = 0; i < endpoints.size(); ++i)
+    {
+        sorted.push_back(make_pair(endpoints[i], roundTripTimes[i]));
+        if(roundTripTimes[i] >= 0 && (fastest < 0 || roundTripTimes[i] < fastest))
+        {
+            fastest = roundTripTimes[i];
+        }
+    }
+    if(fastest < 0)
+    {
+        return;
+    }
+
+    //
+    // Eject the outliers, the tolerance avoids ejecting endpoints for
+    // a few hundred microseconds on a fast network.
+    //
+    vector<pair<EndpointIPtr, IceUtil::Int64> >::iterator last =
+        stable_partition(sorted.begin(), sorted.end(), not1(RoundTripTimeIsOutlier(fastest * 3 + 1000)));
+
+    if(last - sorted.begin() >= 2 && sorted[0].second >= 0 &&
+       (sorted[1].second < 0 || sorted[1].second < sorted[0].second))
+    {
+        swap(sorted[0], sorted[1]);
+    }
+
+    for(size_t i = 0; i < sorted.size(); ++i)
+    {
+        endpoints[i] = sorted[i].first;
+    }
+}
+
 }
 
 CommunicatorPtr
@@ -81,8 +150,9 @@ IceInternal::Reference::getCommunicator() const
 ReferencePtr
 IceInternal::Reference::changeContext(const Context& newContext) const
 {
-    ReferencePtr r = _instance->referenceFactory()->copy(this);
-    r->_context = new SharedContext(newContext);
+    ReferenceFactoryPtr factory = _instance->referenceFactory();
+    ReferencePtr r = factory->copy(this);
+    r->_context = factory->intern(newContext);
     return r;
 }
 
@@ -519,14 +589,14 @@ IceInternal::Reference::Reference(const InstancePtr& instance,
                                   const ProtocolVersion& protocol,
                                   const EncodingVersion& encoding,
                                   int invocationTimeout,
-                                  const Ice::Context& ctx) :
+                                  const SharedContextPtr& ctx) :
     _hashInitialized(false),
     _instance(instance),
     _communicator(communicator),
     _mode(mode),
     _secure(secure),
     _identity(id),
-    _context(new SharedContext(ctx)),
+    _context(ctx),
     _facet(facet),
     _protocol(protocol),
     _encoding(encoding),
@@ -586,7 +656,8 @@ IceInternal::FixedReference::FixedReference(const InstancePtr& instance,
                                             bool secure,
                                             const EncodingVersion& encoding,
                                             const ConnectionIPtr& fixedConnection) :
-    Reference(instance, communicator, id, facet, mode, secure, Ice::Protocol_1_0, encoding, -1, Ice::Context()),
+    Reference(instance, communicator, id, facet, mode, secure, Ice::Protocol_1_0, encoding, -1,
+              new SharedContext()),
     _fixedConnection(fixedConnection)
 {
 }
@@ -902,7 +973,7 @@ IceInternal::RoutableReference::RoutableReference(const InstancePtr& instance,
                                                   EndpointSelectionType endpointSelection,
                                                   int locatorCacheTimeout,
                                                   int invocationTimeout,
-                                                  const Ice::Context& ctx) :
+                                                  const SharedContextPtr& ctx) :
     Reference(instance, communicator, id, facet, mode, secure, protocol, encoding, invocationTimeout, ctx),
     _endpoints(endpoints),
     _adapterId(adapterId),
@@ -1018,9 +1089,11 @@ IceInternal::RoutableReference::changeEndpoints(const vector<EndpointIPtr>& newE
     {
         return RoutableReferencePtr(const_cast<RoutableReference*>(this));
     }
-    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(getInstance()->referenceFactory()->copy(this));
+    ReferenceFactoryPtr factory = getInstance()->referenceFactory();
+    RoutableReferencePtr r = RoutableReferencePtr::dynamicCast(factory->copy(this));
     r->_endpoints = newEndpoints;
     r->applyOverrides(r->_endpoints);
+    factory->intern(r->_endpoints);
     r->_adapterId.clear();
     return r;
 }
@@ -1913,6 +1986,10 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
         {
             RandomNumberGenerator rng;
             random_shuffle(endpoints.begin(), endpoints.end(), rng);
+            if(getInstance()->defaultsAndOverrides()->latencyAwareEndpointSelection)
+            {
+                sortByLatency(endpoints, getInstance()->outgoingConnectionFactory());
+            }
             break;
         }
         case Ordered:
@@ -32,6 +32,138 @@ using namespace IceInternal;
 
 IceUtil::Shared* IceInternal::upCast(::IceInternal::ReferenceFactory* p) { return p; }
 
+namespace
+{
+
+const size_t minPurgeSize = 256;
+const size_t maxCachedEndpoints = 1024;
+
+template<typename T, typename C> void
+purge(set<T, C>& table, size_t& purgeSize)
+{
+    if(table.size() < purgeSize)
+    {
+        return;
+    }
+
+    for(typename set<T, C>::iterator p = table.begin(); p != table.end();)
+    {
+        if((*p)->__getRef() == 1)
+        {
+            table.erase(p++);
+        }
+        else
+        {
+            ++p;
+        }
+    }
+    purgeSize = max(table.size() * 2, minPurgeSize);
+}
+
+}
+
+IceInternal::ReferencePartsTable::ReferencePartsTable() :
+    _endpointsPurgeSize(minPurgeSize),
+    _contextsPurgeSize(minPurgeSize),
+    _emptyContext(new SharedContext())
+{
+}
+
+void
+IceInternal::ReferencePartsTable::intern(vector<EndpointIPtr>& endpoints)
+{
+    if(endpoints.empty())
+    {
+        return;
+    }
+
+    IceUtil::Mutex::Lock sync(*this);
+    internEndpoints(endpoints);
+}
+
+SharedContextPtr
+IceInternal::ReferencePartsTable::intern(const Context& ctx)
+{
+    if(ctx.empty())
+    {
+        return _emptyContext;
+    }
+
+    SharedContextPtr context = new SharedContext(ctx);
+    IceUtil::Mutex::Lock sync(*this);
+    purge(_contexts, _contextsPurgeSize);
+    return *_contexts.insert(context).first;
+}
+
+bool
+IceInternal::ReferencePartsTable::getParsedEndpoints(const string& str, vector<EndpointIPtr>& endpoints)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return get(_parsedEndpoints, str, endpoints);
+}
+
+void
+IceInternal::ReferencePartsTable::addParsedEndpoints(const string& str, vector<EndpointIPtr>& endpoints)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    add(_parsedEndpoints, str, endpoints);
+}
+
+bool
+IceInternal::ReferencePartsTable::getUnmarshaledEndpoints(const string& data, vector<EndpointIPtr>& endpoints)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    return get(_unmarshaledEndpoints, data, endpoints);
+}
+
+void
+IceInternal::ReferencePartsTable::addUnmarshaledEndpoints(const string& data, vector<EndpointIPtr>& endpoints)
+{
+    IceUtil::Mutex::Lock sync(*this);
+    add(_unmarshaledEndpoints, data, endpoints);
+}
+
+void
+IceInternal::ReferencePartsTable::internEndpoints(vector<EndpointIPtr>& endpoints)
+{
+    purge(_endpoints, _endpointsPurgeSize);
+    for(vector<EndpointIPtr>::iterator p = endpoints.begin(); p != endpoints.end(); ++p)
+    {
+        //
+        // Endpoints are immutable, the endpoints which compare equal
+        // are interchangeable.
+        //
+        *p = *_endpoints.insert(*p).first;
+    }
+}
+
+bool
+IceInternal::ReferencePartsTable::get(const EndpointsCache& cache, const string& key, vector<EndpointIPtr>& endpoints)
+{
+    EndpointsCache::const_iterator p = cache.find(key);
+    if(p == cache.end())
+    {
+        return false;
+    }
+    endpoints = p->second;
+    return true;
+}
+
+void
+IceInternal::ReferencePartsTable::add(EndpointsCache& cache, const string& key, vector<EndpointIPtr>& endpoints)
+{
+    internEndpoints(endpoints);
+    if(cache.size() >= maxCachedEndpoints)
+    {
+        //
+        // Start over, the cache only needs to hold the endpoints of the
+        // proxies in use.
+        //
+        cache.clear();
+    }
+    cache.insert(make_pair(key, endpoints));
+}
+
 ReferencePtr
 IceInternal::ReferenceFactory::copy(const Reference* r) const
 {
@@ -55,8 +187,10 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
         return 0;
     }
 
+    vector<EndpointIPtr> sharedEndpoints = endpoints;
+    _partsTable->intern(sharedEndpoints);
     return create(ident, facet, tmpl->getMode(), tmpl->getSecure(), tmpl->getProtocol(), tmpl->getEncoding(),
-                  endpoints, "", "");
+                  sharedEndpoints, "", "");
 }
 
 ReferencePtr
@@ -427,6 +561,12 @@ IceInternal::ReferenceFactory::create(const string& str, const string& propertyP
     {
         case ':':
         {
+            const string endpointsStr = s.substr(beg);
+            if(_partsTable->getParsedEndpoints(endpointsStr, endpoints))
+            {
+                return create(ident, facet, mode, secure, protocol, encoding, endpoints, "", propertyPrefix);
+            }
+
             vector<string> unknownEndpoints;
             end = beg;
 
@@ -507,6 +647,7 @@ IceInternal::ReferenceFactory::create(const string& str, const string& propertyP
                 }
             }
 
+            _partsTable->addParsedEndpoints(endpointsStr, endpoints);
             return create(ident, facet, mode, secure, protocol, encoding, endpoints, "", propertyPrefix);
             break;
         }
@@ -644,11 +785,27 @@ IceInternal::ReferenceFactory::create(const Identity& ident, BasicStream* s)
 
     if(sz > 0)
     {
-        endpoints.reserve(sz);
-        while(sz--)
+        //
+        // Skip the endpoints to look them up with their encoding in the
+        // cache, they are only unmarshaled if they are not found.
+        //
+        const Buffer::Container::iterator start = s->i;
+        for(Ice::Int n = sz; n > 0; --n)
         {
-            EndpointIPtr endpoint = _instance->endpointFactoryManager()->read(s);
-            endpoints.push_back(endpoint);
+            s->skip(sizeof(Short));
+            s->skipEncaps();
+        }
+        const string data(reinterpret_cast<const char*>(start), reinterpret_cast<const char*>(s->i));
+        if(!_partsTable->getUnmarshaledEndpoints(data, endpoints))
+        {
+            s->i = start;
+            endpoints.reserve(sz);
+            while(sz--)
+            {
+                EndpointIPtr endpoint = _instance->endpointFactoryManager()->read(s);
+                endpoints.push_back(endpoint);
+            }
+            _partsTable->addUnmarshaledEndpoints(data, endpoints);
         }
     }
     else
@@ -670,6 +827,7 @@ IceInternal::ReferenceFactory::setDefaultRouter(const RouterPrx& defaultRouter)
     ReferenceFactoryPtr factory = new ReferenceFactory(_instance, _communicator);
     factory->_defaultLocator = _defaultLocator;
     factory->_defaultRouter = defaultRouter;
+    factory->_partsTable = _partsTable;
     return factory;
 }
 
@@ -690,6 +848,7 @@ IceInternal::ReferenceFactory::setDefaultLocator(const LocatorPrx& defaultLocato
     ReferenceFactoryPtr factory = new ReferenceFactory(_instance, _communicator);
     factory->_defaultRouter = _defaultRouter;
     factory->_defaultLocator = defaultLocator;
+    factory->_partsTable = _partsTable;
     return factory;
 }
 
@@ -701,7 +860,9 @@ IceInternal::ReferenceFactory::getDefaultLocator() const
 
 IceInternal::ReferenceFactory::ReferenceFactory(const InstancePtr& instance, const CommunicatorPtr& communicator) :
     _instance(instance),
-    _communicator(communicator)
+    _communicator(communicator),
+    _partsTable(new ReferencePartsTable()),
+    _defaultLocatorInfoInitialized(false)
 {
 }
 
@@ -789,7 +950,20 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
         }
         else
         {
-            locatorInfo = _instance->locatorManager()->get(_defaultLocator);
+            bool initialized;
+            {
+                IceUtil::Mutex::Lock sync(_mutex);
+                initialized = _defaultLocatorInfoInitialized;
+                locatorInfo = _defaultLocatorInfo;
+            }
+            if(!initialized)
+            {
+                locatorInfo = _instance->locatorManager()->get(_defaultLocator);
+
+                IceUtil::Mutex::Lock sync(_mutex);
+                _defaultLocatorInfo = locatorInfo;
+                _defaultLocatorInfoInitialized = true;
+            }
         }
     }
     RouterInfoPtr routerInfo = _instance->routerManager()->get(_defaultRouter);
@@ -912,7 +1086,8 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
     }
 
     //
-    // Create new reference
+    // Create new reference, the endpoints are already shared with the
+    // other references.
     //
     return new RoutableReference(_instance,
                                  _communicator,
@@ -932,6 +1107,6 @@ IceInternal::ReferenceFactory::create(const Identity& ident,
                                  endpointSelection,
                                  locatorCacheTimeout,
                                  invocationTimeout,
-                                 ctx);
+                                 _partsTable->intern(ctx));
 }
 
@@ -11,14 +11,73 @@
 #define ICE_REFERENCE_FACTORY_H
 
 #include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
 #include <Ice/ReferenceFactoryF.h>
 #include <Ice/Reference.h> // For Reference::Mode
 #include <Ice/ConnectionIF.h>
 #include <Ice/BuiltinSequences.h>
+#include <Ice/LocatorInfoF.h>
+
+#include <set>
+#include <map>
 
 namespace IceInternal
 {
 
+//
+// The table of the immutable parts shared by the references created by
+// a communicator. Proxies created from the same stringified proxy or
+// unmarshaled from the same data share the same endpoint and context
+// objects instead of holding their own copies.
+//
+// Entries only referenced by the table are purged whenever the table
+// doubles in size.
+//
+// The table also caches the endpoints of the last stringified and
+// marshaled proxies, keyed by their string or encoding, to avoid
+// parsing or unmarshaling the same endpoints over and over.
+//
+class ReferencePartsTable : public IceUtil::Shared, private IceUtil::Mutex
+{
+public:
+
+    ReferencePartsTable();
+
+    void intern(std::vector<EndpointIPtr>&);
+    SharedContextPtr intern(const Ice::Context&);
+
+    bool getParsedEndpoints(const std::string&, std::vector<EndpointIPtr>&);
+    void addParsedEndpoints(const std::string&, std::vector<EndpointIPtr>&);
+
+    bool getUnmarshaledEndpoints(const std::string&, std::vector<EndpointIPtr>&);
+    void addUnmarshaledEndpoints(const std::string&, std::vector<EndpointIPtr>&);
+
+private:
+
+    typedef std::map<std::string, std::vector<EndpointIPtr> > EndpointsCache;
+
+    void internEndpoints(std::vector<EndpointIPtr>&);
+    static bool get(const EndpointsCache&, const std::string&, std::vector<EndpointIPtr>&);
+    void add(EndpointsCache&, const std::string&, std::vector<EndpointIPtr>&);
+
+    struct ContextLess
+    {
+        bool operator()(const SharedContextPtr& lhs, const SharedContextPtr& rhs) const
+        {
+            return lhs->getValue() < rhs->getValue();
+        }
+    };
+
+    std::set<EndpointIPtr> _endpoints;
+    size_t _endpointsPurgeSize;
+    std::set<SharedContextPtr, ContextLess> _contexts;
+    size_t _contextsPurgeSize;
+    const SharedContextPtr _emptyContext;
+    EndpointsCache _parsedEndpoints;
+    EndpointsCache _unmarshaledEndpoints;
+};
+typedef IceUtil::Handle<ReferencePartsTable> ReferencePartsTablePtr;
+
 class ReferenceFactory : public ::IceUtil::Shared
 {
 public:
@@ -60,6 +119,12 @@ public:
     ReferenceFactoryPtr setDefaultLocator(const ::Ice::LocatorPrx&);
     ::Ice::LocatorPrx getDefaultLocator() const;
 
+    //
+    // Return the shared copies of reference parts.
+    //
+    void intern(std::vector<EndpointIPtr>& endpoints) const { _partsTable->intern(endpoints); }
+    SharedContextPtr intern(const Ice::Context& ctx) const { return _partsTable->intern(ctx); }
+
 private:
 
     ReferenceFactory(const InstancePtr&, const ::Ice::CommunicatorPtr&);
@@ -74,6 +139,15 @@ private:
     const ::Ice::CommunicatorPtr _communicator;
     ::Ice::RouterPrx _defaultRouter;
     ::Ice::LocatorPrx _defaultLocator;
+    ReferencePartsTablePtr _partsTable;
+
+    //
+    // The locator info of the default locator, cached since looking it
+    // up from the locator manager is expensive.
+    //
+    IceUtil::Mutex _mutex;
+    bool _defaultLocatorInfoInitialized;
+    LocatorInfoPtr _defaultLocatorInfo;
 };
 
 }
@@ -17,6 +17,7 @@ extern "C"
 Ice::Plugin* createIceUDP(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
 Ice::Plugin* createIceTCP(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
 Ice::Plugin* createStringConverter(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
+Ice::Plugin* createIceOpenMetrics(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
 
 };
 
@@ -25,4 +26,5 @@ IceInternal::RegisterPluginsInit::RegisterPluginsInit()
     Ice::registerPluginFactory("IceUDP", createIceUDP, true);
     Ice::registerPluginFactory("IceTCP", createIceTCP, true);
     Ice::registerPluginFactory("IceStringConverter", createStringConverter, false);
+    Ice::registerPluginFactory("IceOpenMetrics", createIceOpenMetrics, false);
 }
@@ -27,16 +27,19 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
     
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    ServantMapMap::iterator p = s.servantMapMapHint;
+
+    if(p == s.servantMapMap.end() || p->first != ident)
     {
-        p = _servantMapMap.find(ident);
+        p = s.servantMapMap.find(ident);
     }
 
-    if(p == _servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
+        p = s.servantMapMap.insert(s.servantMapMapHint, pair<const Identity, FacetMap>(ident, FacetMap()));
     }
     else
     {
@@ -54,7 +57,7 @@ IceInternal::ServantManager::addServant(const ObjectPtr& object, const Identity&
         }
     }
 
-    _servantMapMapHint = p;
+    s.servantMapMapHint = p;
 
     p->second.insert(pair<const string, ObjectPtr>(facet, object));
 }
@@ -92,15 +95,18 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
     
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
+
+    ServantMapMap::iterator p = s.servantMapMapHint;
     FacetMap::iterator q;
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    if(p == s.servantMapMap.end() || p->first != ident)
     {
-        p = _servantMapMap.find(ident);
+        p = s.servantMapMap.find(ident);
     }
     
-    if(p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if(p == s.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -118,14 +124,14 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string&
 
     if(p->second.empty())
     {
-        if(p == _servantMapMapHint)
+        if(p == s.servantMapMapHint)
         {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
+            s.servantMapMap.erase(p++);
+            s.servantMapMapHint = p;
         }
         else
         {
-            _servantMapMap.erase(p);
+            s.servantMapMap.erase(p);
         }
     }
     return servant;
@@ -167,14 +173,17 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
     
     assert(_instance); // Must not be called after destruction.
 
-    ServantMapMap::iterator p = _servantMapMapHint;
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
+
+    ServantMapMap::iterator p = s.servantMapMapHint;
 
-    if(p == _servantMapMap.end() || p->first != ident)
+    if(p == s.servantMapMap.end() || p->first != ident)
     {
-        p = _servantMapMap.find(ident);
+        p = s.servantMapMap.find(ident);
     }
     
-    if(p == _servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
         NotRegisteredException ex(__FILE__, __LINE__);
         ex.kindOfObject = "servant";
@@ -184,14 +193,14 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 
     FacetMap result = p->second;
 
-    if(p == _servantMapMapHint)
+    if(p == s.servantMapMapHint)
     {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
+        s.servantMapMap.erase(p++);
+        s.servantMapMapHint = p;
     }
     else
     {
-        _servantMapMap.erase(p);
+        s.servantMapMap.erase(p);
     }
 
     return result;
@@ -200,40 +209,45 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string& facet) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-    
     //
-    // This assert is not valid if the adapter dispatch incoming
+    // This method is called for each dispatch, it only locks the shard
+    // of the identity. The manager mutex is only locked to look up the
+    // default servants if there's no servant registered for the
+    // identity and facet.
+    //
+    // The _instance assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
     // requests are received over the bidir connection after the
     // adapter was deactivated.
     //
-    //assert(_instance); // Must not be called after destruction.
+    {
+        Shard& s = shard(ident);
+        IceUtil::Mutex::Lock shardSync(s);
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    FacetMap::iterator q;
-    
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+        ServantMapMap::iterator p = s.servantMapMapHint;
+        FacetMap::iterator q;
 
-    if(p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
+        if(p == s.servantMapMap.end() || p->first != ident)
+        {
+            p = s.servantMapMap.find(ident);
+        }
+
+        if(p != s.servantMapMap.end() && (q = p->second.find(facet)) != p->second.end())
+        {
+            s.servantMapMapHint = p;
+            return q->second;
+        }
     }
-    
-    if(p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+
+    IceUtil::Mutex::Lock sync(*this);
+
+    DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+    if(p == _defaultServantMap.end())
     {
-        DefaultServantMap::const_iterator p = _defaultServantMap.find(ident.category);
+        p = _defaultServantMap.find("");
         if(p == _defaultServantMap.end())
         {
-            p = _defaultServantMap.find("");
-            if(p == _defaultServantMap.end())
-            {
-                return 0;
-            }
-            else
-            {
-                return p->second;
-            }
+            return 0;
         }
         else
         {
@@ -242,8 +256,7 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string& fa
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return p->second;
     }
 }
 
@@ -266,26 +279,23 @@ IceInternal::ServantManager::findDefaultServant(const string& category) const
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-    
-    assert(_instance); // Must not be called after destruction.
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ServantMapMap::iterator p = s.servantMapMapHint;
 
-    if(p == servantMapMap.end() || p->first != ident)
+    if(p == s.servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        p = s.servantMapMap.find(ident);
     }
     
-    if(p == servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
         return FacetMap();
     }
     else
     {
-        _servantMapMapHint = p;
+        s.servantMapMapHint = p;
         return p->second;
     }
 }
@@ -293,31 +303,29 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    IceUtil::Mutex::Lock sync(*this);
-    
     //
-    // This assert is not valid if the adapter dispatch incoming
+    // The _instance assert is not valid if the adapter dispatch incoming
     // requests from bidir connections. This method might be called if
     // requests are received over the bidir connection after the
     // adapter was deactivated.
     //
-    //assert(_instance); // Must not be called after destruction.
+    Shard& s = shard(ident);
+    IceUtil::Mutex::Lock shardSync(s);
 
-    ServantMapMap::iterator p = _servantMapMapHint;
-    ServantMapMap& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
+    ServantMapMap::iterator p = s.servantMapMapHint;
 
-    if(p == servantMapMap.end() || p->first != ident)
+    if(p == s.servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        p = s.servantMapMap.find(ident);
     }
     
-    if(p == servantMapMap.end())
+    if(p == s.servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
+        s.servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -418,10 +426,28 @@ IceInternal::ServantManager::findServantLocator(const string& category) const
     }
 }
 
+IceInternal::ServantManager::Shard&
+IceInternal::ServantManager::shard(const Identity& ident) const
+{
+    //
+    // FNV-1a hash of the identity.
+    //
+    unsigned int h = 2166136261U;
+    for(string::const_iterator p = ident.name.begin(); p != ident.name.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    h = (h ^ '/') * 16777619U;
+    for(string::const_iterator p = ident.category.begin(); p != ident.category.end(); ++p)
+    {
+        h = (h ^ static_cast<unsigned char>(*p)) * 16777619U;
+    }
+    return _shards[(h ^ (h >> 16)) % ShardCount];
+}
+
 IceInternal::ServantManager::ServantManager(const InstancePtr& instance, const string& adapterName)
     : _instance(instance),
       _adapterName(adapterName),
-      _servantMapMapHint(_servantMapMap.end()),
       _locatorMapHint(_locatorMap.end())
 {
 }
@@ -439,7 +465,7 @@ IceInternal::ServantManager::~ServantManager()
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    vector<ServantMapMap> servantMapMaps(ShardCount);
     map<string, ServantLocatorPtr> locatorMap;
     Ice::LoggerPtr logger;
 
@@ -454,8 +480,12 @@ IceInternal::ServantManager::destroy()
         }
         
         logger = _instance->initializationData().logger;
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for(int i = 0; i < ShardCount; ++i)
+        {
+            IceUtil::Mutex::Lock shardSync(_shards[i]);
+            servantMapMaps[i].swap(_shards[i].servantMapMap);
+            _shards[i].servantMapMapHint = _shards[i].servantMapMap.end();
+        }
         
         locatorMap.swap(_locatorMap);
         _locatorMapHint = _locatorMap.end();
@@ -490,6 +520,6 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors). 
     //
-    servantMapMap.clear();
+    servantMapMaps.clear();
     locatorMap.clear();
 }
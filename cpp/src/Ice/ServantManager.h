@@ -60,8 +60,28 @@ private:
     typedef std::map<Ice::Identity, Ice::FacetMap> ServantMapMap;
     typedef std::map<std::string, Ice::ObjectPtr> DefaultServantMap;
 
-    ServantMapMap _servantMapMap;
-    mutable ServantMapMap::iterator _servantMapMapHint;
+    //
+    // The servants are spread over shards by identity, each shard has
+    // its own mutex so that dispatch threads looking up servants only
+    // wait for each other when they hit the same shard. Operations that
+    // modify the servants also lock the servant manager mutex (before
+    // the shard mutex).
+    //
+    struct Shard : public IceUtil::Mutex
+    {
+        Shard() : servantMapMapHint(servantMapMap.end())
+        {
+        }
+
+        ServantMapMap servantMapMap;
+        ServantMapMap::iterator servantMapMapHint;
+    };
+
+    enum { ShardCount = 64 };
+
+    Shard& shard(const Ice::Identity&) const;
+
+    mutable Shard _shards[ShardCount];
 
     DefaultServantMap _defaultServantMap;
 
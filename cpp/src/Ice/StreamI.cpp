@@ -209,6 +209,12 @@ InputStreamI::read(const char*& vdata, size_t& vsize, string& holder)
     _is->read(vdata, vsize, holder);
 }
 
+void
+InputStreamI::readStringView(const char*& vdata, size_t& vsize)
+{
+    _is->readStringView(vdata, vsize);
+}
+
 void
 InputStreamI::read(vector<string>& v, bool convert)
 {
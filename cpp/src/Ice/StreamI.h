@@ -81,6 +81,7 @@ public:
     virtual void read(std::string&, bool = true);
     virtual void read(const char*&, size_t&);
     virtual void read(const char*&, size_t&, std::string&);
+    virtual void readStringView(const char*&, size_t&);
     virtual void read(std::vector<std::string>&, bool);
     virtual void read(std::wstring&);
     virtual void read(std::vector<bool>&);
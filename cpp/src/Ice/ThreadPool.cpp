@@ -18,6 +18,7 @@
 #include <Ice/ObjectAdapterFactory.h>
 #include <Ice/Properties.h>
 #include <Ice/TraceLevels.h>
+#include <Ice/FlightRecorderI.h>
 
 #if defined(ICE_OS_WINRT)
 #   include <IceUtil/StringConverter.h>
@@ -747,7 +748,13 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                     }
                     _nextHandler = _handlers.begin();
                     _selector.finishSelect();
+                    _selected = IceUtil::Time::now(IceUtil::Time::Monotonic);
                     select = false;
+                    if(_instance->flightRecorder())
+                    {
+                        _instance->flightRecorder()->record(FlightSelectorWakeup, this,
+                                                            static_cast<Ice::Int>(_handlers.size()));
+                    }
                 }
                 else if(!current._leader && followerWait(current))
                 {
@@ -820,6 +827,7 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
                 current._ioCompleted = false;
                 current._handler = _nextHandler->first;
                 current.operation = _nextHandler->second;
+                current.ready = _selected;
                 ++_nextHandler;
                 thread->setState(ThreadStateInUseForIO);
             }
@@ -937,11 +945,17 @@ IceInternal::ThreadPool::run(const EventHandlerThreadPtr& thread)
             }
         }
 
+        current.ready = IceUtil::Time::now(IceUtil::Time::Monotonic);
         {
             IceUtil::Monitor<IceUtil::Mutex>::Lock sync(*this);
             thread->setState(ThreadStateInUseForIO);
         }
 
+        if(_instance->flightRecorder())
+        {
+            _instance->flightRecorder()->record(FlightSelectorWakeup, this, 1);
+        }
+
         try
         {
             assert(current._handler);
@@ -1184,6 +1198,10 @@ IceInternal::ThreadPool::promoteFollower(ThreadPoolCurrent& current)
 {
     assert(!_promote && current._leader);
     _promote = true;
+    if(_instance->flightRecorder())
+    {
+        _instance->flightRecorder()->record(FlightFollowerPromoted, this, _inUse, _inUseIO);
+    }
     if(_inUseIO < _sizeIO && (_nextHandler != _handlers.end() || _inUseIO == 0))
     {
         notify();
@@ -159,6 +159,7 @@ private:
     std::vector<std::pair<EventHandler*, SocketOperation> > _handlers;
     std::vector<std::pair<EventHandler*, SocketOperation> >::const_iterator _nextHandler;
     std::set<EventHandler*> _pendingHandlers;
+    IceUtil::Time _selected; // The time the last select() returned.
 #endif
 
     bool _promote;
@@ -172,6 +173,7 @@ public:
 
     SocketOperation operation;
     BasicStream stream; // A per-thread stream to be used by event handlers for optimization.
+    IceUtil::Time ready; // The time the event handler was reported ready by the selector.
 
     bool ioCompleted() const
     {
@@ -0,0 +1,596 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Tracer.h>
+#include <Ice/Instance.h>
+#include <Ice/Properties.h>
+#include <Ice/Logger.h>
+#include <Ice/LoggerUtil.h>
+#include <Ice/LocalException.h>
+#include <IceUtil/Random.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceUtil::Shared* IceInternal::upCast(Tracer* p) { return p; }
+
+#if defined(_WIN32)
+extern "C" void WINAPI iceTraceBufferThreadDestructor(void*);
+#else
+extern "C" void iceTraceBufferThreadDestructor(void*);
+#endif
+
+namespace
+{
+
+typedef unsigned long long UInt64;
+
+string
+toHex(Long value)
+{
+    static const char* digits = "0123456789abcdef";
+    string result(16, '0');
+    UInt64 v = static_cast<UInt64>(value);
+    for(int i = 15; i >= 0 && v != 0; --i, v >>= 4)
+    {
+        result[i] = digits[v & 0xf];
+    }
+    return result;
+}
+
+bool
+fromHex(const string& s, string::size_type begin, string::size_type end, Long& value)
+{
+    if(end <= begin || end - begin > 16)
+    {
+        return false;
+    }
+
+    UInt64 v = 0;
+    for(string::size_type i = begin; i < end; ++i)
+    {
+        char c = s[i];
+        int digit;
+        if(c >= '0' && c <= '9')
+        {
+            digit = c - '0';
+        }
+        else if(c >= 'a' && c <= 'f')
+        {
+            digit = c - 'a' + 10;
+        }
+        else if(c >= 'A' && c <= 'F')
+        {
+            digit = c - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        v = (v << 4) | static_cast<UInt64>(digit);
+    }
+    value = static_cast<Long>(v);
+    return true;
+}
+
+string
+formatRecord(const TraceRecord& record)
+{
+    ostringstream os;
+    os << (record.dispatch ? "dispatch" : "invocation") << " trace=" << toHex(record.traceId)
+       << " span=" << toHex(record.spanId) << " parent=" << toHex(record.parentId)
+       << " operation=" << record.operation << " start=" << record.start;
+    if(record.dispatched > 0)
+    {
+        os << " dispatched=+" << record.dispatched - record.start << "us";
+    }
+    if(record.sent > 0)
+    {
+        os << " sent=+" << record.sent - record.start << "us";
+    }
+    if(record.replied > 0)
+    {
+        os << " replied=+" << record.replied - record.start << "us";
+    }
+    os << " end=+" << record.end - record.start << "us";
+    if(record.failed)
+    {
+        os << " failed";
+    }
+    return os.str();
+}
+
+//
+// The span of the dispatch in progress in the calling thread.
+//
+#if defined(ICE_OS_WINRT)
+
+const TraceRecord*
+getCurrent()
+{
+    return 0;
+}
+
+void
+setCurrent(const TraceRecord*)
+{
+}
+
+#else
+
+bool currentKeyInitialized = false;
+#   if defined(_WIN32)
+DWORD currentKey;
+#   else
+pthread_key_t currentKey;
+#   endif
+
+class Init
+{
+public:
+
+    Init()
+    {
+        //
+        // The key is never deleted, dispatches can still be in progress
+        // when static objects are destroyed.
+        //
+#   if defined(_WIN32)
+        currentKey = TlsAlloc();
+        currentKeyInitialized = currentKey != TLS_OUT_OF_INDEXES;
+#   else
+        currentKeyInitialized = pthread_key_create(&currentKey, 0) == 0;
+#   endif
+    }
+};
+
+Init init;
+
+const TraceRecord*
+getCurrent()
+{
+    if(!currentKeyInitialized)
+    {
+        return 0;
+    }
+#   if defined(_WIN32)
+    return static_cast<const TraceRecord*>(TlsGetValue(currentKey));
+#   else
+    return static_cast<const TraceRecord*>(pthread_getspecific(currentKey));
+#   endif
+}
+
+void
+setCurrent(const TraceRecord* record)
+{
+    if(currentKeyInitialized)
+    {
+#   if defined(_WIN32)
+        TlsSetValue(currentKey, const_cast<TraceRecord*>(record));
+#   else
+        pthread_setspecific(currentKey, record);
+#   endif
+    }
+}
+
+#endif
+
+}
+
+extern "C" void
+#if defined(_WIN32)
+WINAPI
+#endif
+iceTraceBufferThreadDestructor(void* p)
+{
+    //
+    // The buffer is released by the tracer once it's drained.
+    //
+    if(p)
+    {
+        static_cast<TraceBuffer*>(p)->orphaned();
+    }
+}
+
+IceInternal::TraceBuffer::TraceBuffer(size_t size) :
+    _mask(static_cast<unsigned int>(size - 1)),
+    _head(0),
+    _tail(0),
+    _orphaned(0)
+{
+    assert((size & (size - 1)) == 0);
+    _records.resize(size);
+}
+
+bool
+IceInternal::TraceBuffer::push(const TraceRecord& record)
+{
+    unsigned int head = static_cast<unsigned int>(_head.load());
+    if(head - static_cast<unsigned int>(_tail.load()) > _mask)
+    {
+        return false;
+    }
+    _records[head & _mask] = record;
+    _head.fetch_add(1); // Publishes the record.
+    return true;
+}
+
+void
+IceInternal::TraceBuffer::drain(vector<TraceRecord>& records)
+{
+    unsigned int tail = static_cast<unsigned int>(_tail.load());
+    unsigned int head = static_cast<unsigned int>(_head.load());
+    for(; tail != head; ++tail)
+    {
+        records.push_back(_records[tail & _mask]);
+    }
+    _tail.exchange(static_cast<int>(tail)); // Releases the slots.
+}
+
+void
+IceInternal::TraceBuffer::orphaned()
+{
+    _orphaned.exchange(1);
+}
+
+bool
+IceInternal::TraceBuffer::isOrphaned() const
+{
+    return _orphaned.load() != 0;
+}
+
+IceInternal::Tracer::Tracer(const PropertiesPtr& properties, const LoggerPtr& logger) :
+    _logger(logger),
+    _sample(static_cast<unsigned int>(max(properties->getPropertyAsInt("Ice.Tracing.Sample"), 0))),
+    _bufferSize(static_cast<size_t>(max(properties->getPropertyAsIntWithDefault("Ice.Tracing.BufferSize", 1024),
+                                        16))),
+    _flushInterval(IceUtil::Time::milliSeconds(
+                       max(properties->getPropertyAsIntWithDefault("Ice.Tracing.FlushInterval", 1000), 10))),
+    _idSeed(0),
+    _idCount(0),
+    _sampleCount(0),
+    _dropped(0),
+    _keyInitialized(false)
+{
+    //
+    // The span ids are unique in the process, they are derived from a
+    // random seed so that they are also unlikely to collide with the
+    // ids of other processes.
+    //
+    IceUtilInternal::generateRandom(reinterpret_cast<char*>(&_idSeed), sizeof(Long));
+
+    size_t bufferSize = 1;
+    while(bufferSize < _bufferSize)
+    {
+        bufferSize <<= 1;
+    }
+    const_cast<size_t&>(_bufferSize) = bufferSize;
+
+    string file = properties->getProperty("Ice.Tracing.File");
+    if(!file.empty())
+    {
+        _out.open(file, fstream::out | fstream::app);
+        if(!_out.is_open())
+        {
+            throw InitializationException(__FILE__, __LINE__, "Tracer: cannot open " + file);
+        }
+    }
+
+#if !defined(ICE_OS_WINRT)
+#   if defined(_WIN32)
+    _key = FlsAlloc(&iceTraceBufferThreadDestructor);
+    _keyInitialized = _key != FLS_OUT_OF_INDEXES;
+#   else
+    _keyInitialized = pthread_key_create(&_key, &iceTraceBufferThreadDestructor) == 0;
+#   endif
+#endif
+    if(!_keyInitialized)
+    {
+        _sharedBuffer = new TraceBuffer(_bufferSize);
+        _buffers.push_back(_sharedBuffer);
+    }
+}
+
+IceInternal::Tracer::~Tracer()
+{
+    //
+    // Once the key is deleted, the destructor is no longer called
+    // for the buffers of the threads which are still running.
+    //
+    if(_keyInitialized)
+    {
+#if defined(_WIN32)
+        FlsFree(_key);
+#else
+        pthread_key_delete(_key);
+#endif
+    }
+}
+
+void
+IceInternal::Tracer::start(const IceUtil::TimerPtr& timer)
+{
+    IceUtil::Mutex::Lock sync(_flushMutex);
+    _timer = timer;
+    _timer->scheduleRepeated(this, _flushInterval);
+}
+
+void
+IceInternal::Tracer::destroy()
+{
+    {
+        IceUtil::Mutex::Lock sync(_flushMutex);
+        if(_timer)
+        {
+            _timer->cancel(this);
+            _timer = 0;
+        }
+    }
+    flush();
+}
+
+Long
+IceInternal::Tracer::newId()
+{
+    //
+    // The SplitMix64 finalizer is a bijection, the ids don't repeat
+    // until the counter wraps around.
+    //
+    UInt64 z = static_cast<UInt64>(_idSeed) + static_cast<unsigned int>(_idCount.fetch_add(1));
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z = z ^ (z >> 31);
+    return z == 0 ? 1 : static_cast<Long>(z);
+}
+
+void
+IceInternal::Tracer::record(const TraceRecord& record)
+{
+    bool pushed;
+    if(_keyInitialized)
+    {
+        pushed = getBuffer()->push(record);
+    }
+    else
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        pushed = _sharedBuffer->push(record);
+    }
+
+    if(!pushed)
+    {
+        _dropped.fetch_add(1);
+    }
+}
+
+void
+IceInternal::Tracer::runTimerTask()
+{
+    flush();
+}
+
+TraceBuffer*
+IceInternal::Tracer::getBuffer()
+{
+#if defined(_WIN32)
+    TraceBuffer* buffer = static_cast<TraceBuffer*>(FlsGetValue(_key));
+#else
+    TraceBuffer* buffer = static_cast<TraceBuffer*>(pthread_getspecific(_key));
+#endif
+    if(!buffer)
+    {
+        TraceBufferPtr b = new TraceBuffer(_bufferSize);
+        {
+            IceUtil::Mutex::Lock sync(*this);
+            _buffers.push_back(b);
+        }
+        buffer = b.get();
+#if defined(_WIN32)
+        FlsSetValue(_key, buffer);
+#else
+        pthread_setspecific(_key, buffer);
+#endif
+    }
+    return buffer;
+}
+
+void
+IceInternal::Tracer::flush()
+{
+    IceUtil::Mutex::Lock flushSync(_flushMutex);
+
+    vector<TraceBufferPtr> buffers;
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        buffers = _buffers;
+    }
+
+    vector<TraceBuffer*> orphaned;
+    for(vector<TraceBufferPtr>::const_iterator p = buffers.begin(); p != buffers.end(); ++p)
+    {
+        //
+        // An orphaned buffer doesn't get new spans, it's released once
+        // it's drained.
+        //
+        if((*p)->isOrphaned())
+        {
+            orphaned.push_back(p->get());
+        }
+        (*p)->drain(_records);
+    }
+
+    if(!orphaned.empty())
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        for(vector<TraceBuffer*>::const_iterator p = orphaned.begin(); p != orphaned.end(); ++p)
+        {
+            for(vector<TraceBufferPtr>::iterator q = _buffers.begin(); q != _buffers.end(); ++q)
+            {
+                if(q->get() == *p)
+                {
+                    _buffers.erase(q);
+                    break;
+                }
+            }
+        }
+    }
+
+    for(vector<TraceRecord>::const_iterator p = _records.begin(); p != _records.end(); ++p)
+    {
+        if(_out.is_open())
+        {
+            _out << formatRecord(*p) << '\n';
+        }
+        else
+        {
+            _logger->trace("Tracing", formatRecord(*p));
+        }
+    }
+    if(_out.is_open() && !_records.empty())
+    {
+        _out.flush();
+    }
+    _records.clear();
+
+    int dropped = _dropped.exchange(0);
+    if(dropped > 0)
+    {
+        Warning out(_logger);
+        out << "Tracer: " << dropped << " spans were dropped, consider increasing Ice.Tracing.BufferSize";
+    }
+}
+
+IceInternal::TraceScope::TraceScope(const TraceSpan& span) :
+    _previous(0),
+    _set(span.isStarted())
+{
+    if(_set)
+    {
+        _previous = getCurrent();
+        setCurrent(&span.getRecord());
+    }
+}
+
+IceInternal::TraceScope::~TraceScope()
+{
+    if(_set)
+    {
+        setCurrent(_previous);
+    }
+}
+
+void
+IceInternal::TraceSpan::startInvocation(Instance* instance, const string& operation)
+{
+    const TracerPtr& tracer = instance->tracer();
+    if(!tracer)
+    {
+        return;
+    }
+
+    const TraceRecord* parent = getCurrent();
+    if(parent)
+    {
+        _record.traceId = parent->traceId;
+        _record.parentId = parent->spanId;
+    }
+    else if(tracer->sample())
+    {
+        _record.traceId = tracer->newId();
+        _record.parentId = 0;
+    }
+    else
+    {
+        return;
+    }
+
+    _tracer = tracer;
+    _record.spanId = tracer->newId();
+    _record.operation = operation;
+    _record.dispatch = false;
+    _record.failed = false;
+    _record.start = now();
+    _record.sent = 0;
+    _record.replied = 0;
+    _record.dispatched = 0;
+    _record.end = 0;
+}
+
+void
+IceInternal::TraceSpan::startDispatch(Instance* instance, const string& operation, Context& ctx,
+                                      const IceUtil::Time& received)
+{
+    const TracerPtr& tracer = instance->tracer();
+    if(!tracer)
+    {
+        return;
+    }
+
+    Context::iterator p = ctx.find(traceContextKey);
+    if(p == ctx.end())
+    {
+        return;
+    }
+
+    string::size_type pos = p->second.find('-');
+    bool valid = pos != string::npos && fromHex(p->second, 0, pos, _record.traceId) &&
+        fromHex(p->second, pos + 1, p->second.size(), _record.parentId);
+    ctx.erase(p);
+    if(!valid)
+    {
+        return;
+    }
+
+    _tracer = tracer;
+    _record.spanId = tracer->newId();
+    _record.operation = operation;
+    _record.dispatch = true;
+    _record.failed = false;
+    _record.dispatched = now();
+    _record.start = _record.dispatched;
+    if(received != IceUtil::Time())
+    {
+        //
+        // The receive time is monotonic, the span records wall clock
+        // times.
+        //
+        _record.start -= (IceUtil::Time::now(IceUtil::Time::Monotonic) - received).toMicroSeconds();
+    }
+    _record.sent = 0;
+    _record.replied = 0;
+    _record.end = 0;
+}
+
+void
+IceInternal::TraceSpan::finish()
+{
+    if(_tracer)
+    {
+        _record.end = now();
+        _tracer->record(_record);
+        _tracer = 0;
+    }
+}
+
+void
+IceInternal::TraceSpan::adopt(TraceSpan& other)
+{
+    _tracer = other._tracer;
+    other._tracer = 0;
+    _record = other._record;
+}
+
+void
+IceInternal::TraceSpan::writeContext(Context& ctx) const
+{
+    ctx[traceContextKey] = toHex(_record.traceId) + "-" + toHex(_record.spanId);
+}
@@ -0,0 +1,146 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef ICE_TRACER_H
+#define ICE_TRACER_H
+
+#include <IceUtil/Shared.h>
+#include <IceUtil/Mutex.h>
+#include <IceUtil/Atomic.h>
+#include <IceUtil/Timer.h>
+#include <IceUtil/FileUtil.h>
+#include <Ice/TraceSpan.h>
+#include <Ice/LoggerF.h>
+#include <Ice/PropertiesF.h>
+
+#include <vector>
+
+#ifndef _WIN32
+#   include <pthread.h>
+#endif
+
+namespace IceInternal
+{
+
+//
+// The trace of a request is carried in its context as the trace and
+// parent span ids, in hexadecimal and separated by a dash.
+//
+const char* const traceContextKey = "_trace";
+
+//
+// A ring buffer of spans, with a single producer thread and the tracer
+// as the single consumer.
+//
+class TraceBuffer : public IceUtil::Shared
+{
+public:
+
+    TraceBuffer(size_t);
+
+    //
+    // Returns false if the buffer is full.
+    //
+    bool push(const TraceRecord&);
+    void drain(std::vector<TraceRecord>&);
+
+    void orphaned();
+    bool isOrphaned() const;
+
+private:
+
+    std::vector<TraceRecord> _records;
+    const unsigned int _mask;
+    IceUtilInternal::Atomic _head;
+    IceUtilInternal::Atomic _tail;
+    IceUtilInternal::Atomic _orphaned;
+};
+typedef IceUtil::Handle<TraceBuffer> TraceBufferPtr;
+
+//
+// The tracer of a communicator, configured with the Ice.Tracing.*
+// properties. The spans are recorded in per-thread buffers without
+// locking, the buffers are drained periodically by a timer task which
+// writes the spans to the Ice.Tracing.File file or to the logger.
+// Spans are dropped if a buffer fills up before it's drained.
+//
+class Tracer : public IceUtil::TimerTask, private IceUtil::Mutex
+{
+public:
+
+    Tracer(const Ice::PropertiesPtr&, const Ice::LoggerPtr&);
+    ~Tracer();
+
+    void start(const IceUtil::TimerPtr&);
+    void destroy();
+
+    //
+    // Returns true if a new trace should be started for an invocation.
+    //
+    bool sample()
+    {
+        return _sample > 0 && static_cast<unsigned int>(_sampleCount.fetch_add(1)) % _sample == 0;
+    }
+
+    Ice::Long newId();
+
+    void record(const TraceRecord&);
+
+    virtual void runTimerTask();
+
+private:
+
+    TraceBuffer* getBuffer();
+    void flush();
+
+    const Ice::LoggerPtr _logger;
+    const unsigned int _sample;
+    const size_t _bufferSize;
+    const IceUtil::Time _flushInterval;
+    Ice::Long _idSeed;
+    IceUtilInternal::Atomic _idCount;
+    IceUtilInternal::Atomic _sampleCount;
+    IceUtilInternal::Atomic _dropped;
+
+    bool _keyInitialized;
+#if defined(_WIN32)
+    DWORD _key;
+#else
+    pthread_key_t _key;
+#endif
+    std::vector<TraceBufferPtr> _buffers;
+    TraceBufferPtr _sharedBuffer;
+
+    IceUtil::Mutex _flushMutex;
+    IceUtil::TimerPtr _timer;
+    IceUtilInternal::ofstream _out;
+    std::vector<TraceRecord> _records;
+};
+
+//
+// Makes the span of a dispatch the current span of the calling thread
+// for the lifetime of the object, nested invocations made from the
+// dispatch thread then belong to the same trace.
+//
+class TraceScope : private IceUtil::noncopyable
+{
+public:
+
+    TraceScope(const TraceSpan&);
+    ~TraceScope();
+
+private:
+
+    const TraceRecord* _previous;
+    bool _set;
+};
+
+}
+
+#endif
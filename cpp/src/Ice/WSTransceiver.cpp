@@ -21,6 +21,10 @@
 #include <IceUtil/SHA1.h>
 #include <IceUtil/StringUtil.h>
 
+#ifdef ICE_HAS_ZLIB
+#  include <zlib.h>
+#endif
+
 #include <IceUtil/DisableWarnings.h>
 
 // Python 2.7 under Windows.
@@ -56,6 +60,9 @@ using namespace IceInternal;
 #define OP_RES_0xE  0xE     // Reserved
 #define OP_RES_0xF  0xF     // Reserved
 #define FLAG_FINAL  0x80    // Last frame
+#define FLAG_RSV1   0x40    // Reserved, set on the first frame of a compressed message
+#define FLAG_RSV2   0x20    // Reserved
+#define FLAG_RSV3   0x10    // Reserved
 #define FLAG_MASKED 0x80    // Payload is masked
 
 #define CLOSURE_NORMAL         1000
@@ -68,6 +75,56 @@ namespace
 
 const string _iceProtocol = "ice.zeroc.com";
 const string _wsUUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+const string _deflateExtension = "permessage-deflate";
+
+//
+// Messages smaller than this aren't compressed, a compressed message
+// must be sent with a single deflate block which isn't worth it for
+// small messages.
+//
+const size_t _deflateThreshold = 100;
+
+#ifdef ICE_HAS_ZLIB
+//
+// Parse the value of a window bits parameter, returns -1 if the value is invalid.
+//
+int
+parseWindowBits(const string& value)
+{
+    if(value.empty() || value.size() > 2 || value.find_first_not_of("0123456789") != string::npos || value[0] == '0')
+    {
+        return -1;
+    }
+    int bits = atoi(value.c_str());
+    return bits >= 8 && bits <= 15 ? bits : -1;
+}
+
+//
+// zlib doesn't support a window size of 256 bytes (8 bits) for raw deflate
+// streams so the configured window size is restricted to [9, 15].
+//
+int
+getWindowBits(const PropertiesPtr& properties, const string& name)
+{
+    int bits = properties->getPropertyAsIntWithDefault(name, 15);
+    if(bits < 9)
+    {
+        bits = 9;
+    }
+    else if(bits > 15)
+    {
+        bits = 15;
+    }
+    return bits;
+}
+
+string
+getZError(int err)
+{
+    const char* msg = zError(err);
+    return msg ? string(": ") + msg : string();
+}
+#endif
 
 //
 // Rename to avoid conflict with OS 10.10 htonll
@@ -252,7 +309,14 @@ IceInternal::WSTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer,
                 vector<unsigned char> key(16);
                 IceUtilInternal::generateRandom(reinterpret_cast<char*>(&key[0]), key.size());
                 _key = IceInternal::Base64::encode(key);
-                out << _key << "\r\n\r\n"; // EOM
+                out << _key << "\r\n";
+
+                string extensions = deflateOffer();
+                if(!extensions.empty())
+                {
+                    out << "Sec-WebSocket-Extensions: " << extensions << "\r\n";
+                }
+                out << "\r\n"; // EOM
 
                 string str = out.str();
                 _writeBuffer.b.resize(str.size());
@@ -502,9 +566,11 @@ IceInternal::WSTransceiver::write(Buffer& buf)
         }
     }
 
+    bool more;
     do
     {
-        if(preWrite(buf))
+        Buffer& payload = writePayload(buf);
+        if(preWrite(payload))
         {
             if(_writeBuffer.i < _writeBuffer.b.end())
             {
@@ -514,17 +580,19 @@ IceInternal::WSTransceiver::write(Buffer& buf)
                     return s;
                 }
             }
-            else if(_incoming && !buf.b.empty() && _writeState == WriteStatePayload)
+            else if(_incoming && !payload.b.empty() && _writeState == WriteStatePayload)
             {
-                SocketOperation s = _delegate->write(buf);
+                SocketOperation s = _delegate->write(payload);
                 if(s)
                 {
                     return s;
                 }
             }
         }
+        more = postWrite(payload);
+        finishPayload(buf);
     }
-    while(postWrite(buf));
+    while(more);
 
     if(_state == StateClosingResponsePending && !_closingInitiator)
     {
@@ -566,7 +634,7 @@ IceInternal::WSTransceiver::read(Buffer& buf, bool& hasMoreData)
     //
     if(buf.i == buf.b.end())
     {
-        hasMoreData |= _readI < _readBuffer.i;
+        hasMoreData |= _readI < _readBuffer.i || inflatePending();
         return SocketOperationNone;
     }
 
@@ -611,7 +679,7 @@ IceInternal::WSTransceiver::read(Buffer& buf, bool& hasMoreData)
 
     if(buf.i == buf.b.end())
     {
-        hasMoreData |= _readI < _readBuffer.i;
+        hasMoreData |= _readI < _readBuffer.i || inflatePending();
         s = SocketOperationNone;
     }
     else
@@ -649,7 +717,8 @@ IceInternal::WSTransceiver::startWrite(Buffer& buf)
         }
     }
 
-    if(preWrite(buf))
+    Buffer& payload = writePayload(buf);
+    if(preWrite(payload))
     {
         if(_writeBuffer.i < _writeBuffer.b.end())
         {
@@ -659,7 +728,7 @@ IceInternal::WSTransceiver::startWrite(Buffer& buf)
         else
         {
             assert(_incoming);
-            return _delegate->startWrite(buf);
+            return _delegate->startWrite(payload);
         }
     }
     else
@@ -686,17 +755,19 @@ IceInternal::WSTransceiver::finishWrite(Buffer& buf)
         return;
     }
 
+    Buffer& payload = _writeCompressed ? _writeDeflated : buf;
     if(_writeBuffer.i < _writeBuffer.b.end())
     {
         _delegate->finishWrite(_writeBuffer);
     }
-    else if(!buf.b.empty() && buf.i != buf.b.end())
+    else if(!payload.b.empty() && payload.i != payload.b.end())
     {
         assert(_incoming);
-        _delegate->finishWrite(buf);
+        _delegate->finishWrite(payload);
     }
 
-    postWrite(buf);
+    postWrite(payload);
+    finishPayload(buf);
 }
 
 void
@@ -840,7 +911,15 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
-    _closingReason(CLOSURE_NORMAL)
+    _closingReason(CLOSURE_NORMAL),
+    _deflate(false),
+    _deflateOffered(false),
+    _deflateNoContextTakeover(false),
+    _deflateStream(0),
+    _inflateStream(0),
+    _readCompressed(false),
+    _readPayloadOffset(0),
+    _writeCompressed(false)
 {
     //
     // Use 1KB read and 16KB write buffer sizes. We use 16KB for the
@@ -869,7 +948,15 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
     _readPending(false),
     _writePending(false),
     _closingInitiator(false),
-    _closingReason(CLOSURE_NORMAL)
+    _closingReason(CLOSURE_NORMAL),
+    _deflate(false),
+    _deflateOffered(false),
+    _deflateNoContextTakeover(false),
+    _deflateStream(0),
+    _inflateStream(0),
+    _readCompressed(false),
+    _readPayloadOffset(0),
+    _writeCompressed(false)
 {
     //
     // Use 1KB read and write buffer sizes.
@@ -878,6 +965,18 @@ IceInternal::WSTransceiver::WSTransceiver(const ProtocolInstancePtr& instance, c
 
 IceInternal::WSTransceiver::~WSTransceiver()
 {
+#ifdef ICE_HAS_ZLIB
+    if(_deflateStream)
+    {
+        deflateEnd(_deflateStream);
+        delete _deflateStream;
+    }
+    if(_inflateStream)
+    {
+        inflateEnd(_inflateStream);
+        delete _inflateStream;
+    }
+#endif
 }
 
 void
@@ -987,6 +1086,12 @@ IceInternal::WSTransceiver::handleRequest(Buffer& responseBuffer)
         out << "Sec-WebSocket-Protocol: " << _iceProtocol << "\r\n";
     }
 
+    string extensions = acceptDeflateOffer();
+    if(!extensions.empty())
+    {
+        out << "Sec-WebSocket-Extensions: " << extensions << "\r\n";
+    }
+
     //
     // The response includes:
     //
@@ -1103,6 +1208,421 @@ IceInternal::WSTransceiver::handleResponse()
     {
         throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Accept");
     }
+
+    //
+    // "If the response includes a |Sec-WebSocket-Extensions| header
+    //  field and this header field indicates the use of an extension
+    //  that was not present in the client's handshake (the server has
+    //  indicated an extension not requested by the client), the client
+    //  MUST _Fail the WebSocket Connection_."
+    //
+    checkDeflateResponse();
+}
+
+string
+IceInternal::WSTransceiver::deflateOffer()
+{
+#ifdef ICE_HAS_ZLIB
+    const PropertiesPtr properties = _instance->properties();
+    if(properties->getPropertyAsInt("Ice.WS.PerMessageDeflate") <= 0)
+    {
+        return string();
+    }
+
+    //
+    // We always advertise the client_max_window_bits parameter since
+    // we can use any window size the server asks for.
+    //
+    ostringstream out;
+    out << _deflateExtension << "; client_max_window_bits";
+    int clientMaxWindowBits = getWindowBits(properties, "Ice.WS.PerMessageDeflate.ClientMaxWindowBits");
+    if(clientMaxWindowBits < 15)
+    {
+        out << "=" << clientMaxWindowBits;
+    }
+    int serverMaxWindowBits = getWindowBits(properties, "Ice.WS.PerMessageDeflate.ServerMaxWindowBits");
+    if(serverMaxWindowBits < 15)
+    {
+        out << "; server_max_window_bits=" << serverMaxWindowBits;
+    }
+    if(properties->getPropertyAsInt("Ice.WS.PerMessageDeflate.ClientNoContextTakeover") > 0)
+    {
+        out << "; client_no_context_takeover";
+    }
+    if(properties->getPropertyAsInt("Ice.WS.PerMessageDeflate.ServerNoContextTakeover") > 0)
+    {
+        out << "; server_no_context_takeover";
+    }
+    _deflateOffered = true;
+    return out.str();
+#else
+    return string();
+#endif
+}
+
+string
+IceInternal::WSTransceiver::acceptDeflateOffer()
+{
+#ifdef ICE_HAS_ZLIB
+    const PropertiesPtr properties = _instance->properties();
+    HeaderTokenSeq offers;
+    if(properties->getPropertyAsInt("Ice.WS.PerMessageDeflate") <= 0 ||
+       !_parser->getHeaderTokens("Sec-WebSocket-Extensions", offers))
+    {
+        return string();
+    }
+
+    const bool serverNoContextTakeover =
+        properties->getPropertyAsInt("Ice.WS.PerMessageDeflate.ServerNoContextTakeover") > 0;
+    const bool clientNoContextTakeover =
+        properties->getPropertyAsInt("Ice.WS.PerMessageDeflate.ClientNoContextTakeover") > 0;
+    const int serverMaxWindowBits = getWindowBits(properties, "Ice.WS.PerMessageDeflate.ServerMaxWindowBits");
+    const int clientMaxWindowBits = getWindowBits(properties, "Ice.WS.PerMessageDeflate.ClientMaxWindowBits");
+
+    //
+    // Accept the first permessage-deflate offer that we support, the
+    // offers are listed by order of preference.
+    //
+    for(HeaderTokenSeq::const_iterator p = offers.begin(); p != offers.end(); ++p)
+    {
+        if(p->name != _deflateExtension)
+        {
+            continue;
+        }
+
+        bool accept = true;
+        bool serverReset = serverNoContextTakeover;
+        bool clientReset = clientNoContextTakeover;
+        int serverBits = serverMaxWindowBits;
+        int clientBits = 0; // The client doesn't support client_max_window_bits
+        for(map<string, string>::const_iterator q = p->params.begin(); q != p->params.end() && accept; ++q)
+        {
+            if(q->first == "server_no_context_takeover" && q->second.empty())
+            {
+                serverReset = true;
+            }
+            else if(q->first == "client_no_context_takeover" && q->second.empty())
+            {
+                clientReset = true;
+            }
+            else if(q->first == "server_max_window_bits")
+            {
+                int bits = parseWindowBits(q->second);
+                if(bits < 9)
+                {
+                    accept = false; // Invalid value or window size not supported by zlib.
+                }
+                serverBits = min(serverBits, bits);
+            }
+            else if(q->first == "client_max_window_bits")
+            {
+                clientBits = q->second.empty() ? 15 : parseWindowBits(q->second);
+                accept = clientBits > 0;
+            }
+            else
+            {
+                accept = false; // Unknown parameter.
+            }
+        }
+
+        if(!accept)
+        {
+            continue;
+        }
+
+        initDeflate(serverReset, serverBits);
+
+        ostringstream out;
+        out << _deflateExtension;
+        if(serverReset)
+        {
+            out << "; server_no_context_takeover";
+        }
+        if(clientReset)
+        {
+            out << "; client_no_context_takeover";
+        }
+        if(serverBits < 15)
+        {
+            out << "; server_max_window_bits=" << serverBits;
+        }
+        if(clientBits > 0 && clientMaxWindowBits < clientBits)
+        {
+            out << "; client_max_window_bits=" << clientMaxWindowBits;
+        }
+        return out.str();
+    }
+#endif
+    return string();
+}
+
+void
+IceInternal::WSTransceiver::checkDeflateResponse()
+{
+    string val;
+    HeaderTokenSeq extensions;
+    if(!_parser->getHeader("Sec-WebSocket-Extensions", val, false) ||
+       !_parser->getHeaderTokens("Sec-WebSocket-Extensions", extensions))
+    {
+        return;
+    }
+
+    if(!_deflateOffered || extensions.size() != 1 || extensions[0].name != _deflateExtension)
+    {
+        throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Extensions");
+    }
+
+#ifdef ICE_HAS_ZLIB
+    const PropertiesPtr properties = _instance->properties();
+    bool clientReset = properties->getPropertyAsInt("Ice.WS.PerMessageDeflate.ClientNoContextTakeover") > 0;
+    int clientBits = getWindowBits(properties, "Ice.WS.PerMessageDeflate.ClientMaxWindowBits");
+    const map<string, string>& params = extensions[0].params;
+    for(map<string, string>::const_iterator p = params.begin(); p != params.end(); ++p)
+    {
+        if(p->first == "server_no_context_takeover" && p->second.empty())
+        {
+            //
+            // Nothing to do, the inflate context is kept in any case.
+            //
+        }
+        else if(p->first == "client_no_context_takeover" && p->second.empty())
+        {
+            clientReset = true;
+        }
+        else if(p->first == "server_max_window_bits" && parseWindowBits(p->second) > 0)
+        {
+            //
+            // Nothing to do, we always inflate with the largest window size.
+            //
+        }
+        else if(p->first == "client_max_window_bits" && parseWindowBits(p->second) > 0)
+        {
+            int bits = parseWindowBits(p->second);
+            if(bits < 9)
+            {
+                throw WebSocketException("unsupported value `" + val + "' for Sec-WebSocket-Extensions");
+            }
+            clientBits = min(clientBits, bits);
+        }
+        else
+        {
+            throw WebSocketException("invalid value `" + val + "' for Sec-WebSocket-Extensions");
+        }
+    }
+    initDeflate(clientReset, clientBits);
+#endif
+}
+
+void
+IceInternal::WSTransceiver::initDeflate(bool noContextTakeover, int windowBits)
+{
+#ifdef ICE_HAS_ZLIB
+    assert(!_deflateStream && !_inflateStream);
+
+    //
+    // Negative window bits select a raw deflate stream without the zlib
+    // header and trailer. We always inflate with the largest window size
+    // to support any window size used by the peer.
+    //
+    _deflateStream = new z_stream;
+    memset(_deflateStream, 0, sizeof(z_stream));
+    int err = deflateInit2(_deflateStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -windowBits, 8, Z_DEFAULT_STRATEGY);
+    if(err != Z_OK)
+    {
+        throw CompressionException(__FILE__, __LINE__, "deflateInit2 failed" + getZError(err));
+    }
+
+    _inflateStream = new z_stream;
+    memset(_inflateStream, 0, sizeof(z_stream));
+    err = inflateInit2(_inflateStream, -15);
+    if(err != Z_OK)
+    {
+        throw CompressionException(__FILE__, __LINE__, "inflateInit2 failed" + getZError(err));
+    }
+
+    _deflateNoContextTakeover = noContextTakeover;
+    _deflate = true;
+
+    if(_instance->traceLevel() >= 2)
+    {
+        Trace out(_instance->logger(), _instance->traceCategory());
+        out << "using " << _deflateExtension << " extension with a window size of " << windowBits << " bits";
+        if(noContextTakeover)
+        {
+            out << " and no context takeover";
+        }
+        out << "\n" << toString();
+    }
+#else
+    assert(false); // The extension is never offered or accepted.
+#endif
+}
+
+void
+IceInternal::WSTransceiver::deflateMessage(const Buffer& buf)
+{
+#ifdef ICE_HAS_ZLIB
+    assert(_deflate && !buf.b.empty());
+
+    //
+    // Compress the message and flush the compressed data to a byte
+    // boundary with Z_SYNC_FLUSH. The output ends with an empty stored
+    // block (0x00 0x00 0xff 0xff) which is removed as required by RFC
+    // 7692, the receiver adds it back before inflating the message.
+    //
+    _writeDeflated.b.resize(deflateBound(_deflateStream, static_cast<uLong>(buf.b.size())) + 16);
+    _deflateStream->next_in = const_cast<Bytef*>(&buf.b[0]);
+    _deflateStream->avail_in = static_cast<uInt>(buf.b.size());
+    size_t pos = 0;
+    while(true)
+    {
+        _deflateStream->next_out = &_writeDeflated.b[0] + pos;
+        _deflateStream->avail_out = static_cast<uInt>(_writeDeflated.b.size() - pos);
+        int err = ::deflate(_deflateStream, Z_SYNC_FLUSH);
+        if(err != Z_OK && err != Z_BUF_ERROR)
+        {
+            throw CompressionException(__FILE__, __LINE__, "deflate failed" + getZError(err));
+        }
+        pos = _writeDeflated.b.size() - _deflateStream->avail_out;
+        if(_deflateStream->avail_out > 0)
+        {
+            break;
+        }
+        _writeDeflated.b.resize(_writeDeflated.b.size() * 2);
+    }
+    assert(_deflateStream->avail_in == 0 && pos > 4);
+    _writeDeflated.b.resize(pos - 4);
+    _writeDeflated.i = _writeDeflated.b.begin();
+
+    if(_deflateNoContextTakeover)
+    {
+        deflateReset(_deflateStream);
+    }
+#endif
+}
+
+bool
+IceInternal::WSTransceiver::inflatePayload(Buffer& buf)
+{
+#ifdef ICE_HAS_ZLIB
+    assert(_deflate && _readState == ReadStateCompressedPayload);
+
+    //
+    // Move the payload data read so far to the inflate buffer once the
+    // previous data is consumed, the data is unmasked if necessary. The
+    // empty stored block removed by the sender (0x00 0x00 0xff 0xff)
+    // is added back after the payload of the last frame.
+    //
+    if(_readDeflated.i == _readDeflated.b.end() && _readPayloadLength > 0)
+    {
+        if(!readBuffered(1))
+        {
+            return true;
+        }
+
+        static const Byte trailer[] = { 0x00, 0x00, 0xff, 0xff };
+        size_t n = min(static_cast<size_t>(_readBuffer.i - _readI), _readPayloadLength);
+        bool last = _readLastFrame && n == _readPayloadLength;
+        _readDeflated.b.resize(last ? n + sizeof(trailer) : n);
+        if(_incoming)
+        {
+            for(size_t k = 0; k < n; ++k, ++_readPayloadOffset)
+            {
+                _readDeflated.b[k] = _readI[k] ^ _readMask[_readPayloadOffset % 4];
+            }
+        }
+        else
+        {
+            memcpy(&_readDeflated.b[0], _readI, n);
+        }
+        if(last)
+        {
+            memcpy(&_readDeflated.b[0] + n, trailer, sizeof(trailer));
+        }
+        _readDeflated.i = _readDeflated.b.begin();
+        _readI += n;
+        _readPayloadLength -= n;
+    }
+
+    _inflateStream->next_in = _readDeflated.i;
+    _inflateStream->avail_in = static_cast<uInt>(_readDeflated.b.end() - _readDeflated.i);
+    _inflateStream->next_out = buf.i;
+    _inflateStream->avail_out = static_cast<uInt>(buf.b.end() - buf.i);
+    int err = ::inflate(_inflateStream, Z_SYNC_FLUSH);
+    buf.i = _inflateStream->next_out;
+    _readDeflated.i = _inflateStream->next_in;
+    if(err == Z_STREAM_END)
+    {
+        //
+        // The peer ended the message with a final deflate block, it
+        // can't refer to previous messages anymore.
+        //
+        inflateReset(_inflateStream);
+        _readDeflated.i = _readDeflated.b.end();
+    }
+    else if(err != Z_OK && err != Z_BUF_ERROR)
+    {
+        throw CompressionException(__FILE__, __LINE__, "inflate failed" + getZError(err));
+    }
+
+    if(_readDeflated.i == _readDeflated.b.end() && _readPayloadLength == 0)
+    {
+        //
+        // The frame payload is consumed. The message is complete once
+        // inflate has no more pending output for the last frame.
+        //
+        if(!_readLastFrame || _inflateStream->avail_out > 0)
+        {
+            _readDeflated.b.reset();
+            _readDeflated.i = _readDeflated.b.begin();
+            _readCompressed = !_readLastFrame;
+            _readState = ReadStateOpcode;
+        }
+    }
+    return false;
+#else
+    assert(false); // The extension is never negotiated.
+    return false;
+#endif
+}
+
+bool
+IceInternal::WSTransceiver::inflatePending() const
+{
+    //
+    // Returns true if data is available to inflate without reading
+    // more data from the delegate.
+    //
+    return _readState == ReadStateCompressedPayload &&
+        (_readDeflated.i < _readDeflated.b.end() || (_readPayloadLength == 0 && _readLastFrame));
+}
+
+Buffer&
+IceInternal::WSTransceiver::writePayload(Buffer& buf)
+{
+    //
+    // Compress the message if the extension is enabled, the compressed
+    // message is sent instead of the message until it's fully written.
+    //
+    if(_deflate && !_writeCompressed && _state == StateOpened && _writeState == WriteStateHeader &&
+       buf.b.size() >= _deflateThreshold && buf.i == buf.b.begin())
+    {
+        deflateMessage(buf);
+        _writeCompressed = true;
+    }
+    return _writeCompressed ? _writeDeflated : buf;
+}
+
+void
+IceInternal::WSTransceiver::finishPayload(Buffer& buf)
+{
+    if(_writeCompressed && _writeDeflated.i == _writeDeflated.b.end() && _writeState == WriteStateHeader)
+    {
+        buf.i = buf.b.end();
+        _writeCompressed = false;
+        _writeDeflated.b.reset();
+        _writeDeflated.i = _writeDeflated.b.begin();
+    }
 }
 
 bool
@@ -1128,6 +1648,20 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             unsigned char ch = static_cast<unsigned char>(*_readI++);
             _readOpCode = ch & 0xf;
 
+            //
+            // The reserved bits must be 0 unless an extension defines them. The
+            // permessage-deflate extension uses RSV1 to mark the first frame of
+            // a compressed message.
+            //
+            if(ch & (FLAG_RSV2 | FLAG_RSV3))
+            {
+                throw ProtocolException(__FILE__, __LINE__, "invalid frame, reserved bits set");
+            }
+            else if((ch & FLAG_RSV1) && (!_deflate || _readOpCode != OP_DATA))
+            {
+                throw ProtocolException(__FILE__, __LINE__, "invalid frame, RSV1 bit set");
+            }
+
             //
             // Remember if last frame if we're going to read a data or
             // continuation frame, this is only for protocol
@@ -1140,6 +1674,7 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                     throw ProtocolException(__FILE__, __LINE__, "invalid data frame, no FIN on previous frame");
                 }
                 _readLastFrame = (ch & FLAG_FINAL) == FLAG_FINAL;
+                _readCompressed = (ch & FLAG_RSV1) == FLAG_RSV1;
             }
             else if(_readOpCode == OP_CONT)
             {
@@ -1242,14 +1777,20 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
                 {
                     Trace out(_instance->logger(), _instance->traceCategory());
                     out << "received " << protocol() << (_readOpCode == OP_DATA ? " data" : " continuation");
-                    out << " frame with payload length of " << _readPayloadLength;
-                    out << " bytes\n" << toString();
+                    out << (_readCompressed ? " compressed" : "") << " frame with payload length of ";
+                    out << _readPayloadLength << " bytes\n" << toString();
                 }
 
                 if(_readPayloadLength <= 0)
                 {
                     throw ProtocolException(__FILE__, __LINE__, "payload length is 0");
                 }
+                if(_readCompressed)
+                {
+                    _readState = ReadStateCompressedPayload;
+                    _readPayloadOffset = 0;
+                    break;
+                }
                 _readState = ReadStatePayload;
                 assert(buf.i != buf.b.end());
                 _readFrameStart = buf.i;
@@ -1357,6 +1898,29 @@ IceInternal::WSTransceiver::preRead(Buffer& buf)
             _readState = ReadStateOpcode;
         }
 
+        if(_readState == ReadStateCompressedPayload)
+        {
+            if(buf.b.empty() || buf.i == buf.b.end())
+            {
+                _readStart = _readBuffer.i;
+                return false;
+            }
+
+            if(inflatePayload(buf))
+            {
+                return true; // Need to read more payload data.
+            }
+
+            if(buf.i == buf.b.end())
+            {
+                //
+                // Give back the control to the connection once the buffer is full.
+                //
+                _readStart = _readBuffer.i;
+                return false;
+            }
+        }
+
         if(_readState == ReadStatePayload)
         {
             //
@@ -1439,6 +2003,10 @@ IceInternal::WSTransceiver::preWrite(Buffer& buf)
 
             assert(buf.i = buf.b.begin());
             prepareWriteHeader(OP_DATA, buf.b.size());
+            if(_writeCompressed)
+            {
+                _writeBuffer.b[0] |= FLAG_RSV1;
+            }
 
             _writeState = WriteStatePayload;
         }
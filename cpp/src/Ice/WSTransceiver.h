@@ -18,6 +18,14 @@
 #include <Ice/Network.h>
 #include <Ice/Buffer.h>
 
+#if !defined(_WIN32) && !defined(ICE_OS_WINRT)
+#    ifndef ICE_HAS_ZLIB
+#        define ICE_HAS_ZLIB
+#    endif
+#endif
+
+struct z_stream_s;
+
 namespace IceInternal
 {
 
@@ -73,6 +81,16 @@ private:
     void handleRequest(Buffer&);
     void handleResponse();
 
+    std::string deflateOffer();
+    std::string acceptDeflateOffer();
+    void checkDeflateResponse();
+    void initDeflate(bool, int);
+    void deflateMessage(const Buffer&);
+    bool inflatePayload(Buffer&);
+    bool inflatePending() const;
+    Buffer& writePayload(Buffer&);
+    void finishPayload(Buffer&);
+
     bool preRead(Buffer&);
     bool postRead(Buffer&);
 
@@ -118,6 +136,7 @@ private:
         ReadStateHeader,
         ReadStateControlFrame,
         ReadStatePayload,
+        ReadStateCompressedPayload,
     };
 
     ReadState _readState;
@@ -153,6 +172,25 @@ private:
     int _closingReason;
 
     std::vector<Ice::Byte> _pingPayload;
+
+    //
+    // permessage-deflate extension (RFC 7692). The payload of incoming
+    // compressed frames is inflated directly in the buffer provided by
+    // the connection, an outgoing message is deflated before its first
+    // frame is sent.
+    //
+    bool _deflate;
+    bool _deflateOffered;
+    bool _deflateNoContextTakeover;
+    z_stream_s* _deflateStream;
+    z_stream_s* _inflateStream;
+
+    bool _readCompressed;
+    size_t _readPayloadOffset;
+    Buffer _readDeflated;
+
+    bool _writeCompressed;
+    Buffer _writeDeflated;
 };
 typedef IceUtil::Handle<WSTransceiver> WSTransceiverPtr;
 
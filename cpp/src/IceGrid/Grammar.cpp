@@ -177,7 +177,8 @@ yyerror(const char* s)
      ICE_GRID_TEMPLATE = 294,
      ICE_GRID_SERVICE = 295,
      ICE_GRID_ENABLE = 296,
-     ICE_GRID_DISABLE = 297
+     ICE_GRID_DISABLE = 297,
+     ICE_GRID_METRICS = 298
    };
 #endif
 
@@ -195,7 +196,7 @@ typedef int YYSTYPE;
 
 
 /* Line 264 of yacc.c  */
-#line 199 "Grammar.tab.c"
+#line 200 "Grammar.tab.c"
 
 #ifdef short
 # undef short
@@ -410,20 +411,20 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  4
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   2612
+#define YYLAST   2717
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  44
+#define YYNTOKENS  45
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  7
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  172
+#define YYNRULES  175
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  367
+#define YYNSTATES  373
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   297
+#define YYMAXUTOK   298
 
 #define YYTRANSLATE(YYX)						\
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -436,7 +437,7 @@ static const yytype_uint8 yytranslate[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,    43,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,    44,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -460,7 +461,7 @@ static const yytype_uint8 yytranslate[] =
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42
+      35,    36,    37,    38,    39,    40,    41,    42,    43
 };
 
 #if YYDEBUG
@@ -479,82 +480,83 @@ static const yytype_uint16 yyprhs[] =
      381,   386,   391,   396,   401,   406,   411,   416,   421,   426,
      431,   436,   441,   446,   451,   456,   461,   466,   471,   476,
      481,   486,   491,   496,   501,   506,   511,   516,   521,   526,
-     531,   536,   541,   546,   551,   556,   560,   564,   568,   573,
-     579,   585,   592,   597,   601,   605,   610,   614,   618,   621,
-     623,   626,   629,   633,   637,   638,   640,   642,   644,   646,
-     648,   650,   652,   654,   656,   658,   660,   662,   664,   666,
-     668,   670,   672,   674,   676,   678,   680,   682,   684,   686,
-     688,   690,   692,   694,   696,   698,   700,   702,   704,   706,
-     708,   710,   712
+     531,   536,   541,   546,   551,   556,   561,   566,   570,   574,
+     578,   583,   589,   595,   602,   607,   611,   615,   620,   624,
+     628,   631,   633,   636,   639,   643,   647,   648,   650,   652,
+     654,   656,   658,   660,   662,   664,   666,   668,   670,   672,
+     674,   676,   678,   680,   682,   684,   686,   688,   690,   692,
+     694,   696,   698,   700,   702,   704,   706,   708,   710,   712,
+     714,   716,   718,   720,   722,   724
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
 static const yytype_int8 yyrhs[] =
 {
-      45,     0,    -1,    46,    -1,    -1,    46,    47,    48,    -1,
-      47,    48,    -1,    -1,     3,    43,    -1,     4,    43,    -1,
-       5,    13,    49,    43,    -1,     5,    13,     3,    43,    -1,
-       5,    14,    49,    43,    -1,     5,    14,     3,    43,    -1,
-       5,    36,    49,    43,    -1,     5,    36,     3,    43,    -1,
-       5,    37,    49,    43,    -1,     5,    37,     3,    43,    -1,
-       5,    24,    49,    43,    -1,     5,    24,     3,    43,    -1,
-       5,    20,    49,    43,    -1,     5,    20,     3,    43,    -1,
-       5,    15,    49,    43,    -1,     5,    15,     3,    43,    -1,
-       8,    39,    24,    49,    43,    -1,     8,    39,    24,     3,
-      43,    -1,     8,    39,    38,    49,    43,    -1,     8,    39,
-      38,     3,    43,    -1,     8,    39,     3,    43,    -1,    40,
-      39,    24,    49,    43,    -1,    40,    39,    24,     3,    43,
-      -1,    40,    39,     3,    43,    -1,     6,    24,    49,    43,
-      -1,     6,    24,     3,    43,    -1,     6,    10,    49,    43,
-      -1,     6,    10,     3,    43,    -1,     6,    11,    49,    43,
-      -1,     6,    11,     3,    43,    -1,     6,    12,    49,    43,
-      -1,     6,    12,     3,    43,    -1,     6,    16,    49,    43,
-      -1,     6,    16,     3,    43,    -1,     6,    15,    49,    43,
-      -1,     6,    15,     3,    43,    -1,     6,    33,    49,    43,
-      -1,     6,    33,     3,    43,    -1,     7,    24,    49,    43,
-      -1,     7,    24,     3,    43,    -1,     7,    10,    49,    43,
-      -1,     7,    10,     3,    43,    -1,     7,    16,    49,    43,
-      -1,     7,    16,     3,    43,    -1,     7,    15,    49,    43,
-      -1,     7,    15,     3,    43,    -1,     7,    33,    49,    43,
-      -1,     7,    33,     3,    43,    -1,     8,    14,    49,    43,
-      -1,     8,    14,     3,    43,    -1,     8,    24,    49,    43,
-      -1,     8,    24,     3,    43,    -1,     8,    18,    49,    43,
-      -1,     8,    18,     3,    43,    -1,     8,    19,    49,    43,
-      -1,     8,    19,     3,    43,    -1,     8,    20,    49,    43,
-      -1,     8,    20,     3,    43,    -1,     8,    21,    49,    43,
-      -1,     8,    21,     3,    43,    -1,     8,    22,    49,    43,
-      -1,     8,    22,     3,    43,    -1,     8,    23,    49,    43,
-      -1,     8,    23,     3,    43,    -1,     8,    27,    49,    43,
-      -1,     8,    27,     3,    43,    -1,     8,    28,    49,    43,
-      -1,     8,    28,     3,    43,    -1,     8,    25,    49,    43,
-      -1,     8,    25,     3,    43,    -1,     8,    26,    49,    43,
-      -1,     8,    26,     3,    43,    -1,     8,    41,    49,    43,
-      -1,     8,    41,     3,    43,    -1,     8,    42,    49,    43,
-      -1,     8,    42,     3,    43,    -1,     8,    15,    49,    43,
-      -1,     8,    15,     3,    43,    -1,     8,    33,    49,    43,
-      -1,     8,    33,     3,    43,    -1,    40,    18,    49,    43,
-      -1,    40,    18,     3,    43,    -1,    40,    19,    49,    43,
-      -1,    40,    19,     3,    43,    -1,    40,    24,    49,    43,
-      -1,    40,    24,     3,    43,    -1,    40,    25,    49,    43,
-      -1,    40,    25,     3,    43,    -1,    40,    26,    49,    43,
-      -1,    40,    26,     3,    43,    -1,    40,    15,    49,    43,
-      -1,    40,    15,     3,    43,    -1,     9,    29,    49,    43,
-      -1,     9,    29,     3,    43,    -1,     9,    14,    49,    43,
-      -1,     9,    14,     3,    43,    -1,     9,    15,    49,    43,
-      -1,     9,    15,     3,    43,    -1,    31,    13,    49,    43,
-      -1,    31,    13,     3,    43,    -1,    31,    14,    49,    43,
-      -1,    31,    14,     3,    43,    -1,    31,    32,    49,    43,
-      -1,    31,    32,     3,    43,    -1,    31,    15,    49,    43,
-      -1,    31,    15,     3,    43,    -1,    31,    24,    49,    43,
-      -1,    31,    24,     3,    43,    -1,    33,    34,    43,    -1,
-      33,    35,    43,    -1,     3,    50,    43,    -1,     3,    50,
-      50,    43,    -1,     3,    50,    17,    49,    43,    -1,     3,
-      50,    50,    50,    43,    -1,     3,    50,    50,    17,    49,
-      43,    -1,     3,    17,    49,    43,    -1,     3,     1,    43,
-      -1,    50,     3,    43,    -1,    50,    17,     1,    43,    -1,
-      50,     1,    43,    -1,    17,     1,    43,    -1,     1,    43,
-      -1,    43,    -1,    17,    49,    -1,    50,    49,    -1,    17,
-       3,    49,    -1,    50,     3,    49,    -1,    -1,     4,    -1,
+      46,     0,    -1,    47,    -1,    -1,    47,    48,    49,    -1,
+      48,    49,    -1,    -1,     3,    44,    -1,     4,    44,    -1,
+       5,    13,    50,    44,    -1,     5,    13,     3,    44,    -1,
+       5,    14,    50,    44,    -1,     5,    14,     3,    44,    -1,
+       5,    36,    50,    44,    -1,     5,    36,     3,    44,    -1,
+       5,    37,    50,    44,    -1,     5,    37,     3,    44,    -1,
+       5,    24,    50,    44,    -1,     5,    24,     3,    44,    -1,
+       5,    20,    50,    44,    -1,     5,    20,     3,    44,    -1,
+       5,    15,    50,    44,    -1,     5,    15,     3,    44,    -1,
+       8,    39,    24,    50,    44,    -1,     8,    39,    24,     3,
+      44,    -1,     8,    39,    38,    50,    44,    -1,     8,    39,
+      38,     3,    44,    -1,     8,    39,     3,    44,    -1,    40,
+      39,    24,    50,    44,    -1,    40,    39,    24,     3,    44,
+      -1,    40,    39,     3,    44,    -1,     6,    24,    50,    44,
+      -1,     6,    24,     3,    44,    -1,     6,    10,    50,    44,
+      -1,     6,    10,     3,    44,    -1,     6,    11,    50,    44,
+      -1,     6,    11,     3,    44,    -1,     6,    12,    50,    44,
+      -1,     6,    12,     3,    44,    -1,     6,    16,    50,    44,
+      -1,     6,    16,     3,    44,    -1,     6,    15,    50,    44,
+      -1,     6,    15,     3,    44,    -1,     6,    33,    50,    44,
+      -1,     6,    33,     3,    44,    -1,     7,    24,    50,    44,
+      -1,     7,    24,     3,    44,    -1,     7,    10,    50,    44,
+      -1,     7,    10,     3,    44,    -1,     7,    16,    50,    44,
+      -1,     7,    16,     3,    44,    -1,     7,    15,    50,    44,
+      -1,     7,    15,     3,    44,    -1,     7,    33,    50,    44,
+      -1,     7,    33,     3,    44,    -1,     8,    14,    50,    44,
+      -1,     8,    14,     3,    44,    -1,     8,    24,    50,    44,
+      -1,     8,    24,     3,    44,    -1,     8,    18,    50,    44,
+      -1,     8,    18,     3,    44,    -1,     8,    19,    50,    44,
+      -1,     8,    19,     3,    44,    -1,     8,    20,    50,    44,
+      -1,     8,    20,     3,    44,    -1,     8,    21,    50,    44,
+      -1,     8,    21,     3,    44,    -1,     8,    22,    50,    44,
+      -1,     8,    22,     3,    44,    -1,     8,    23,    50,    44,
+      -1,     8,    23,     3,    44,    -1,     8,    27,    50,    44,
+      -1,     8,    27,     3,    44,    -1,     8,    28,    50,    44,
+      -1,     8,    28,     3,    44,    -1,     8,    25,    50,    44,
+      -1,     8,    25,     3,    44,    -1,     8,    43,    50,    44,
+      -1,     8,    43,     3,    44,    -1,     8,    26,    50,    44,
+      -1,     8,    26,     3,    44,    -1,     8,    41,    50,    44,
+      -1,     8,    41,     3,    44,    -1,     8,    42,    50,    44,
+      -1,     8,    42,     3,    44,    -1,     8,    15,    50,    44,
+      -1,     8,    15,     3,    44,    -1,     8,    33,    50,    44,
+      -1,     8,    33,     3,    44,    -1,    40,    18,    50,    44,
+      -1,    40,    18,     3,    44,    -1,    40,    19,    50,    44,
+      -1,    40,    19,     3,    44,    -1,    40,    24,    50,    44,
+      -1,    40,    24,     3,    44,    -1,    40,    25,    50,    44,
+      -1,    40,    25,     3,    44,    -1,    40,    26,    50,    44,
+      -1,    40,    26,     3,    44,    -1,    40,    15,    50,    44,
+      -1,    40,    15,     3,    44,    -1,     9,    29,    50,    44,
+      -1,     9,    29,     3,    44,    -1,     9,    14,    50,    44,
+      -1,     9,    14,     3,    44,    -1,     9,    15,    50,    44,
+      -1,     9,    15,     3,    44,    -1,    31,    13,    50,    44,
+      -1,    31,    13,     3,    44,    -1,    31,    14,    50,    44,
+      -1,    31,    14,     3,    44,    -1,    31,    32,    50,    44,
+      -1,    31,    32,     3,    44,    -1,    31,    15,    50,    44,
+      -1,    31,    15,     3,    44,    -1,    31,    24,    50,    44,
+      -1,    31,    24,     3,    44,    -1,    33,    34,    44,    -1,
+      33,    35,    44,    -1,     3,    51,    44,    -1,     3,    51,
+      51,    44,    -1,     3,    51,    17,    50,    44,    -1,     3,
+      51,    51,    51,    44,    -1,     3,    51,    51,    17,    50,
+      44,    -1,     3,    17,    50,    44,    -1,     3,     1,    44,
+      -1,    51,     3,    44,    -1,    51,    17,     1,    44,    -1,
+      51,     1,    44,    -1,    17,     1,    44,    -1,     1,    44,
+      -1,    44,    -1,    17,    50,    -1,    51,    50,    -1,    17,
+       3,    50,    -1,    51,     3,    50,    -1,    -1,     4,    -1,
        5,    -1,     6,    -1,     7,    -1,     8,    -1,     9,    -1,
       10,    -1,    11,    -1,    12,    -1,    13,    -1,    14,    -1,
       15,    -1,    16,    -1,    18,    -1,    19,    -1,    20,    -1,
@@ -562,30 +564,30 @@ static const yytype_int8 yyrhs[] =
       26,    -1,    29,    -1,    30,    -1,    31,    -1,    32,    -1,
       33,    -1,    34,    -1,    35,    -1,    36,    -1,    37,    -1,
       38,    -1,    39,    -1,    40,    -1,    41,    -1,    42,    -1,
-      23,    -1,    22,    -1
+      43,    -1,    23,    -1,    22,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,    95,    95,    99,   106,   109,   116,   124,   128,   132,
-     136,   140,   144,   148,   152,   156,   160,   164,   168,   172,
-     176,   180,   184,   188,   192,   196,   200,   204,   208,   212,
-     216,   220,   224,   228,   232,   236,   240,   244,   248,   252,
-     256,   260,   264,   268,   272,   276,   280,   284,   288,   292,
-     296,   300,   304,   308,   312,   316,   320,   324,   328,   332,
-     336,   340,   344,   348,   352,   356,   360,   364,   368,   372,
-     376,   380,   384,   388,   392,   396,   400,   404,   408,   412,
-     416,   420,   424,   428,   432,   436,   440,   444,   448,   452,
-     456,   460,   464,   468,   472,   476,   480,   484,   488,   492,
-     496,   500,   504,   508,   512,   516,   520,   524,   528,   532,
-     536,   540,   544,   548,   552,   556,   560,   564,   568,   579,
-     583,   594,   605,   609,   613,   617,   623,   628,   633,   637,
-     646,   651,   656,   662,   669,   677,   680,   683,   686,   689,
-     692,   695,   698,   701,   704,   707,   710,   713,   716,   719,
-     722,   725,   728,   731,   734,   737,   740,   743,   746,   749,
-     752,   755,   758,   761,   764,   767,   770,   773,   776,   779,
-     782,   785,   788
+       0,    96,    96,   100,   107,   110,   117,   125,   129,   133,
+     137,   141,   145,   149,   153,   157,   161,   165,   169,   173,
+     177,   181,   185,   189,   193,   197,   201,   205,   209,   213,
+     217,   221,   225,   229,   233,   237,   241,   245,   249,   253,
+     257,   261,   265,   269,   273,   277,   281,   285,   289,   293,
+     297,   301,   305,   309,   313,   317,   321,   325,   329,   333,
+     337,   341,   345,   349,   353,   357,   361,   365,   369,   373,
+     377,   381,   385,   389,   393,   397,   401,   405,   409,   413,
+     417,   421,   425,   429,   433,   437,   441,   445,   449,   453,
+     457,   461,   465,   469,   473,   477,   481,   485,   489,   493,
+     497,   501,   505,   509,   513,   517,   521,   525,   529,   533,
+     537,   541,   545,   549,   553,   557,   561,   565,   569,   573,
+     577,   588,   592,   603,   614,   618,   622,   626,   632,   637,
+     642,   646,   655,   660,   665,   671,   678,   686,   689,   692,
+     695,   698,   701,   704,   707,   710,   713,   716,   719,   722,
+     725,   728,   731,   734,   737,   740,   743,   746,   749,   752,
+     755,   758,   761,   764,   767,   770,   773,   776,   779,   782,
+     785,   788,   791,   794,   797,   800
 };
 #endif
 
@@ -606,8 +608,9 @@ static const char *const yytname[] =
   "ICE_GRID_FIND", "ICE_GRID_SHOW", "ICE_GRID_COPYING",
   "ICE_GRID_WARRANTY", "ICE_GRID_DIFF", "ICE_GRID_UPDATE",
   "ICE_GRID_INSTANTIATE", "ICE_GRID_TEMPLATE", "ICE_GRID_SERVICE",
-  "ICE_GRID_ENABLE", "ICE_GRID_DISABLE", "';'", "$accept", "start",
-  "commands", "checkInterrupted", "command", "strings", "keyword", 0
+  "ICE_GRID_ENABLE", "ICE_GRID_DISABLE", "ICE_GRID_METRICS", "';'",
+  "$accept", "start", "commands", "checkInterrupted", "command", "strings",
+  "keyword", 0
 };
 #endif
 
@@ -620,31 +623,31 @@ static const yytype_uint16 yytoknum[] =
      265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,    59
+     295,   296,   297,   298,    59
 };
 # endif
 
 /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    44,    45,    45,    46,    46,    47,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      48,    48,    48,    48,    48,    48,    48,    48,    48,    48,
-      49,    49,    49,    49,    49,    50,    50,    50,    50,    50,
-      50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-      50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-      50,    50,    50,    50,    50,    50,    50,    50,    50,    50,
-      50,    50,    50
+       0,    45,    46,    46,    47,    47,    48,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    49,    49,    49,    49,    49,    49,    49,    49,
+      49,    49,    50,    50,    50,    50,    50,    51,    51,    51,
+      51,    51,    51,    51,    51,    51,    51,    51,    51,    51,
+      51,    51,    51,    51,    51,    51,    51,    51,    51,    51,
+      51,    51,    51,    51,    51,    51,    51,    51,    51,    51,
+      51,    51,    51,    51,    51,    51
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
@@ -661,13 +664,13 @@ static const yytype_uint8 yyr2[] =
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     3,     3,     3,     4,     5,
-       5,     6,     4,     3,     3,     4,     3,     3,     2,     1,
-       2,     2,     3,     3,     0,     1,     1,     1,     1,     1,
+       4,     4,     4,     4,     4,     4,     4,     3,     3,     3,
+       4,     5,     5,     6,     4,     3,     3,     4,     3,     3,
+       2,     1,     2,     2,     3,     3,     0,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1
+       1,     1,     1,     1,     1,     1
 };
 
 /* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
@@ -675,99 +678,101 @@ static const yytype_uint8 yyr2[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       6,     0,     6,     0,     1,     0,     0,     0,   135,   136,
-     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
-     147,     0,   148,   149,   150,   151,   172,   171,   152,   155,
-     156,   153,   154,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   170,   129,     5,     0,
-       4,   128,     0,   135,   136,   137,   138,   139,   140,   134,
-     159,   161,   168,     7,     0,     8,   134,   134,   134,   134,
-     134,   134,   134,   134,   134,   134,   134,   134,   134,   134,
-     134,   134,   134,   134,   134,   134,   134,   134,   134,   134,
-     134,   134,   134,   134,   134,   134,   134,   134,   134,     0,
-     134,   134,   134,   134,   134,     0,   134,   134,   134,   134,
-     134,     0,     0,   134,   134,   134,   134,   134,   134,     0,
-       0,     0,     0,   123,   134,     0,   134,   134,   117,     0,
+       6,     0,     6,     0,     1,     0,     0,     0,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,     0,   150,   151,   152,   153,   175,   174,   154,   157,
+     158,   155,   156,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,   131,     5,
+       0,     4,   130,     0,   137,   138,   139,   140,   141,   142,
+     136,   161,   163,   170,     7,     0,     8,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+     136,   136,   136,   136,   136,   136,   136,   136,   136,   136,
+       0,   136,   136,   136,   136,   136,   136,     0,   136,   136,
+     136,   136,   136,     0,     0,   136,   136,   136,   136,   136,
+     136,     0,     0,     0,     0,   125,   136,     0,   136,   136,
+     119,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   134,   134,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   127,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     115,   116,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   134,   126,   124,     0,   134,
-     130,   122,   134,   131,     0,   134,   118,     0,    10,     9,
-      12,    11,    22,    21,    20,    19,    18,    17,    14,    13,
-      16,    15,    34,    33,    36,    35,    38,    37,    42,    41,
-      40,    39,    32,    31,    44,    43,    48,    47,    52,    51,
-      50,    49,    46,    45,    54,    53,    56,    55,    84,    83,
-      60,    59,    62,    61,    64,    63,    66,    65,    68,    67,
-      70,    69,    58,    57,    76,    75,    78,    77,    72,    71,
-      74,    73,    86,    85,    27,     0,     0,     0,     0,    80,
-      79,    82,    81,   102,   101,   104,   103,   100,    99,   106,
-     105,   108,   107,   112,   111,   114,   113,   110,   109,    98,
-      97,    88,    87,    90,    89,    92,    91,    94,    93,    96,
-      95,    30,     0,     0,   125,   132,   133,   119,     0,   120,
-      24,    23,    26,    25,    29,    28,   121
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   136,
+     136,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   117,   118,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   136,
+     128,   126,     0,   136,   132,   124,   136,   133,     0,   136,
+     120,     0,    10,     9,    12,    11,    22,    21,    20,    19,
+      18,    17,    14,    13,    16,    15,    34,    33,    36,    35,
+      38,    37,    42,    41,    40,    39,    32,    31,    44,    43,
+      48,    47,    52,    51,    50,    49,    46,    45,    54,    53,
+      56,    55,    86,    85,    60,    59,    62,    61,    64,    63,
+      66,    65,    68,    67,    70,    69,    58,    57,    76,    75,
+      80,    79,    72,    71,    74,    73,    88,    87,    27,     0,
+       0,     0,     0,    82,    81,    84,    83,    78,    77,   104,
+     103,   106,   105,   102,   101,   108,   107,   110,   109,   114,
+     113,   116,   115,   112,   111,   100,    99,    90,    89,    92,
+      91,    94,    93,    96,    95,    98,    97,    30,     0,     0,
+     127,   134,   135,   121,     0,   122,    24,    23,    26,    25,
+      29,    28,   123
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
+static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,     2,     3,    48,   125,   126
+      -1,     1,     2,     3,    49,   127,   128
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -67
+#define YYPACT_NINF -68
 static const yytype_int16 yypact[] =
 {
-      39,    53,    56,    61,   -67,    61,    20,   179,    69,    93,
-     142,  2492,   123,    95,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   117,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   146,   -67,    11,   -67,   -67,
-     -67,   -67,   -67,   -67,    96,   -67,   -67,   -67,   -67,   122,
-     -67,   -67,    76,   -67,   -67,   -67,   -67,   -67,   -67,  2459,
-     -67,   -67,   -67,   -67,   219,   -67,   260,   300,   340,   380,
-     420,   460,   500,   540,   580,   620,   660,   700,   740,   780,
-     820,   860,   900,   940,   980,  1020,  1060,  1100,  1140,  1180,
-    1220,  1260,  1300,  1340,  1380,  1420,  1460,  1500,  1540,   102,
-    1580,  1620,  1660,  1700,  1740,    84,  1780,  1820,  1860,  1900,
-    1940,    85,    90,  1980,  2020,  2060,  2100,  2140,  2180,    30,
-      91,   112,   135,   -67,  2220,   120,  2260,  2459,   -67,  2299,
-     124,   125,   128,   129,   131,   134,   139,  2460,  2461,  2462,
-    2463,  2466,  2467,  2468,  2469,  2470,  2471,  2472,  2474,  2475,
-    2476,  2477,  2478,  2479,  2480,  2481,  2483,  2484,  2485,  2486,
-    2487,  2488,  2489,  2490,  2491,  2493,  2494,  2495,  2496,  2497,
-    2498,  2499,  2500,  2501,  2502,  2503,  2504,  2505,  2506,  2507,
-    2508,  2509,  2510,  2511,  2512,  2513,  2514,  2515,  2516,  2517,
-    2518,  2519,  2520,  2521,  2522,  2523,  2524,  2340,  2380,  2525,
-    2526,  2527,  2528,  2529,  2530,  2531,  2532,  2533,  2534,   -67,
-    2535,  2536,  2537,  2538,  2539,  2540,  2541,  2542,  2543,  2544,
-     -67,   -67,  2545,  2546,  2547,  2548,  2549,  2550,  2551,  2552,
-    2553,  2554,  2555,  2556,  2557,  2420,   -67,   -67,  2558,  2459,
-     -67,   -67,  2459,   -67,  2559,  2459,   -67,  2560,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,  2561,  2562,  2563,  2564,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,   -67,
-     -67,   -67,  2565,  2566,   -67,   -67,   -67,   -67,  2567,   -67,
-     -67,   -67,   -67,   -67,   -67,   -67,   -67
+      40,    55,    57,    62,   -68,    62,    20,   182,    65,    99,
+     105,   145,   125,   112,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   110,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,  2597,   -68,    12,   -68,   -68,
+     -68,   -68,   -68,   -68,  2589,   -68,   -68,   -68,   -68,   -68,
+     107,   -68,   -68,    78,   -68,   -68,   -68,   -68,   -68,   -68,
+    2560,   -68,   -68,   -68,   -68,   223,   -68,   265,   306,   347,
+     388,   429,   470,   511,   552,   593,   634,   675,   716,   757,
+     798,   839,   880,   921,   962,  1003,  1044,  1085,  1126,  1167,
+    1208,  1249,  1290,  1331,  1372,  1413,  1454,  1495,  1536,  1577,
+     104,  1618,  1659,  1700,  1741,  1782,  1823,    81,  1864,  1905,
+    1946,  1987,  2028,    86,    87,  2069,  2110,  2151,  2192,  2233,
+    2274,    30,    90,    93,   153,   -68,  2315,   113,  2356,  2560,
+     -68,  2396,   115,   118,   119,   121,   126,   127,   129,   130,
+     131,   133,   136,   137,   141,  2561,  2562,  2565,  2572,  2573,
+    2574,  2575,  2576,  2578,  2579,  2580,  2581,  2582,  2583,  2586,
+    2587,  2588,  2590,  2591,  2592,  2593,  2594,  2595,  2596,  2598,
+    2599,  2600,  2601,  2602,  2603,  2604,  2605,  2606,  2607,  2608,
+    2609,  2610,  2611,  2612,  2613,  2614,  2615,  2616,  2617,  2618,
+    2619,  2620,  2621,  2622,  2623,  2624,  2625,  2626,  2627,  2438,
+    2479,  2628,  2629,  2630,  2631,  2632,  2633,  2634,  2635,  2636,
+    2637,  2638,  2639,   -68,  2640,  2641,  2642,  2643,  2644,  2645,
+    2646,  2647,  2648,  2649,   -68,   -68,  2650,  2651,  2652,  2653,
+    2654,  2655,  2656,  2657,  2658,  2659,  2660,  2661,  2662,  2520,
+     -68,   -68,  2663,  2560,   -68,   -68,  2560,   -68,  2664,  2560,
+     -68,  2665,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,  2666,
+    2667,  2668,  2669,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,  2670,  2671,
+     -68,   -68,   -68,   -68,  2672,   -68,   -68,   -68,   -68,   -68,
+     -68,   -68,   -68
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-     -67,   -67,   -67,  2609,  2607,   -66,    52
+     -68,   -68,   -68,   154,  2712,   -67,    53
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -777,295 +782,326 @@ static const yytype_int16 yypgoto[] =
 #define YYTABLE_NINF -4
 static const yytype_int16 yytable[] =
 {
-     131,   133,   135,   137,   139,   141,   143,   145,   147,   149,
-     151,   153,   155,   157,   159,   161,   163,   165,   167,   169,
-     171,   173,   175,   177,   179,   181,   183,   185,   187,   189,
-     191,   193,   195,   234,   200,   202,   204,   206,   208,    -3,
-     211,   213,   215,   217,   219,   111,   112,   223,   225,   227,
-     229,   231,   233,     4,   235,    49,    -2,    49,   240,    64,
-     243,   244,     6,    51,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    44,    45,    46,    47,   196,    66,    67,    68,   102,
-     103,   113,    65,    69,   114,   115,   129,    70,   105,   123,
-     116,   117,   118,   120,   104,   121,   197,   209,   220,    71,
-      72,   316,   318,   221,   236,   119,   238,    85,    86,   122,
-     198,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    73,    74,    75,   237,    98,    76,    77,   106,
-     107,   108,    99,   241,   100,   101,    78,   248,   249,   353,
-     109,   250,   251,   355,   252,    79,   356,   253,   110,   358,
-      52,   247,   254,    53,    54,    55,    56,    57,    58,    14,
-      15,    16,    17,    18,    19,    20,    59,    22,    23,    24,
+     133,   135,   137,   139,   141,   143,   145,   147,   149,   151,
+     153,   155,   157,   159,   161,   163,   165,   167,   169,   171,
+     173,   175,   177,   179,   181,   183,   185,   187,   189,   191,
+     193,   195,   197,   238,   202,   204,   206,   208,   210,   212,
+      -3,   215,   217,   219,   221,   223,   113,   114,   227,   229,
+     231,   233,   235,   237,   239,     4,    50,    -2,    50,   244,
+      65,   247,   248,     6,    52,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,   198,   122,    66,
+     123,   107,    67,    68,    69,    74,    75,    76,   131,    70,
+      77,    78,   125,    71,   124,   213,   104,   105,   199,    79,
+     224,   225,   320,   322,   240,    72,    73,   241,    80,    86,
+      87,   106,   200,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,   242,    81,     5,   245,    99,   252,
+      82,    83,   253,   254,   100,   255,   101,   102,   103,    84,
+     256,   257,   359,   258,   259,   260,   361,   261,    85,   362,
+     262,   263,   364,    53,   251,   264,    54,    55,    56,    57,
+      58,    59,    14,    15,    16,    17,    18,    19,    20,    60,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    61,    36,    62,    38,    39,    40,    41,
+      42,    43,    63,    45,    46,    47,    64,    54,    55,    56,
+      57,    58,    59,    14,    15,    16,    17,    18,    19,    20,
+     129,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    61,    36,    62,    38,    39,    40,
+      41,    42,    43,    63,    45,    46,    47,   130,   132,    54,
+      55,    56,    57,    58,    59,    14,    15,    16,    17,    18,
+      19,    20,   126,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    61,    36,    62,    38,
+      39,    40,    41,    42,    43,    63,    45,    46,    47,   134,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   126,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+     136,    54,    55,    56,    57,    58,    59,    14,    15,    16,
+      17,    18,    19,    20,   126,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    61,    36,
+      62,    38,    39,    40,    41,    42,    43,    63,    45,    46,
+      47,   138,    54,    55,    56,    57,    58,    59,    14,    15,
+      16,    17,    18,    19,    20,   126,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    61,
+      36,    62,    38,    39,    40,    41,    42,    43,    63,    45,
+      46,    47,   140,    54,    55,    56,    57,    58,    59,    14,
+      15,    16,    17,    18,    19,    20,   126,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      60,    36,    61,    38,    39,    40,    41,    42,    43,    62,
-      45,    46,    63,    53,    54,    55,    56,    57,    58,    14,
-      15,    16,    17,    18,    19,    20,   127,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      60,    36,    61,    38,    39,    40,    41,    42,    43,    62,
-      45,    46,   128,   130,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   132,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   134,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   136,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   138,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   140,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   142,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   144,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   146,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   148,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   150,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   152,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   154,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   156,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   158,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   160,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   162,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   164,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   166,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   168,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   170,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   172,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   174,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   176,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   178,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   180,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   182,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   184,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   186,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   188,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      61,    36,    62,    38,    39,    40,    41,    42,    43,    63,
+      45,    46,    47,   142,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   190,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   192,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   194,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   199,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   201,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   203,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   205,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   207,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   210,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   212,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   214,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   216,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   218,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   222,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   224,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   226,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   228,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   230,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   232,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,   144,    54,    55,    56,    57,    58,
+      59,    14,    15,    16,    17,    18,    19,    20,   126,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    61,    36,    62,    38,    39,    40,    41,    42,
+      43,    63,    45,    46,    47,   146,    54,    55,    56,    57,
+      58,    59,    14,    15,    16,    17,    18,    19,    20,   126,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    61,    36,    62,    38,    39,    40,    41,
+      42,    43,    63,    45,    46,    47,   148,    54,    55,    56,
+      57,    58,    59,    14,    15,    16,    17,    18,    19,    20,
+     126,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    61,    36,    62,    38,    39,    40,
+      41,    42,    43,    63,    45,    46,    47,   150,    54,    55,
+      56,    57,    58,    59,    14,    15,    16,    17,    18,    19,
+      20,   126,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    61,    36,    62,    38,    39,
+      40,    41,    42,    43,    63,    45,    46,    47,   152,    54,
+      55,    56,    57,    58,    59,    14,    15,    16,    17,    18,
+      19,    20,   126,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    61,    36,    62,    38,
+      39,    40,    41,    42,    43,    63,    45,    46,    47,   154,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   126,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+     156,    54,    55,    56,    57,    58,    59,    14,    15,    16,
+      17,    18,    19,    20,   126,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    61,    36,
+      62,    38,    39,    40,    41,    42,    43,    63,    45,    46,
+      47,   158,    54,    55,    56,    57,    58,    59,    14,    15,
+      16,    17,    18,    19,    20,   126,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    61,
+      36,    62,    38,    39,    40,    41,    42,    43,    63,    45,
+      46,    47,   160,    54,    55,    56,    57,    58,    59,    14,
+      15,    16,    17,    18,    19,    20,   126,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      61,    36,    62,    38,    39,    40,    41,    42,    43,    63,
+      45,    46,    47,   162,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   239,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,   164,    54,    55,    56,    57,    58,
+      59,    14,    15,    16,    17,    18,    19,    20,   126,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    61,    36,    62,    38,    39,    40,    41,    42,
+      43,    63,    45,    46,    47,   166,    54,    55,    56,    57,
+      58,    59,    14,    15,    16,    17,    18,    19,    20,   126,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    61,    36,    62,    38,    39,    40,    41,
+      42,    43,    63,    45,    46,    47,   168,    54,    55,    56,
+      57,    58,    59,    14,    15,    16,    17,    18,    19,    20,
+     126,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    61,    36,    62,    38,    39,    40,
+      41,    42,    43,    63,    45,    46,    47,   170,    54,    55,
+      56,    57,    58,    59,    14,    15,    16,    17,    18,    19,
+      20,   126,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    61,    36,    62,    38,    39,
+      40,    41,    42,    43,    63,    45,    46,    47,   172,    54,
+      55,    56,    57,    58,    59,    14,    15,    16,    17,    18,
+      19,    20,   126,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    61,    36,    62,    38,
+      39,    40,    41,    42,    43,    63,    45,    46,    47,   174,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   126,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+     176,    54,    55,    56,    57,    58,    59,    14,    15,    16,
+      17,    18,    19,    20,   126,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    61,    36,
+      62,    38,    39,    40,    41,    42,    43,    63,    45,    46,
+      47,   178,    54,    55,    56,    57,    58,    59,    14,    15,
+      16,    17,    18,    19,    20,   126,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    61,
+      36,    62,    38,    39,    40,    41,    42,    43,    63,    45,
+      46,    47,   180,    54,    55,    56,    57,    58,    59,    14,
+      15,    16,    17,    18,    19,    20,   126,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      61,    36,    62,    38,    39,    40,    41,    42,    43,    63,
+      45,    46,    47,   182,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   242,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,   184,    54,    55,    56,    57,    58,
+      59,    14,    15,    16,    17,    18,    19,    20,   126,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    61,    36,    62,    38,    39,    40,    41,    42,
+      43,    63,    45,    46,    47,   186,    54,    55,    56,    57,
+      58,    59,    14,    15,    16,    17,    18,    19,    20,   126,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    61,    36,    62,    38,    39,    40,    41,
+      42,    43,    63,    45,    46,    47,   188,    54,    55,    56,
+      57,    58,    59,    14,    15,    16,    17,    18,    19,    20,
+     126,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    61,    36,    62,    38,    39,    40,
+      41,    42,    43,    63,    45,    46,    47,   190,    54,    55,
+      56,    57,    58,    59,    14,    15,    16,    17,    18,    19,
+      20,   126,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    61,    36,    62,    38,    39,
+      40,    41,    42,    43,    63,    45,    46,    47,   192,    54,
+      55,    56,    57,    58,    59,    14,    15,    16,    17,    18,
+      19,    20,   126,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    61,    36,    62,    38,
+      39,    40,    41,    42,    43,    63,    45,    46,    47,   194,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   126,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+     196,    54,    55,    56,    57,    58,    59,    14,    15,    16,
+      17,    18,    19,    20,   126,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    61,    36,
+      62,    38,    39,    40,    41,    42,    43,    63,    45,    46,
+      47,   201,    54,    55,    56,    57,    58,    59,    14,    15,
+      16,    17,    18,    19,    20,   126,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    61,
+      36,    62,    38,    39,    40,    41,    42,    43,    63,    45,
+      46,    47,   203,    54,    55,    56,    57,    58,    59,    14,
+      15,    16,    17,    18,    19,    20,   126,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      61,    36,    62,    38,    39,    40,    41,    42,    43,    63,
+      45,    46,    47,   205,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,    53,    54,    55,    56,    57,    58,    14,
-      15,    16,    17,    18,    19,    20,   245,    22,    23,    24,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,   207,    54,    55,    56,    57,    58,
+      59,    14,    15,    16,    17,    18,    19,    20,   126,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    61,    36,    62,    38,    39,    40,    41,    42,
+      43,    63,    45,    46,    47,   209,    54,    55,    56,    57,
+      58,    59,    14,    15,    16,    17,    18,    19,    20,   126,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    61,    36,    62,    38,    39,    40,    41,
+      42,    43,    63,    45,    46,    47,   211,    54,    55,    56,
+      57,    58,    59,    14,    15,    16,    17,    18,    19,    20,
+     126,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    61,    36,    62,    38,    39,    40,
+      41,    42,    43,    63,    45,    46,    47,   214,    54,    55,
+      56,    57,    58,    59,    14,    15,    16,    17,    18,    19,
+      20,   126,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    61,    36,    62,    38,    39,
+      40,    41,    42,    43,    63,    45,    46,    47,   216,    54,
+      55,    56,    57,    58,    59,    14,    15,    16,    17,    18,
+      19,    20,   126,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    61,    36,    62,    38,
+      39,    40,    41,    42,    43,    63,    45,    46,    47,   218,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   126,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+     220,    54,    55,    56,    57,    58,    59,    14,    15,    16,
+      17,    18,    19,    20,   126,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    61,    36,
+      62,    38,    39,    40,    41,    42,    43,    63,    45,    46,
+      47,   222,    54,    55,    56,    57,    58,    59,    14,    15,
+      16,    17,    18,    19,    20,   126,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    61,
+      36,    62,    38,    39,    40,    41,    42,    43,    63,    45,
+      46,    47,   226,    54,    55,    56,    57,    58,    59,    14,
+      15,    16,    17,    18,    19,    20,   126,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      60,    36,    61,    38,    39,    40,    41,    42,    43,    62,
-      45,    46,   246,   315,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      61,    36,    62,    38,    39,    40,    41,    42,    43,    63,
+      45,    46,    47,   228,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   317,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,   230,    54,    55,    56,    57,    58,
+      59,    14,    15,    16,    17,    18,    19,    20,   126,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    61,    36,    62,    38,    39,    40,    41,    42,
+      43,    63,    45,    46,    47,   232,    54,    55,    56,    57,
+      58,    59,    14,    15,    16,    17,    18,    19,    20,   126,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    61,    36,    62,    38,    39,    40,    41,
+      42,    43,    63,    45,    46,    47,   234,    54,    55,    56,
+      57,    58,    59,    14,    15,    16,    17,    18,    19,    20,
+     126,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    61,    36,    62,    38,    39,    40,
+      41,    42,    43,    63,    45,    46,    47,   236,    54,    55,
+      56,    57,    58,    59,    14,    15,    16,    17,    18,    19,
+      20,   126,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    61,    36,    62,    38,    39,
+      40,    41,    42,    43,    63,    45,    46,    47,   243,    54,
+      55,    56,    57,    58,    59,    14,    15,    16,    17,    18,
+      19,    20,   126,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    61,    36,    62,    38,
+      39,    40,    41,    42,    43,    63,    45,    46,    47,   246,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   126,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+      54,    55,    56,    57,    58,    59,    14,    15,    16,    17,
+      18,    19,    20,   249,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    61,    36,    62,
+      38,    39,    40,    41,    42,    43,    63,    45,    46,    47,
+     250,   319,    54,    55,    56,    57,    58,    59,    14,    15,
+      16,    17,    18,    19,    20,   126,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    61,
+      36,    62,    38,    39,    40,    41,    42,    43,    63,    45,
+      46,    47,   321,    54,    55,    56,    57,    58,    59,    14,
+      15,    16,    17,    18,    19,    20,   126,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      61,    36,    62,    38,    39,    40,    41,    42,    43,    63,
+      45,    46,    47,   358,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,   352,    53,    54,    55,    56,    57,    58,
-      14,    15,    16,    17,    18,    19,    20,   124,    22,    23,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,    54,    55,    56,    57,    58,    59,
+      14,    15,    16,    17,    18,    19,    20,   126,    22,    23,
       24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      34,    60,    36,    61,    38,    39,    40,    41,    42,    43,
-      62,    45,    46,    53,    54,    55,    56,    57,    58,    14,
-      15,    16,    17,    18,    19,    20,   124,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      60,    36,    61,    38,    39,    40,    41,    42,    43,    62,
-      45,    46,    80,   255,   256,   257,   258,    81,    82,   259,
-     260,   261,   262,   263,   264,   265,    83,   266,   267,   268,
-     269,   270,   271,   272,   273,    84,   274,   275,   276,   277,
-     278,   279,   280,   281,   282,     0,   283,   284,   285,   286,
-     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
+      34,    61,    36,    62,    38,    39,    40,    41,    42,    43,
+      63,    45,    46,    47,   115,   265,   266,   116,   117,   267,
+     108,   109,   110,   118,   119,   120,   268,   269,   270,   271,
+     272,   111,   273,   274,   275,   276,   277,   278,   121,   112,
+     279,   280,   281,     0,   282,   283,   284,   285,   286,   287,
+     288,     0,   289,   290,   291,   292,   293,   294,   295,   296,
      297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
+     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
+     317,   318,   323,   324,   325,   326,   327,   328,   329,   330,
      331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
      341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
-     351,   354,   357,   359,   360,   361,   362,   363,   364,   365,
-     366,     5,    50
+     351,   352,   353,   354,   355,   356,   357,   360,   363,   365,
+     366,   367,   368,   369,   370,   371,   372,    51
 };
 
 static const yytype_int16 yycheck[] =
 {
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-      96,    97,    98,     3,   100,   101,   102,   103,   104,     0,
-     106,   107,   108,   109,   110,    34,    35,   113,   114,   115,
-     116,   117,   118,     0,    24,     3,     0,     5,   124,     7,
-     126,   127,     1,    43,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,     3,    13,    14,    15,    14,
-      15,    15,    43,    20,    18,    19,    64,    24,     1,    43,
-      24,    25,    26,     1,    29,     3,    24,    43,    43,    36,
-      37,   197,   198,    43,    43,    39,     1,    14,    15,    17,
-      38,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    10,    11,    12,    43,    33,    15,    16,    13,
-      14,    15,    39,    43,    41,    42,    24,    43,    43,   235,
-      24,    43,    43,   239,    43,    33,   242,    43,    32,   245,
-       1,   129,    43,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,     4,     5,     6,     7,     8,     9,    10,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,     3,   101,   102,   103,   104,   105,   106,
+       0,   108,   109,   110,   111,   112,    34,    35,   115,   116,
+     117,   118,   119,   120,    24,     0,     3,     0,     5,   126,
+       7,   128,   129,     1,    44,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,     3,     1,    44,
+       3,     1,    13,    14,    15,    10,    11,    12,    65,    20,
+      15,    16,    44,    24,    17,    44,    14,    15,    24,    24,
+      44,    44,   199,   200,    44,    36,    37,    44,    33,    14,
+      15,    29,    38,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,     1,    10,     2,    44,    33,    44,
+      15,    16,    44,    44,    39,    44,    41,    42,    43,    24,
+      44,    44,   239,    44,    44,    44,   243,    44,    33,   246,
+      44,    44,   249,     1,   131,    44,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,     3,     4,     5,     6,     7,     8,     9,    10,
       11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
       31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
@@ -1073,207 +1109,163 @@ static const yytype_int16 yycheck[] =
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
+      40,    41,    42,    43,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     3,     4,     5,     6,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
+      40,    41,    42,    43,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     3,     4,     5,     6,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
+      40,    41,    42,    43,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     3,     4,     5,     6,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     4,     5,     6,     7,     8,     9,    10,
+      40,    41,    42,    43,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,     3,     4,     5,     6,     7,     8,     9,    10,
       11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
       21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
       31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
@@ -1281,73 +1273,107 @@ static const yytype_int16 yycheck[] =
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
+      40,    41,    42,    43,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    42,    43,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,     3,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     3,     4,     5,     6,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     3,     4,     5,     6,     7,     8,     9,
+      40,    41,    42,    43,     4,     5,     6,     7,     8,     9,
       10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
       30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    10,    43,    43,    43,    43,    15,    16,    43,
-      43,    43,    43,    43,    43,    43,    24,    43,    43,    43,
-      43,    43,    43,    43,    43,    33,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    -1,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,     2,     5
+      40,    41,    42,    43,    15,    44,    44,    18,    19,    44,
+      13,    14,    15,    24,    25,    26,    44,    44,    44,    44,
+      44,    24,    44,    44,    44,    44,    44,    44,    39,    32,
+      44,    44,    44,    -1,    44,    44,    44,    44,    44,    44,
+      44,    -1,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,     5
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
    symbol of state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
-       0,    45,    46,    47,     0,    47,     1,     3,     4,     5,
+       0,    46,    47,    48,     0,    48,     1,     3,     4,     5,
        6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
       16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
       26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    48,    50,
-      48,    43,     1,     4,     5,     6,     7,     8,     9,    17,
-      31,    33,    40,    43,    50,    43,    13,    14,    15,    20,
-      24,    36,    37,    10,    11,    12,    15,    16,    24,    33,
-      10,    15,    16,    24,    33,    14,    15,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    33,    39,
-      41,    42,    14,    15,    29,     1,    13,    14,    15,    24,
-      32,    34,    35,    15,    18,    19,    24,    25,    26,    39,
-       1,     3,    17,    43,    17,    49,    50,    17,    43,    50,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    49,     3,    24,    38,     3,
-      49,     3,    49,     3,    49,     3,    49,     3,    49,    43,
-       3,    49,     3,    49,     3,    49,     3,    49,     3,    49,
-      43,    43,     3,    49,     3,    49,     3,    49,     3,    49,
-       3,    49,     3,    49,     3,    24,    43,    43,     1,     3,
-      49,    43,     3,    49,    49,    17,    43,    50,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,     3,    49,     3,    49,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,    43,    43,    43,    43,    43,    43,    43,    43,
-      43,    43,     3,    49,    43,    49,    49,    43,    49,    43,
-      43,    43,    43,    43,    43,    43,    43
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    49,
+      51,    49,    44,     1,     4,     5,     6,     7,     8,     9,
+      17,    31,    33,    40,    44,    51,    44,    13,    14,    15,
+      20,    24,    36,    37,    10,    11,    12,    15,    16,    24,
+      33,    10,    15,    16,    24,    33,    14,    15,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    33,
+      39,    41,    42,    43,    14,    15,    29,     1,    13,    14,
+      15,    24,    32,    34,    35,    15,    18,    19,    24,    25,
+      26,    39,     1,     3,    17,    44,    17,    50,    51,    17,
+      44,    51,     3,    50,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    24,
+      38,     3,    50,     3,    50,     3,    50,     3,    50,     3,
+      50,     3,    50,    44,     3,    50,     3,    50,     3,    50,
+       3,    50,     3,    50,    44,    44,     3,    50,     3,    50,
+       3,    50,     3,    50,     3,    50,     3,    50,     3,    24,
+      44,    44,     1,     3,    50,    44,     3,    50,    50,    17,
+      44,    51,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,     3,
+      50,     3,    50,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,    44,    44,
+      44,    44,    44,    44,    44,    44,    44,    44,     3,    50,
+      44,    50,    50,    44,    50,    44,    44,    44,    44,    44,
+      44,    44,    44
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -2160,7 +2186,7 @@ yyreduce:
         case 2:
 
 /* Line 1455 of yacc.c  */
-#line 96 "Grammar.y"
+#line 97 "Grammar.y"
     {
 ;}
     break;
@@ -2168,7 +2194,7 @@ yyreduce:
   case 3:
 
 /* Line 1455 of yacc.c  */
-#line 99 "Grammar.y"
+#line 100 "Grammar.y"
     {
 ;}
     break;
@@ -2176,7 +2202,7 @@ yyreduce:
   case 4:
 
 /* Line 1455 of yacc.c  */
-#line 107 "Grammar.y"
+#line 108 "Grammar.y"
     {
 ;}
     break;
@@ -2184,7 +2210,7 @@ yyreduce:
   case 5:
 
 /* Line 1455 of yacc.c  */
-#line 110 "Grammar.y"
+#line 111 "Grammar.y"
     {
 ;}
     break;
@@ -2192,7 +2218,7 @@ yyreduce:
   case 6:
 
 /* Line 1455 of yacc.c  */
-#line 116 "Grammar.y"
+#line 117 "Grammar.y"
     {
     parser->checkInterrupted();
 ;}
@@ -2201,7 +2227,7 @@ yyreduce:
   case 7:
 
 /* Line 1455 of yacc.c  */
-#line 125 "Grammar.y"
+#line 126 "Grammar.y"
     {
     parser->usage();
 ;}
@@ -2210,7 +2236,7 @@ yyreduce:
   case 8:
 
 /* Line 1455 of yacc.c  */
-#line 129 "Grammar.y"
+#line 130 "Grammar.y"
     {
     return 0;
 ;}
@@ -2219,7 +2245,7 @@ yyreduce:
   case 9:
 
 /* Line 1455 of yacc.c  */
-#line 133 "Grammar.y"
+#line 134 "Grammar.y"
     {
     parser->addApplication((yyvsp[(3) - (4)]));
 ;}
@@ -2228,7 +2254,7 @@ yyreduce:
   case 10:
 
 /* Line 1455 of yacc.c  */
-#line 137 "Grammar.y"
+#line 138 "Grammar.y"
     {
     parser->usage("application", "add");
 ;}
@@ -2237,7 +2263,7 @@ yyreduce:
   case 11:
 
 /* Line 1455 of yacc.c  */
-#line 141 "Grammar.y"
+#line 142 "Grammar.y"
     {
     parser->removeApplication((yyvsp[(3) - (4)]));
 ;}
@@ -2246,7 +2272,7 @@ yyreduce:
   case 12:
 
 /* Line 1455 of yacc.c  */
-#line 145 "Grammar.y"
+#line 146 "Grammar.y"
     {
     parser->usage("application", "remove");
 ;}
@@ -2255,7 +2281,7 @@ yyreduce:
   case 13:
 
 /* Line 1455 of yacc.c  */
-#line 149 "Grammar.y"
+#line 150 "Grammar.y"
     {
     parser->diffApplication((yyvsp[(3) - (4)]));
 ;}
@@ -2264,7 +2290,7 @@ yyreduce:
   case 14:
 
 /* Line 1455 of yacc.c  */
-#line 153 "Grammar.y"
+#line 154 "Grammar.y"
     {
     parser->usage("application", "diff");
 ;}
@@ -2273,7 +2299,7 @@ yyreduce:
   case 15:
 
 /* Line 1455 of yacc.c  */
-#line 157 "Grammar.y"
+#line 158 "Grammar.y"
     {
     parser->updateApplication((yyvsp[(3) - (4)]));
 ;}
@@ -2282,7 +2308,7 @@ yyreduce:
   case 16:
 
 /* Line 1455 of yacc.c  */
-#line 161 "Grammar.y"
+#line 162 "Grammar.y"
     {
     parser->usage("application", "update");
 ;}
@@ -2291,7 +2317,7 @@ yyreduce:
   case 17:
 
 /* Line 1455 of yacc.c  */
-#line 165 "Grammar.y"
+#line 166 "Grammar.y"
     {
     parser->describeApplication((yyvsp[(3) - (4)]));
 ;}
@@ -2300,7 +2326,7 @@ yyreduce:
   case 18:
 
 /* Line 1455 of yacc.c  */
-#line 169 "Grammar.y"
+#line 170 "Grammar.y"
     {
     parser->usage("application", "describe");
 ;}
@@ -2309,7 +2335,7 @@ yyreduce:
   case 19:
 
 /* Line 1455 of yacc.c  */
-#line 173 "Grammar.y"
+#line 174 "Grammar.y"
     {
     parser->patchApplication((yyvsp[(3) - (4)]));
 ;}
@@ -2318,7 +2344,7 @@ yyreduce:
   case 20:
 
 /* Line 1455 of yacc.c  */
-#line 177 "Grammar.y"
+#line 178 "Grammar.y"
     {
     parser->usage("application", "patch");
 ;}
@@ -2327,7 +2353,7 @@ yyreduce:
   case 21:
 
 /* Line 1455 of yacc.c  */
-#line 181 "Grammar.y"
+#line 182 "Grammar.y"
     {
     parser->listAllApplications((yyvsp[(3) - (4)]));
 ;}
@@ -2336,7 +2362,7 @@ yyreduce:
   case 22:
 
 /* Line 1455 of yacc.c  */
-#line 185 "Grammar.y"
+#line 186 "Grammar.y"
     {
     parser->usage("application", "list");
 ;}
@@ -2345,7 +2371,7 @@ yyreduce:
   case 23:
 
 /* Line 1455 of yacc.c  */
-#line 189 "Grammar.y"
+#line 190 "Grammar.y"
     {
     parser->describeServerTemplate((yyvsp[(4) - (5)]));
 ;}
@@ -2354,7 +2380,7 @@ yyreduce:
   case 24:
 
 /* Line 1455 of yacc.c  */
-#line 193 "Grammar.y"
+#line 194 "Grammar.y"
     {
     parser->usage("server template", "describe");
 ;}
@@ -2363,7 +2389,7 @@ yyreduce:
   case 25:
 
 /* Line 1455 of yacc.c  */
-#line 197 "Grammar.y"
+#line 198 "Grammar.y"
     {
     parser->instantiateServerTemplate((yyvsp[(4) - (5)]));
 ;}
@@ -2372,7 +2398,7 @@ yyreduce:
   case 26:
 
 /* Line 1455 of yacc.c  */
-#line 201 "Grammar.y"
+#line 202 "Grammar.y"
     {
     parser->usage("server template", "instantiate");
 ;}
@@ -2381,7 +2407,7 @@ yyreduce:
   case 27:
 
 /* Line 1455 of yacc.c  */
-#line 205 "Grammar.y"
+#line 206 "Grammar.y"
     {
     parser->usage("server template");
 ;}
@@ -2390,7 +2416,7 @@ yyreduce:
   case 28:
 
 /* Line 1455 of yacc.c  */
-#line 209 "Grammar.y"
+#line 210 "Grammar.y"
     {
     parser->describeServiceTemplate((yyvsp[(4) - (5)]));
 ;}
@@ -2399,7 +2425,7 @@ yyreduce:
   case 29:
 
 /* Line 1455 of yacc.c  */
-#line 213 "Grammar.y"
+#line 214 "Grammar.y"
     {
     parser->usage("service template", "describe");
 ;}
@@ -2408,7 +2434,7 @@ yyreduce:
   case 30:
 
 /* Line 1455 of yacc.c  */
-#line 217 "Grammar.y"
+#line 218 "Grammar.y"
     {
     parser->usage("service template");
 ;}
@@ -2417,7 +2443,7 @@ yyreduce:
   case 31:
 
 /* Line 1455 of yacc.c  */
-#line 221 "Grammar.y"
+#line 222 "Grammar.y"
     {
     parser->describeNode((yyvsp[(3) - (4)]));
 ;}
@@ -2426,7 +2452,7 @@ yyreduce:
   case 32:
 
 /* Line 1455 of yacc.c  */
-#line 225 "Grammar.y"
+#line 226 "Grammar.y"
     {
     parser->usage("node", "describe");
 ;}
@@ -2435,7 +2461,7 @@ yyreduce:
   case 33:
 
 /* Line 1455 of yacc.c  */
-#line 229 "Grammar.y"
+#line 230 "Grammar.y"
     {
     parser->pingNode((yyvsp[(3) - (4)]));
 ;}
@@ -2444,7 +2470,7 @@ yyreduce:
   case 34:
 
 /* Line 1455 of yacc.c  */
-#line 233 "Grammar.y"
+#line 234 "Grammar.y"
     {
     parser->usage("node", "ping");
 ;}
@@ -2453,7 +2479,7 @@ yyreduce:
   case 35:
 
 /* Line 1455 of yacc.c  */
-#line 237 "Grammar.y"
+#line 238 "Grammar.y"
     {
     parser->printLoadNode((yyvsp[(3) - (4)]));
 ;}
@@ -2462,7 +2488,7 @@ yyreduce:
   case 36:
 
 /* Line 1455 of yacc.c  */
-#line 241 "Grammar.y"
+#line 242 "Grammar.y"
     {
     parser->usage("node", "load");
 ;}
@@ -2471,7 +2497,7 @@ yyreduce:
   case 37:
 
 /* Line 1455 of yacc.c  */
-#line 245 "Grammar.y"
+#line 246 "Grammar.y"
     {
     parser->printNodeProcessorSockets((yyvsp[(3) - (4)]));
 ;}
@@ -2480,7 +2506,7 @@ yyreduce:
   case 38:
 
 /* Line 1455 of yacc.c  */
-#line 249 "Grammar.y"
+#line 250 "Grammar.y"
     {
     parser->usage("node", "sockets");
 ;}
@@ -2489,7 +2515,7 @@ yyreduce:
   case 39:
 
 /* Line 1455 of yacc.c  */
-#line 253 "Grammar.y"
+#line 254 "Grammar.y"
     {
     parser->shutdownNode((yyvsp[(3) - (4)]));
 ;}
@@ -2498,7 +2524,7 @@ yyreduce:
   case 40:
 
 /* Line 1455 of yacc.c  */
-#line 257 "Grammar.y"
+#line 258 "Grammar.y"
     {
     parser->usage("node", "shutdown");
 ;}
@@ -2507,7 +2533,7 @@ yyreduce:
   case 41:
 
 /* Line 1455 of yacc.c  */
-#line 261 "Grammar.y"
+#line 262 "Grammar.y"
     {
     parser->listAllNodes((yyvsp[(3) - (4)]));
 ;}
@@ -2516,7 +2542,7 @@ yyreduce:
   case 42:
 
 /* Line 1455 of yacc.c  */
-#line 265 "Grammar.y"
+#line 266 "Grammar.y"
     {
     parser->usage("node", "list");
 ;}
@@ -2525,7 +2551,7 @@ yyreduce:
   case 43:
 
 /* Line 1455 of yacc.c  */
-#line 269 "Grammar.y"
+#line 270 "Grammar.y"
     {
     parser->show("node", (yyvsp[(3) - (4)]));
 ;}
@@ -2534,7 +2560,7 @@ yyreduce:
   case 44:
 
 /* Line 1455 of yacc.c  */
-#line 273 "Grammar.y"
+#line 274 "Grammar.y"
     {
     parser->usage("node", "show");
 ;}
@@ -2543,7 +2569,7 @@ yyreduce:
   case 45:
 
 /* Line 1455 of yacc.c  */
-#line 277 "Grammar.y"
+#line 278 "Grammar.y"
     {
     parser->describeRegistry((yyvsp[(3) - (4)]));
 ;}
@@ -2552,7 +2578,7 @@ yyreduce:
   case 46:
 
 /* Line 1455 of yacc.c  */
-#line 281 "Grammar.y"
+#line 282 "Grammar.y"
     {
     parser->usage("registry", "describe");
 ;}
@@ -2561,7 +2587,7 @@ yyreduce:
   case 47:
 
 /* Line 1455 of yacc.c  */
-#line 285 "Grammar.y"
+#line 286 "Grammar.y"
     {
     parser->pingRegistry((yyvsp[(3) - (4)]));
 ;}
@@ -2570,7 +2596,7 @@ yyreduce:
   case 48:
 
 /* Line 1455 of yacc.c  */
-#line 289 "Grammar.y"
+#line 290 "Grammar.y"
     {
     parser->usage("registry", "ping");
 ;}
@@ -2579,7 +2605,7 @@ yyreduce:
   case 49:
 
 /* Line 1455 of yacc.c  */
-#line 293 "Grammar.y"
+#line 294 "Grammar.y"
     {
     parser->shutdownRegistry((yyvsp[(3) - (4)]));
 ;}
@@ -2588,7 +2614,7 @@ yyreduce:
   case 50:
 
 /* Line 1455 of yacc.c  */
-#line 297 "Grammar.y"
+#line 298 "Grammar.y"
     {
     parser->usage("registry", "shutdown");
 ;}
@@ -2597,7 +2623,7 @@ yyreduce:
   case 51:
 
 /* Line 1455 of yacc.c  */
-#line 301 "Grammar.y"
+#line 302 "Grammar.y"
     {
     parser->listAllRegistries((yyvsp[(3) - (4)]));
 ;}
@@ -2606,7 +2632,7 @@ yyreduce:
   case 52:
 
 /* Line 1455 of yacc.c  */
-#line 305 "Grammar.y"
+#line 306 "Grammar.y"
     {
     parser->usage("registry", "list");
 ;}
@@ -2615,7 +2641,7 @@ yyreduce:
   case 53:
 
 /* Line 1455 of yacc.c  */
-#line 309 "Grammar.y"
+#line 310 "Grammar.y"
     {
     parser->show("registry", (yyvsp[(3) - (4)]));
 ;}
@@ -2624,7 +2650,7 @@ yyreduce:
   case 54:
 
 /* Line 1455 of yacc.c  */
-#line 313 "Grammar.y"
+#line 314 "Grammar.y"
     {
     parser->usage("registry", "show");
 ;}
@@ -2633,7 +2659,7 @@ yyreduce:
   case 55:
 
 /* Line 1455 of yacc.c  */
-#line 317 "Grammar.y"
+#line 318 "Grammar.y"
     {
     parser->removeServer((yyvsp[(3) - (4)]));
 ;}
@@ -2642,7 +2668,7 @@ yyreduce:
   case 56:
 
 /* Line 1455 of yacc.c  */
-#line 321 "Grammar.y"
+#line 322 "Grammar.y"
     {
     parser->usage("server", "remove");
 ;}
@@ -2651,7 +2677,7 @@ yyreduce:
   case 57:
 
 /* Line 1455 of yacc.c  */
-#line 325 "Grammar.y"
+#line 326 "Grammar.y"
     {
     parser->describeServer((yyvsp[(3) - (4)]));
 ;}
@@ -2660,7 +2686,7 @@ yyreduce:
   case 58:
 
 /* Line 1455 of yacc.c  */
-#line 329 "Grammar.y"
+#line 330 "Grammar.y"
     {
     parser->usage("server", "describe");
 ;}
@@ -2669,7 +2695,7 @@ yyreduce:
   case 59:
 
 /* Line 1455 of yacc.c  */
-#line 333 "Grammar.y"
+#line 334 "Grammar.y"
     {
     parser->startServer((yyvsp[(3) - (4)]));
 ;}
@@ -2678,7 +2704,7 @@ yyreduce:
   case 60:
 
 /* Line 1455 of yacc.c  */
-#line 337 "Grammar.y"
+#line 338 "Grammar.y"
     {
     parser->usage("server", "start");
 ;}
@@ -2687,7 +2713,7 @@ yyreduce:
   case 61:
 
 /* Line 1455 of yacc.c  */
-#line 341 "Grammar.y"
+#line 342 "Grammar.y"
     {
     parser->stopServer((yyvsp[(3) - (4)]));
 ;}
@@ -2696,7 +2722,7 @@ yyreduce:
   case 62:
 
 /* Line 1455 of yacc.c  */
-#line 345 "Grammar.y"
+#line 346 "Grammar.y"
     {
     parser->usage("server", "stop");
 ;}
@@ -2705,7 +2731,7 @@ yyreduce:
   case 63:
 
 /* Line 1455 of yacc.c  */
-#line 349 "Grammar.y"
+#line 350 "Grammar.y"
     {
     parser->patchServer((yyvsp[(3) - (4)]));
 ;}
@@ -2714,7 +2740,7 @@ yyreduce:
   case 64:
 
 /* Line 1455 of yacc.c  */
-#line 353 "Grammar.y"
+#line 354 "Grammar.y"
     {
     parser->usage("server", "patch");
 ;}
@@ -2723,7 +2749,7 @@ yyreduce:
   case 65:
 
 /* Line 1455 of yacc.c  */
-#line 357 "Grammar.y"
+#line 358 "Grammar.y"
     {
     parser->signalServer((yyvsp[(3) - (4)]));
 ;}
@@ -2732,7 +2758,7 @@ yyreduce:
   case 66:
 
 /* Line 1455 of yacc.c  */
-#line 361 "Grammar.y"
+#line 362 "Grammar.y"
     {
     parser->usage("server", "signal");
 ;}
@@ -2741,7 +2767,7 @@ yyreduce:
   case 67:
 
 /* Line 1455 of yacc.c  */
-#line 365 "Grammar.y"
+#line 366 "Grammar.y"
     {
     parser->writeMessage((yyvsp[(3) - (4)]), 1);
 ;}
@@ -2750,7 +2776,7 @@ yyreduce:
   case 68:
 
 /* Line 1455 of yacc.c  */
-#line 369 "Grammar.y"
+#line 370 "Grammar.y"
     {
     parser->usage("server", "stdout");
 ;}
@@ -2759,7 +2785,7 @@ yyreduce:
   case 69:
 
 /* Line 1455 of yacc.c  */
-#line 373 "Grammar.y"
+#line 374 "Grammar.y"
     {
     parser->writeMessage((yyvsp[(3) - (4)]), 2);
 ;}
@@ -2768,7 +2794,7 @@ yyreduce:
   case 70:
 
 /* Line 1455 of yacc.c  */
-#line 377 "Grammar.y"
+#line 378 "Grammar.y"
     {
     parser->usage("server", "stderr");
 ;}
@@ -2777,7 +2803,7 @@ yyreduce:
   case 71:
 
 /* Line 1455 of yacc.c  */
-#line 381 "Grammar.y"
+#line 382 "Grammar.y"
     {
     parser->stateServer((yyvsp[(3) - (4)]));
 ;}
@@ -2786,7 +2812,7 @@ yyreduce:
   case 72:
 
 /* Line 1455 of yacc.c  */
-#line 385 "Grammar.y"
+#line 386 "Grammar.y"
     {
     parser->usage("server", "start");
 ;}
@@ -2795,7 +2821,7 @@ yyreduce:
   case 73:
 
 /* Line 1455 of yacc.c  */
-#line 389 "Grammar.y"
+#line 390 "Grammar.y"
     {
     parser->pidServer((yyvsp[(3) - (4)]));
 ;}
@@ -2804,7 +2830,7 @@ yyreduce:
   case 74:
 
 /* Line 1455 of yacc.c  */
-#line 393 "Grammar.y"
+#line 394 "Grammar.y"
     {
     parser->usage("server", "pid");
 ;}
@@ -2813,7 +2839,7 @@ yyreduce:
   case 75:
 
 /* Line 1455 of yacc.c  */
-#line 397 "Grammar.y"
+#line 398 "Grammar.y"
     {
     parser->propertiesServer((yyvsp[(3) - (4)]), false);
 ;}
@@ -2822,7 +2848,7 @@ yyreduce:
   case 76:
 
 /* Line 1455 of yacc.c  */
-#line 401 "Grammar.y"
+#line 402 "Grammar.y"
     {
     parser->usage("server", "properties");
 ;}
@@ -2831,376 +2857,394 @@ yyreduce:
   case 77:
 
 /* Line 1455 of yacc.c  */
-#line 405 "Grammar.y"
+#line 406 "Grammar.y"
     {
-    parser->propertiesServer((yyvsp[(3) - (4)]), true);
+    parser->metricsServer((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 78:
 
 /* Line 1455 of yacc.c  */
-#line 409 "Grammar.y"
+#line 410 "Grammar.y"
     {
-    parser->usage("server", "property");
+    parser->usage("server", "metrics");
 ;}
     break;
 
   case 79:
 
 /* Line 1455 of yacc.c  */
-#line 413 "Grammar.y"
+#line 414 "Grammar.y"
     {
-    parser->enableServer((yyvsp[(3) - (4)]), true);
+    parser->propertiesServer((yyvsp[(3) - (4)]), true);
 ;}
     break;
 
   case 80:
 
 /* Line 1455 of yacc.c  */
-#line 417 "Grammar.y"
+#line 418 "Grammar.y"
     {
-    parser->usage("server", "enable");
+    parser->usage("server", "property");
 ;}
     break;
 
   case 81:
 
 /* Line 1455 of yacc.c  */
-#line 421 "Grammar.y"
+#line 422 "Grammar.y"
     {
-    parser->enableServer((yyvsp[(3) - (4)]), false);
+    parser->enableServer((yyvsp[(3) - (4)]), true);
 ;}
     break;
 
   case 82:
 
 /* Line 1455 of yacc.c  */
-#line 425 "Grammar.y"
+#line 426 "Grammar.y"
     {
-    parser->usage("server", "disable");
+    parser->usage("server", "enable");
 ;}
     break;
 
   case 83:
 
 /* Line 1455 of yacc.c  */
-#line 429 "Grammar.y"
+#line 430 "Grammar.y"
     {
-    parser->listAllServers((yyvsp[(3) - (4)]));
+    parser->enableServer((yyvsp[(3) - (4)]), false);
 ;}
     break;
 
   case 84:
 
 /* Line 1455 of yacc.c  */
-#line 433 "Grammar.y"
+#line 434 "Grammar.y"
     {
-    parser->usage("server", "list");
+    parser->usage("server", "disable");
 ;}
     break;
 
   case 85:
 
 /* Line 1455 of yacc.c  */
-#line 437 "Grammar.y"
+#line 438 "Grammar.y"
     {
-    parser->show("server", (yyvsp[(3) - (4)]));
+    parser->listAllServers((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 86:
 
 /* Line 1455 of yacc.c  */
-#line 441 "Grammar.y"
+#line 442 "Grammar.y"
     {
-    parser->usage("server", "show");
+    parser->usage("server", "list");
 ;}
     break;
 
   case 87:
 
 /* Line 1455 of yacc.c  */
-#line 445 "Grammar.y"
+#line 446 "Grammar.y"
     {
-    parser->startService((yyvsp[(3) - (4)]));
+    parser->show("server", (yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 88:
 
 /* Line 1455 of yacc.c  */
-#line 449 "Grammar.y"
+#line 450 "Grammar.y"
     {
-    parser->usage("service", "start");
+    parser->usage("server", "show");
 ;}
     break;
 
   case 89:
 
 /* Line 1455 of yacc.c  */
-#line 453 "Grammar.y"
+#line 454 "Grammar.y"
     {
-    parser->stopService((yyvsp[(3) - (4)]));
+    parser->startService((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 90:
 
 /* Line 1455 of yacc.c  */
-#line 457 "Grammar.y"
+#line 458 "Grammar.y"
     {
-    parser->usage("service", "stop");
+    parser->usage("service", "start");
 ;}
     break;
 
   case 91:
 
 /* Line 1455 of yacc.c  */
-#line 461 "Grammar.y"
+#line 462 "Grammar.y"
     {
-    parser->describeService((yyvsp[(3) - (4)]));
+    parser->stopService((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 92:
 
 /* Line 1455 of yacc.c  */
-#line 465 "Grammar.y"
+#line 466 "Grammar.y"
     {
-    parser->usage("service", "describe");
+    parser->usage("service", "stop");
 ;}
     break;
 
   case 93:
 
 /* Line 1455 of yacc.c  */
-#line 469 "Grammar.y"
+#line 470 "Grammar.y"
     {
-    parser->propertiesService((yyvsp[(3) - (4)]), false);
+    parser->describeService((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 94:
 
 /* Line 1455 of yacc.c  */
-#line 473 "Grammar.y"
+#line 474 "Grammar.y"
     {
-    parser->usage("service", "properties");
+    parser->usage("service", "describe");
 ;}
     break;
 
   case 95:
 
 /* Line 1455 of yacc.c  */
-#line 477 "Grammar.y"
+#line 478 "Grammar.y"
     {
-    parser->propertiesService((yyvsp[(3) - (4)]), true);
+    parser->propertiesService((yyvsp[(3) - (4)]), false);
 ;}
     break;
 
   case 96:
 
 /* Line 1455 of yacc.c  */
-#line 481 "Grammar.y"
+#line 482 "Grammar.y"
     {
-    parser->usage("service", "property");
+    parser->usage("service", "properties");
 ;}
     break;
 
   case 97:
 
 /* Line 1455 of yacc.c  */
-#line 485 "Grammar.y"
+#line 486 "Grammar.y"
     {
-    parser->listServices((yyvsp[(3) - (4)]));
+    parser->propertiesService((yyvsp[(3) - (4)]), true);
 ;}
     break;
 
   case 98:
 
 /* Line 1455 of yacc.c  */
-#line 489 "Grammar.y"
+#line 490 "Grammar.y"
     {
-    parser->usage("service", "list");
+    parser->usage("service", "property");
 ;}
     break;
 
   case 99:
 
 /* Line 1455 of yacc.c  */
-#line 493 "Grammar.y"
+#line 494 "Grammar.y"
     {
-    parser->endpointsAdapter((yyvsp[(3) - (4)]));
+    parser->listServices((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 100:
 
 /* Line 1455 of yacc.c  */
-#line 497 "Grammar.y"
+#line 498 "Grammar.y"
     {
-    parser->usage("adapter", "endpoints");
+    parser->usage("service", "list");
 ;}
     break;
 
   case 101:
 
 /* Line 1455 of yacc.c  */
-#line 501 "Grammar.y"
+#line 502 "Grammar.y"
     {
-    parser->removeAdapter((yyvsp[(3) - (4)]));
+    parser->endpointsAdapter((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 102:
 
 /* Line 1455 of yacc.c  */
-#line 505 "Grammar.y"
+#line 506 "Grammar.y"
     {
-    parser->usage("adapter", "remove");
+    parser->usage("adapter", "endpoints");
 ;}
     break;
 
   case 103:
 
 /* Line 1455 of yacc.c  */
-#line 509 "Grammar.y"
+#line 510 "Grammar.y"
     {
-    parser->listAllAdapters((yyvsp[(3) - (4)]));
+    parser->removeAdapter((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 104:
 
 /* Line 1455 of yacc.c  */
-#line 513 "Grammar.y"
+#line 514 "Grammar.y"
     {
-    parser->usage("adapter", "list");
+    parser->usage("adapter", "remove");
 ;}
     break;
 
   case 105:
 
 /* Line 1455 of yacc.c  */
-#line 517 "Grammar.y"
+#line 518 "Grammar.y"
     {
-    parser->addObject((yyvsp[(3) - (4)]));
+    parser->listAllAdapters((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 106:
 
 /* Line 1455 of yacc.c  */
-#line 521 "Grammar.y"
+#line 522 "Grammar.y"
     {
-    parser->usage("object", "add");
+    parser->usage("adapter", "list");
 ;}
     break;
 
   case 107:
 
 /* Line 1455 of yacc.c  */
-#line 525 "Grammar.y"
+#line 526 "Grammar.y"
     {
-    parser->removeObject((yyvsp[(3) - (4)]));
+    parser->addObject((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 108:
 
 /* Line 1455 of yacc.c  */
-#line 529 "Grammar.y"
+#line 530 "Grammar.y"
     {
-    parser->usage("object", "remove");
+    parser->usage("object", "add");
 ;}
     break;
 
   case 109:
 
 /* Line 1455 of yacc.c  */
-#line 533 "Grammar.y"
+#line 534 "Grammar.y"
     {
-    parser->findObject((yyvsp[(3) - (4)]));
+    parser->removeObject((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 110:
 
 /* Line 1455 of yacc.c  */
-#line 537 "Grammar.y"
+#line 538 "Grammar.y"
     {
-    parser->usage("object", "find");
+    parser->usage("object", "remove");
 ;}
     break;
 
   case 111:
 
 /* Line 1455 of yacc.c  */
-#line 541 "Grammar.y"
+#line 542 "Grammar.y"
     {
-    parser->listObject((yyvsp[(3) - (4)]));
+    parser->findObject((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 112:
 
 /* Line 1455 of yacc.c  */
-#line 545 "Grammar.y"
+#line 546 "Grammar.y"
     {
-    parser->usage("object", "list");
+    parser->usage("object", "find");
 ;}
     break;
 
   case 113:
 
 /* Line 1455 of yacc.c  */
-#line 549 "Grammar.y"
+#line 550 "Grammar.y"
     {
-    parser->describeObject((yyvsp[(3) - (4)]));
+    parser->listObject((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 114:
 
 /* Line 1455 of yacc.c  */
-#line 553 "Grammar.y"
+#line 554 "Grammar.y"
     {
-    parser->usage("object", "describe");
+    parser->usage("object", "list");
 ;}
     break;
 
   case 115:
 
 /* Line 1455 of yacc.c  */
-#line 557 "Grammar.y"
+#line 558 "Grammar.y"
     {
-    parser->showCopying();
+    parser->describeObject((yyvsp[(3) - (4)]));
 ;}
     break;
 
   case 116:
 
 /* Line 1455 of yacc.c  */
-#line 561 "Grammar.y"
+#line 562 "Grammar.y"
     {
-    parser->showWarranty();
+    parser->usage("object", "describe");
 ;}
     break;
 
   case 117:
 
 /* Line 1455 of yacc.c  */
-#line 565 "Grammar.y"
+#line 566 "Grammar.y"
     {
-    parser->usage((yyvsp[(2) - (3)]).front());
+    parser->showCopying();
 ;}
     break;
 
   case 118:
 
 /* Line 1455 of yacc.c  */
-#line 569 "Grammar.y"
+#line 570 "Grammar.y"
+    {
+    parser->showWarranty();
+;}
+    break;
+
+  case 119:
+
+/* Line 1455 of yacc.c  */
+#line 574 "Grammar.y"
+    {
+    parser->usage((yyvsp[(2) - (3)]).front());
+;}
+    break;
+
+  case 120:
+
+/* Line 1455 of yacc.c  */
+#line 578 "Grammar.y"
     {
     if(((yyvsp[(2) - (4)]).front() == "server" || (yyvsp[(2) - (4)]).front() == "service") && (yyvsp[(3) - (4)]).front() == "template")
     {
@@ -3213,19 +3257,19 @@ yyreduce:
 ;}
     break;
 
-  case 119:
+  case 121:
 
 /* Line 1455 of yacc.c  */
-#line 580 "Grammar.y"
+#line 589 "Grammar.y"
     {
     parser->usage((yyvsp[(2) - (5)]).front(), (yyvsp[(3) - (5)]).front());
 ;}
     break;
 
-  case 120:
+  case 122:
 
 /* Line 1455 of yacc.c  */
-#line 584 "Grammar.y"
+#line 593 "Grammar.y"
     {
     if(((yyvsp[(2) - (5)]).front() == "server" || (yyvsp[(2) - (5)]).front() == "service") && (yyvsp[(3) - (5)]).front() == "template")
     {
@@ -3238,10 +3282,10 @@ yyreduce:
 ;}
     break;
 
-  case 121:
+  case 123:
 
 /* Line 1455 of yacc.c  */
-#line 595 "Grammar.y"
+#line 604 "Grammar.y"
     {
     if(((yyvsp[(2) - (6)]).front() == "server" || (yyvsp[(2) - (6)]).front() == "service") && (yyvsp[(3) - (6)]).front() == "template")
     {
@@ -3254,37 +3298,37 @@ yyreduce:
 ;}
     break;
 
-  case 122:
+  case 124:
 
 /* Line 1455 of yacc.c  */
-#line 606 "Grammar.y"
+#line 615 "Grammar.y"
     {
     parser->usage((yyvsp[(2) - (4)]).front());
 ;}
     break;
 
-  case 123:
+  case 125:
 
 /* Line 1455 of yacc.c  */
-#line 610 "Grammar.y"
+#line 619 "Grammar.y"
     {
     parser->usage();
 ;}
     break;
 
-  case 124:
+  case 126:
 
 /* Line 1455 of yacc.c  */
-#line 614 "Grammar.y"
+#line 623 "Grammar.y"
     {
     parser->usage((yyvsp[(1) - (3)]).front());
 ;}
     break;
 
-  case 125:
+  case 127:
 
 /* Line 1455 of yacc.c  */
-#line 618 "Grammar.y"
+#line 627 "Grammar.y"
     {
     (yyvsp[(1) - (4)]).push_back((yyvsp[(2) - (4)]).front());
     parser->invalidCommand((yyvsp[(1) - (4)]));
@@ -3292,67 +3336,67 @@ yyreduce:
 ;}
     break;
 
-  case 126:
+  case 128:
 
 /* Line 1455 of yacc.c  */
-#line 624 "Grammar.y"
+#line 633 "Grammar.y"
     {
     parser->invalidCommand((yyvsp[(1) - (3)]));
     yyerrok;
 ;}
     break;
 
-  case 127:
+  case 129:
 
 /* Line 1455 of yacc.c  */
-#line 629 "Grammar.y"
+#line 638 "Grammar.y"
     {
     parser->invalidCommand((yyvsp[(1) - (3)]));
     yyerrok;
 ;}
     break;
 
-  case 128:
+  case 130:
 
 /* Line 1455 of yacc.c  */
-#line 634 "Grammar.y"
+#line 643 "Grammar.y"
     {
     yyerrok;
 ;}
     break;
 
-  case 129:
+  case 131:
 
 /* Line 1455 of yacc.c  */
-#line 638 "Grammar.y"
+#line 647 "Grammar.y"
     {
 ;}
     break;
 
-  case 130:
+  case 132:
 
 /* Line 1455 of yacc.c  */
-#line 647 "Grammar.y"
+#line 656 "Grammar.y"
     {
     (yyval) = (yyvsp[(2) - (2)]);
     (yyval).push_front((yyvsp[(1) - (2)]).front());
 ;}
     break;
 
-  case 131:
+  case 133:
 
 /* Line 1455 of yacc.c  */
-#line 652 "Grammar.y"
+#line 661 "Grammar.y"
     {
     (yyval) = (yyvsp[(2) - (2)]);
     (yyval).push_front((yyvsp[(1) - (2)]).front());
 ;}
     break;
 
-  case 132:
+  case 134:
 
 /* Line 1455 of yacc.c  */
-#line 657 "Grammar.y"
+#line 666 "Grammar.y"
     {
     (yyval) = (yyvsp[(2) - (3)]);
     (yyval).push_front("help");
@@ -3360,10 +3404,10 @@ yyreduce:
 ;}
     break;
 
-  case 133:
+  case 135:
 
 /* Line 1455 of yacc.c  */
-#line 663 "Grammar.y"
+#line 672 "Grammar.y"
     {
     (yyval) = (yyvsp[(2) - (3)]);
     (yyval).push_front("help");
@@ -3371,35 +3415,19 @@ yyreduce:
 ;}
     break;
 
-  case 134:
-
-/* Line 1455 of yacc.c  */
-#line 669 "Grammar.y"
-    {
-    (yyval) = YYSTYPE();
-;}
-    break;
-
-  case 135:
-
-/* Line 1455 of yacc.c  */
-#line 678 "Grammar.y"
-    {
-;}
-    break;
-
   case 136:
 
 /* Line 1455 of yacc.c  */
-#line 681 "Grammar.y"
+#line 678 "Grammar.y"
     {
+    (yyval) = YYSTYPE();
 ;}
     break;
 
   case 137:
 
 /* Line 1455 of yacc.c  */
-#line 684 "Grammar.y"
+#line 687 "Grammar.y"
     {
 ;}
     break;
@@ -3407,7 +3435,7 @@ yyreduce:
   case 138:
 
 /* Line 1455 of yacc.c  */
-#line 687 "Grammar.y"
+#line 690 "Grammar.y"
     {
 ;}
     break;
@@ -3415,7 +3443,7 @@ yyreduce:
   case 139:
 
 /* Line 1455 of yacc.c  */
-#line 690 "Grammar.y"
+#line 693 "Grammar.y"
     {
 ;}
     break;
@@ -3423,7 +3451,7 @@ yyreduce:
   case 140:
 
 /* Line 1455 of yacc.c  */
-#line 693 "Grammar.y"
+#line 696 "Grammar.y"
     {
 ;}
     break;
@@ -3431,7 +3459,7 @@ yyreduce:
   case 141:
 
 /* Line 1455 of yacc.c  */
-#line 696 "Grammar.y"
+#line 699 "Grammar.y"
     {
 ;}
     break;
@@ -3439,7 +3467,7 @@ yyreduce:
   case 142:
 
 /* Line 1455 of yacc.c  */
-#line 699 "Grammar.y"
+#line 702 "Grammar.y"
     {
 ;}
     break;
@@ -3447,7 +3475,7 @@ yyreduce:
   case 143:
 
 /* Line 1455 of yacc.c  */
-#line 702 "Grammar.y"
+#line 705 "Grammar.y"
     {
 ;}
     break;
@@ -3455,7 +3483,7 @@ yyreduce:
   case 144:
 
 /* Line 1455 of yacc.c  */
-#line 705 "Grammar.y"
+#line 708 "Grammar.y"
     {
 ;}
     break;
@@ -3463,7 +3491,7 @@ yyreduce:
   case 145:
 
 /* Line 1455 of yacc.c  */
-#line 708 "Grammar.y"
+#line 711 "Grammar.y"
     {
 ;}
     break;
@@ -3471,7 +3499,7 @@ yyreduce:
   case 146:
 
 /* Line 1455 of yacc.c  */
-#line 711 "Grammar.y"
+#line 714 "Grammar.y"
     {
 ;}
     break;
@@ -3479,7 +3507,7 @@ yyreduce:
   case 147:
 
 /* Line 1455 of yacc.c  */
-#line 714 "Grammar.y"
+#line 717 "Grammar.y"
     {
 ;}
     break;
@@ -3487,7 +3515,7 @@ yyreduce:
   case 148:
 
 /* Line 1455 of yacc.c  */
-#line 717 "Grammar.y"
+#line 720 "Grammar.y"
     {
 ;}
     break;
@@ -3495,7 +3523,7 @@ yyreduce:
   case 149:
 
 /* Line 1455 of yacc.c  */
-#line 720 "Grammar.y"
+#line 723 "Grammar.y"
     {
 ;}
     break;
@@ -3503,7 +3531,7 @@ yyreduce:
   case 150:
 
 /* Line 1455 of yacc.c  */
-#line 723 "Grammar.y"
+#line 726 "Grammar.y"
     {
 ;}
     break;
@@ -3511,7 +3539,7 @@ yyreduce:
   case 151:
 
 /* Line 1455 of yacc.c  */
-#line 726 "Grammar.y"
+#line 729 "Grammar.y"
     {
 ;}
     break;
@@ -3519,7 +3547,7 @@ yyreduce:
   case 152:
 
 /* Line 1455 of yacc.c  */
-#line 729 "Grammar.y"
+#line 732 "Grammar.y"
     {
 ;}
     break;
@@ -3527,7 +3555,7 @@ yyreduce:
   case 153:
 
 /* Line 1455 of yacc.c  */
-#line 732 "Grammar.y"
+#line 735 "Grammar.y"
     {
 ;}
     break;
@@ -3535,7 +3563,7 @@ yyreduce:
   case 154:
 
 /* Line 1455 of yacc.c  */
-#line 735 "Grammar.y"
+#line 738 "Grammar.y"
     {
 ;}
     break;
@@ -3543,7 +3571,7 @@ yyreduce:
   case 155:
 
 /* Line 1455 of yacc.c  */
-#line 738 "Grammar.y"
+#line 741 "Grammar.y"
     {
 ;}
     break;
@@ -3551,7 +3579,7 @@ yyreduce:
   case 156:
 
 /* Line 1455 of yacc.c  */
-#line 741 "Grammar.y"
+#line 744 "Grammar.y"
     {
 ;}
     break;
@@ -3559,7 +3587,7 @@ yyreduce:
   case 157:
 
 /* Line 1455 of yacc.c  */
-#line 744 "Grammar.y"
+#line 747 "Grammar.y"
     {
 ;}
     break;
@@ -3567,7 +3595,7 @@ yyreduce:
   case 158:
 
 /* Line 1455 of yacc.c  */
-#line 747 "Grammar.y"
+#line 750 "Grammar.y"
     {
 ;}
     break;
@@ -3575,7 +3603,7 @@ yyreduce:
   case 159:
 
 /* Line 1455 of yacc.c  */
-#line 750 "Grammar.y"
+#line 753 "Grammar.y"
     {
 ;}
     break;
@@ -3583,7 +3611,7 @@ yyreduce:
   case 160:
 
 /* Line 1455 of yacc.c  */
-#line 753 "Grammar.y"
+#line 756 "Grammar.y"
     {
 ;}
     break;
@@ -3591,7 +3619,7 @@ yyreduce:
   case 161:
 
 /* Line 1455 of yacc.c  */
-#line 756 "Grammar.y"
+#line 759 "Grammar.y"
     {
 ;}
     break;
@@ -3599,7 +3627,7 @@ yyreduce:
   case 162:
 
 /* Line 1455 of yacc.c  */
-#line 759 "Grammar.y"
+#line 762 "Grammar.y"
     {
 ;}
     break;
@@ -3607,7 +3635,7 @@ yyreduce:
   case 163:
 
 /* Line 1455 of yacc.c  */
-#line 762 "Grammar.y"
+#line 765 "Grammar.y"
     {
 ;}
     break;
@@ -3615,7 +3643,7 @@ yyreduce:
   case 164:
 
 /* Line 1455 of yacc.c  */
-#line 765 "Grammar.y"
+#line 768 "Grammar.y"
     {
 ;}
     break;
@@ -3623,7 +3651,7 @@ yyreduce:
   case 165:
 
 /* Line 1455 of yacc.c  */
-#line 768 "Grammar.y"
+#line 771 "Grammar.y"
     {
 ;}
     break;
@@ -3631,7 +3659,7 @@ yyreduce:
   case 166:
 
 /* Line 1455 of yacc.c  */
-#line 771 "Grammar.y"
+#line 774 "Grammar.y"
     {
 ;}
     break;
@@ -3639,7 +3667,7 @@ yyreduce:
   case 167:
 
 /* Line 1455 of yacc.c  */
-#line 774 "Grammar.y"
+#line 777 "Grammar.y"
     {
 ;}
     break;
@@ -3647,7 +3675,7 @@ yyreduce:
   case 168:
 
 /* Line 1455 of yacc.c  */
-#line 777 "Grammar.y"
+#line 780 "Grammar.y"
     {
 ;}
     break;
@@ -3655,7 +3683,7 @@ yyreduce:
   case 169:
 
 /* Line 1455 of yacc.c  */
-#line 780 "Grammar.y"
+#line 783 "Grammar.y"
     {
 ;}
     break;
@@ -3663,7 +3691,7 @@ yyreduce:
   case 170:
 
 /* Line 1455 of yacc.c  */
-#line 783 "Grammar.y"
+#line 786 "Grammar.y"
     {
 ;}
     break;
@@ -3671,7 +3699,7 @@ yyreduce:
   case 171:
 
 /* Line 1455 of yacc.c  */
-#line 786 "Grammar.y"
+#line 789 "Grammar.y"
     {
 ;}
     break;
@@ -3679,7 +3707,31 @@ yyreduce:
   case 172:
 
 /* Line 1455 of yacc.c  */
-#line 789 "Grammar.y"
+#line 792 "Grammar.y"
+    {
+;}
+    break;
+
+  case 173:
+
+/* Line 1455 of yacc.c  */
+#line 795 "Grammar.y"
+    {
+;}
+    break;
+
+  case 174:
+
+/* Line 1455 of yacc.c  */
+#line 798 "Grammar.y"
+    {
+;}
+    break;
+
+  case 175:
+
+/* Line 1455 of yacc.c  */
+#line 801 "Grammar.y"
     {
 ;}
     break;
@@ -3687,7 +3739,7 @@ yyreduce:
 
 
 /* Line 1455 of yacc.c  */
-#line 3691 "Grammar.tab.c"
+#line 3743 "Grammar.tab.c"
       default: break;
     }
   YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
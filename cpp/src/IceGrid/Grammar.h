@@ -78,7 +78,8 @@
      ICE_GRID_TEMPLATE = 294,
      ICE_GRID_SERVICE = 295,
      ICE_GRID_ENABLE = 296,
-     ICE_GRID_DISABLE = 297
+     ICE_GRID_DISABLE = 297,
+     ICE_GRID_METRICS = 298
    };
 #endif
 
@@ -86,6 +86,7 @@ yyerror(const char* s)
 %token ICE_GRID_SERVICE
 %token ICE_GRID_ENABLE
 %token ICE_GRID_DISABLE
+%token ICE_GRID_METRICS
 
 %%
 
@@ -401,6 +402,14 @@ command
 {
     parser->usage("server", "properties");
 }
+| ICE_GRID_SERVER ICE_GRID_METRICS strings ';'
+{
+    parser->metricsServer($3);
+}
+| ICE_GRID_SERVER ICE_GRID_METRICS ICE_GRID_HELP ';'
+{
+    parser->usage("server", "metrics");
+}
 | ICE_GRID_SERVER ICE_GRID_PROPERTY strings ';'
 {
     parser->propertiesServer($3, true);
@@ -782,6 +791,9 @@ keyword
 | ICE_GRID_DISABLE
 {
 }
+| ICE_GRID_METRICS
+{
+}
 | ICE_GRID_STDERR
 {
 }
@@ -17,6 +17,7 @@
 #include <IceGrid/DescriptorParser.h>
 #include <IceGrid/DescriptorHelper.h>
 #include <IceBox/IceBox.h>
+#include <Ice/MetricsAdminI.h>
 
 #ifdef HAVE_READLINE
 #   include <readline/readline.h>
@@ -146,6 +147,11 @@ const char* _commandsHelp[][3] = {
 { "server", "property",
 "server property ID NAME   Get the run-time property NAME of server ID.\n"
 },
+{ "server", "metrics",
+"server metrics ID [VIEW]  List the metrics views of server ID or show the\n"
+"                          metrics of view VIEW, with latency percentiles for\n"
+"                          dispatches and invocations.\n"
+},
 { "server", "state",
 "server state ID           Get the state of server ID.\n" 
 },
@@ -1667,6 +1673,62 @@ Parser::propertiesServer(const list<string>& args, bool single)
     }
 }
 
+void
+Parser::metricsServer(const list<string>& args)
+{
+    if(args.size() != 1 && args.size() != 2)
+    {
+        invalidCommand("server metrics", "requires one or two arguments");
+        return;
+    }
+
+    try
+    {
+        Ice::ObjectPrx serverAdmin = _admin->getServerAdmin(args.front());
+        IceMX::MetricsAdminPrx metricsAdmin = IceMX::MetricsAdminPrx::uncheckedCast(serverAdmin, "Metrics");
+
+        if(args.size() == 1)
+        {
+            Ice::StringSeq disabled;
+            Ice::StringSeq enabled = metricsAdmin->getMetricsViewNames(disabled);
+            for(Ice::StringSeq::const_iterator p = enabled.begin(); p != enabled.end(); ++p)
+            {
+                cout << *p << endl;
+            }
+            for(Ice::StringSeq::const_iterator p = disabled.begin(); p != disabled.end(); ++p)
+            {
+                cout << *p << " (disabled)" << endl;
+            }
+        }
+        else
+        {
+            Ice::Long timestamp;
+            IceMX::MetricsView view = metricsAdmin->getMetricsView(*(++args.begin()), timestamp);
+            for(IceMX::MetricsView::const_iterator p = view.begin(); p != view.end(); ++p)
+            {
+                cout << p->first << ":" << endl;
+                printMetrics(p->second, "  ");
+            }
+        }
+    }
+    catch(const IceMX::UnknownMetricsView&)
+    {
+        error("unknown metrics view `" + *(++args.begin()) + "'");
+    }
+    catch(const Ice::ObjectNotExistException&)
+    {
+        error("couldn't reach the server's Admin object");
+    }
+    catch(const Ice::FacetNotExistException&)
+    {
+        error("the server's Admin object does not provide a 'Metrics' facet");
+    }
+    catch(const Ice::Exception& ex)
+    {
+        exception(ex);
+    }
+}
+
 void
 Parser::enableServer(const list<string>& args, bool enable)
 {
@@ -2416,6 +2478,57 @@ Parser::showFile(const string& id, const string& reader, const string& filename,
     }
 }
 
+void
+Parser::printMetrics(const IceMX::MetricsMap& metrics, const string& indent)
+{
+    for(IceMX::MetricsMap::const_iterator p = metrics.begin(); p != metrics.end(); ++p)
+    {
+        const IceMX::MetricsPtr& m = *p;
+        ostringstream os;
+        os << fixed << setprecision(3);
+        os << indent << m->id << ": total = " << m->total << ", current = " << m->current;
+        if(m->total > m->current)
+        {
+            os << ", average = " << static_cast<double>(m->totalLifetime) / (m->total - m->current) / 1000.0 << "ms";
+        }
+        if(m->failures > 0)
+        {
+            os << ", failures = " << m->failures;
+        }
+
+        IceMX::InvocationMetricsPtr invocation = IceMX::InvocationMetricsPtr::dynamicCast(m);
+        IceMX::DispatchMetricsPtr dispatch = IceMX::DispatchMetricsPtr::dynamicCast(m);
+        IceMX::ChildInvocationMetricsPtr child = IceMX::ChildInvocationMetricsPtr::dynamicCast(m);
+        IceMX::LatencyHistogram histogram;
+        if(invocation)
+        {
+            histogram = invocation->latency ? *invocation->latency : IceMX::LatencyHistogram();
+        }
+        else if(dispatch)
+        {
+            histogram = dispatch->latency ? *dispatch->latency : IceMX::LatencyHistogram();
+        }
+        else if(child)
+        {
+            histogram = child->latency ? *child->latency : IceMX::LatencyHistogram();
+        }
+        if(!histogram.empty())
+        {
+            os << ", p50 <= " << IceMX::getLatencyPercentile(histogram, 50) / 1000.0 << "ms";
+            os << ", p90 <= " << IceMX::getLatencyPercentile(histogram, 90) / 1000.0 << "ms";
+            os << ", p99 <= " << IceMX::getLatencyPercentile(histogram, 99) / 1000.0 << "ms";
+            os << ", p99.9 <= " << IceMX::getLatencyPercentile(histogram, 99.9) / 1000.0 << "ms";
+        }
+        cout << os.str() << endl;
+
+        if(invocation)
+        {
+            printMetrics(invocation->remotes, indent + "  ");
+            printMetrics(invocation->collocated, indent + "  ");
+        }
+    }
+}
+
 void
 Parser::showLog(const string& id, const string& reader, bool tail, bool follow, int lineCount)
 {
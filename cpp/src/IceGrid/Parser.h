@@ -102,6 +102,7 @@ public:
     void enableServer(const std::list<std::string>&, bool);
     void pidServer(const std::list<std::string>&);
     void propertiesServer(const std::list<std::string>&, bool);
+    void metricsServer(const std::list<std::string>&);
     void listAllServers(const std::list<std::string>&);
 
     void startService(const std::list<std::string>&);
@@ -159,6 +160,7 @@ private:
 
     void showFile(const std::string&, const std::string&, const std::string&, bool, bool, bool, int);
     void showLog(const std::string&, const std::string&, bool, bool, int);
+    void printMetrics(const IceMX::MetricsMap&, const std::string&);
     
 
     std::string _commands;
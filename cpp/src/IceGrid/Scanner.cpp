@@ -1957,6 +1957,7 @@ initScanner()
     keywordMap["shutdown"] = ICE_GRID_SHUTDOWN;
     keywordMap["describe"] = ICE_GRID_DESCRIBE;
     keywordMap["properties"] = ICE_GRID_PROPERTIES;
+    keywordMap["metrics"] = ICE_GRID_METRICS;
     keywordMap["property"] = ICE_GRID_PROPERTY;
     keywordMap["state"] = ICE_GRID_STATE;
     keywordMap["pid"] = ICE_GRID_PID;
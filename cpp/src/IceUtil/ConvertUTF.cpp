@@ -50,6 +50,7 @@
 
 #include <IceUtil/ConvertUTF.h>
 #include <IceUtil/StringConverter.h>
+#include <algorithm>
 
 #ifdef CVTUTF_DEBUG
 #include <stdio.h>
@@ -117,6 +118,60 @@ const UTF8 firstByteMark[7] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC };
 
 /* --------------------------------------------------------------------- */
 
+/*
+ * ASCII fast path. Most strings are entirely or mostly ASCII, and a run
+ * of ASCII characters converts one code unit to one code unit in every
+ * direction. copyASCII copies the run starting at source, stopping at the
+ * first non-ASCII character or at the end of the source or target buffer.
+ * Blocks of 8 code units are checked with a single test and copied with
+ * a branch-free inner loop, which compilers unroll and vectorize.
+ */
+const int asciiBlock = 8;
+
+template<typename S, typename T> inline void
+copyASCII(const S*& source, const S* sourceEnd, T*& target, const T* targetEnd) {
+    const S* end = source + std::min(sourceEnd - source, targetEnd - target);
+    while (end - source >= asciiBlock) {
+        UTF32 bits = 0;
+        for (int k = 0; k < asciiBlock; ++k) {
+            bits |= source[k];
+        }
+        if (bits >= 0x80) {
+            break;
+        }
+        for (int k = 0; k < asciiBlock; ++k) {
+            target[k] = (T)source[k];
+        }
+        source += asciiBlock;
+        target += asciiBlock;
+    }
+    while (source < end && *source < 0x80) {
+        *target++ = (T)*source++;
+    }
+}
+
+/*
+ * Same as above, for validation only.
+ */
+inline void
+skipASCII(const UTF8*& source, const UTF8* sourceEnd) {
+    while (sourceEnd - source >= asciiBlock) {
+        UTF32 bits = 0;
+        for (int k = 0; k < asciiBlock; ++k) {
+            bits |= source[k];
+        }
+        if (bits >= 0x80) {
+            break;
+        }
+        source += asciiBlock;
+    }
+    while (source < sourceEnd && *source < 0x80) {
+        ++source;
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
 /* The interface converts a whole buffer to avoid function-call overhead.
  * Constants have been gathered. Loops & conditionals have been removed as
  * much as possible for efficiency, in favor of drop-through switches.
@@ -134,6 +189,14 @@ ConversionResult ConvertUTF16toUTF8 (
     const UTF16* source = *sourceStart;
     UTF8* target = *targetStart;
     while (source < sourceEnd) {
+        if (*source < 0x80) {
+            copyASCII(source, sourceEnd, target, targetEnd);
+            if (source < sourceEnd && *source < 0x80) {
+                result = targetExhausted; /* The target is full */
+                break;
+            }
+            continue;
+        }
         UTF32 ch;
         unsigned short bytesToWrite = 0;
         const UTF32 byteMask = 0xBF;
@@ -242,6 +305,14 @@ ConversionResult ConvertUTF8toUTF16 (
     const UTF8* source = *sourceStart;
     UTF16* target = *targetStart;
     while (source < sourceEnd) {
+        if (*source < 0x80) {
+            copyASCII(source, sourceEnd, target, targetEnd);
+            if (source < sourceEnd && *source < 0x80) {
+                result = targetExhausted; /* The target is full */
+                break;
+            }
+            continue;
+        }
         UTF32 ch = 0;
         unsigned short extraBytesToRead = trailingBytesForUTF8[*source];
         if (source + extraBytesToRead >= sourceEnd) {
@@ -315,6 +386,14 @@ ConversionResult ConvertUTF32toUTF8 (
     const UTF32* source = *sourceStart;
     UTF8* target = *targetStart;
     while (source < sourceEnd) {
+        if (*source < 0x80) {
+            copyASCII(source, sourceEnd, target, targetEnd);
+            if (source < sourceEnd && *source < 0x80) {
+                result = targetExhausted; /* The target is full */
+                break;
+            }
+            continue;
+        }
         UTF32 ch;
         unsigned short bytesToWrite = 0;
         const UTF32 byteMask = 0xBF;
@@ -368,6 +447,14 @@ ConversionResult ConvertUTF8toUTF32 (
     const UTF8* source = *sourceStart;
     UTF32* target = *targetStart;
     while (source < sourceEnd) {
+        if (*source < 0x80) {
+            copyASCII(source, sourceEnd, target, targetEnd);
+            if (source < sourceEnd && *source < 0x80) {
+                result = targetExhausted; /* The target is full */
+                break;
+            }
+            continue;
+        }
         UTF32 ch = 0;
         unsigned short extraBytesToRead = trailingBytesForUTF8[*source];
         if (source + extraBytesToRead >= sourceEnd) {
@@ -457,6 +544,10 @@ Boolean isLegalUTF8Sequence(const UTF8 *source, const UTF8 *sourceEnd) {
         return true;
     }
     while(true) {
+        skipASCII(source, sourceEnd);
+        if(source == sourceEnd) {
+            return true;
+        }
         int length = trailingBytesForUTF8[*source]+1;
         // Is buffer big enough to contain character?
         if (source+length > sourceEnd) {
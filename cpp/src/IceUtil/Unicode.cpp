@@ -108,23 +108,29 @@ IceUtilInternal::convertUTF8ToUTFWstring(const Byte*& sourceStart, const Byte* s
                                  std::wstring& target, ConversionFlags flags)
 {
     //
-    // Could be reimplemented without this temporary wchar_t buffer
+    // The UTF-8 source never converts to more wide characters than it has
+    // bytes, so we convert directly into a string of that size, which is
+    // then shrunk to the converted length.
     //
     size_t size = static_cast<size_t>(sourceEnd - sourceStart);
-    wchar_t* outBuf = new wchar_t[size];
-    wchar_t* targetStart = outBuf; 
+    if(size == 0)
+    {
+        target.clear();
+        return conversionOK;
+    }
+    std::wstring s(size, L'\0');
+    wchar_t* targetStart = &s[0];
     wchar_t* targetEnd = targetStart + size;
 
-    ConversionResult result =  
+    ConversionResult result =
         convertUTF8ToUTFWstring(sourceStart, sourceEnd, targetStart,
                                 targetEnd, flags);
 
     if(result == conversionOK)
     {
-        std::wstring s(outBuf, static_cast<size_t>(targetStart - outBuf));
+        s.resize(static_cast<size_t>(targetStart - s.data()));
         s.swap(target);
     }
-    delete[] outBuf;
     return result;
 }
 
@@ -55,6 +55,7 @@ SUBDIRS		= IceUtil \
 		  Glacier2 \
 		  IceStorm \
 		  IceGrid \
+		  iceflightdecode \
 		  iceserviceinstall
 !endif
 
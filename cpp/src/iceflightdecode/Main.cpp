@@ -0,0 +1,273 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <IceUtil/Options.h>
+#include <IceUtil/FileUtil.h>
+#include <IceUtil/Time.h>
+#include <Ice/Initialize.h>
+#include <Ice/FlightRecorderI.h>
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+
+typedef unsigned long long UInt64;
+
+//
+// The connection states, see ConnectionI::State.
+//
+const char* connectionStates[] =
+{
+    "NotInitialized",
+    "NotValidated",
+    "Active",
+    "Holding",
+    "Closing",
+    "ClosingPending",
+    "Closed",
+    "Finished"
+};
+
+//
+// The protocol message types, see Ice/Protocol.h.
+//
+const char* messageTypes[] =
+{
+    "request",
+    "batch request",
+    "reply",
+    "validate connection",
+    "close connection"
+};
+
+Long
+readLittleEndian(const vector<Byte>& bytes, size_t pos, int size)
+{
+    UInt64 v = 0;
+    for(int i = size - 1; i >= 0; --i)
+    {
+        v = (v << 8) | bytes[pos + i];
+    }
+    if(size < 8 && (v & (UInt64(1) << (size * 8 - 1))))
+    {
+        v |= ~UInt64(0) << (size * 8); // Sign extension.
+    }
+    return static_cast<Long>(v);
+}
+
+string
+connectionState(Int state)
+{
+    if(state >= 0 && state < static_cast<Int>(sizeof(connectionStates) / sizeof(connectionStates[0])))
+    {
+        return connectionStates[state];
+    }
+    ostringstream os;
+    os << "unknown state " << state;
+    return os.str();
+}
+
+string
+messageType(Int type)
+{
+    if(type >= 0 && type < static_cast<Int>(sizeof(messageTypes) / sizeof(messageTypes[0])))
+    {
+        return messageTypes[type];
+    }
+    ostringstream os;
+    os << "unknown message " << type;
+    return os.str();
+}
+
+void
+printEvent(ostream& out, Long time, Long source, Int thread, Short type, Int a, Int b)
+{
+    out << IceUtil::Time::microSeconds(time).toDateTime() << " thread=" << hex << setw(8) << setfill('0')
+        << static_cast<unsigned int>(thread) << ' ';
+    if(type == FlightFollowerPromoted || type == FlightSelectorWakeup)
+    {
+        out << "thread pool ";
+    }
+    else
+    {
+        out << "connection ";
+    }
+    out << "0x" << static_cast<UInt64>(source) << dec << setfill(' ') << ' ';
+
+    switch(type)
+    {
+        case FlightConnectionState:
+        {
+            out << "state " << connectionState(a) << " -> " << connectionState(b);
+            break;
+        }
+        case FlightMessageSent:
+        {
+            out << "sent " << messageType(a) << " (" << b << " bytes)";
+            break;
+        }
+        case FlightMessageReceived:
+        {
+            out << "received " << messageType(a) << " (" << b << " bytes)";
+            break;
+        }
+        case FlightDispatchStart:
+        {
+            out << "dispatch started (request id " << a << ")";
+            break;
+        }
+        case FlightDispatchEnd:
+        {
+            out << "dispatch completed (request id " << a << ")";
+            break;
+        }
+        case FlightFollowerPromoted:
+        {
+            out << "follower promoted (" << a << " threads in use, " << b << " for IO)";
+            break;
+        }
+        case FlightSelectorWakeup:
+        {
+            out << "selector woke up (" << a << " ready handlers)";
+            break;
+        }
+        case FlightAcmHeartbeat:
+        {
+            out << "ACM heartbeat";
+            break;
+        }
+        case FlightAcmClose:
+        {
+            out << "ACM closed the connection (" << (a ? "forcefully" : "idle") << ")";
+            break;
+        }
+        default:
+        {
+            out << "unknown event " << type << " (" << a << ", " << b << ")";
+            break;
+        }
+    }
+    out << '\n';
+}
+
+void
+usage(const string& appName)
+{
+    cerr << "Usage: " << appName << " [options] FILE\n";
+    cerr <<
+        "Options:\n"
+        "-h, --help           Show this message.\n"
+        "-v, --version        Display the Ice version.\n"
+        "\n"
+        "Decodes the events of a flight recorder dump, saved on interrupt\n"
+        "with Ice.FlightRecorder.File or retrieved with the FlightRecorder\n"
+        "admin facet.\n"
+        ;
+}
+
+}
+
+#ifdef _WIN32
+int
+wmain(int argc, wchar_t* argv[])
+#else
+int
+main(int argc, char* argv[])
+#endif
+{
+    Ice::StringSeq originalArgs = Ice::argsToStringSeq(argc, argv);
+    assert(originalArgs.size() > 0);
+
+    const string appName = originalArgs[0];
+
+    IceUtilInternal::Options opts;
+    opts.addOpt("h", "help");
+    opts.addOpt("v", "version");
+
+    vector<string> args;
+    try
+    {
+        args = opts.parse(originalArgs);
+    }
+    catch(const IceUtilInternal::BadOptException& e)
+    {
+        cerr << e.reason << endl;
+        usage(appName);
+        return EXIT_FAILURE;
+    }
+
+    if(opts.isSet("help"))
+    {
+        usage(appName);
+        return EXIT_SUCCESS;
+    }
+    if(opts.isSet("version"))
+    {
+        cout << ICE_STRING_VERSION << endl;
+        return EXIT_SUCCESS;
+    }
+
+    if(args.size() != 1)
+    {
+        usage(appName);
+        return EXIT_FAILURE;
+    }
+
+    IceUtilInternal::ifstream in(args[0], ios::binary);
+    if(!in)
+    {
+        cerr << appName << ": cannot open `" << args[0] << "'" << endl;
+        return EXIT_FAILURE;
+    }
+    vector<Byte> bytes;
+    char buf[4096];
+    while(in.read(buf, sizeof(buf)) || in.gcount() > 0)
+    {
+        bytes.insert(bytes.end(), buf, buf + in.gcount());
+    }
+
+    if(bytes.size() < static_cast<size_t>(flightRecorderHeaderSize) ||
+       !equal(flightRecorderMagic, flightRecorderMagic + sizeof(flightRecorderMagic), bytes.begin()))
+    {
+        cerr << appName << ": `" << args[0] << "' is not a flight recorder dump" << endl;
+        return EXIT_FAILURE;
+    }
+    if(bytes[3] != flightRecorderVersion)
+    {
+        cerr << appName << ": unsupported flight recorder dump version " << static_cast<int>(bytes[3]) << endl;
+        return EXIT_FAILURE;
+    }
+
+    size_t count = static_cast<size_t>(readLittleEndian(bytes, 4, 4));
+    if(bytes.size() < flightRecorderHeaderSize + count * flightEventSize)
+    {
+        cerr << appName << ": `" << args[0] << "' is truncated" << endl;
+        count = (bytes.size() - flightRecorderHeaderSize) / flightEventSize;
+    }
+
+    for(size_t i = 0; i < count; ++i)
+    {
+        size_t pos = flightRecorderHeaderSize + i * flightEventSize;
+        printEvent(cout,
+                   readLittleEndian(bytes, pos, 8),
+                   readLittleEndian(bytes, pos + 8, 8),
+                   static_cast<Int>(readLittleEndian(bytes, pos + 16, 4)),
+                   static_cast<Short>(readLittleEndian(bytes, pos + 20, 2)),
+                   static_cast<Int>(readLittleEndian(bytes, pos + 24, 4)),
+                   static_cast<Int>(readLittleEndian(bytes, pos + 28, 4)));
+    }
+    return EXIT_SUCCESS;
+}
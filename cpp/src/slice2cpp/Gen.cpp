@@ -46,6 +46,52 @@ getDeprecateSymbol(const ContainedPtr& p1, const ContainedPtr& p2)
     return deprecateSymbol;
 }
 
+//
+// Can the struct be marshaled with a copy of its memory (cpp:packed)?
+// The members must be fixed-size primitives, each at an offset that is
+// a multiple of its size. No compiler aligns primitive types on more
+// than their size, so there is no padding between the members of such
+// a struct and its memory holds its encoding on little-endian hosts.
+// bool members are not allowed, their encoding accepts any non-zero
+// value.
+//
+bool
+isPackedStruct(const StructPtr& p, string& reason)
+{
+    if(p->isLocal())
+    {
+        reason = "struct is local";
+        return false;
+    }
+
+    if(findMetaData(p->getMetaData(), false) == "%class")
+    {
+        reason = "struct uses the `cpp:class' metadata";
+        return false;
+    }
+
+    size_t offset = 0;
+    DataMemberList dataMembers = p->dataMembers();
+    for(DataMemberList::const_iterator q = dataMembers.begin(); q != dataMembers.end(); ++q)
+    {
+        BuiltinPtr builtin = BuiltinPtr::dynamicCast((*q)->type());
+        if(!builtin || builtin->isVariableLength() || builtin->kind() == Builtin::KindBool)
+        {
+            reason = "data member `" + (*q)->name() + "' is not a fixed-size numeric type";
+            return false;
+        }
+
+        size_t size = builtin->minWireSize();
+        if(offset % size != 0)
+        {
+            reason = "data member `" + (*q)->name() + "' is not aligned on its size";
+            return false;
+        }
+        offset += size;
+    }
+    return true;
+}
+
 void
 writeConstantValue(IceUtilInternal::Output& out, const TypePtr& type, const SyntaxTreeBasePtr& valueType,
                    const string& value, int useWstring, const StringList& metaData)
@@ -191,6 +237,79 @@ writeDataMemberInitializers(IceUtilInternal::Output& C, const DataMemberList& me
     }
 }
 
+//
+// Writes the body of a function that returns the position of the
+// operation "op" in the sorted list of operation names, or -1 if it's
+// not in the list. The names are first switched on their length and
+// on the character that best tells apart the names of that length, so
+// an operation is found with a single string comparison in most cases.
+//
+void
+writeOperationIndex(IceUtilInternal::Output& C, const StringList& opNames)
+{
+    typedef vector<pair<string, int> > NameList;
+
+    map<string::size_type, NameList> byLength;
+    int index = 0;
+    for(StringList::const_iterator p = opNames.begin(); p != opNames.end(); ++p)
+    {
+        byLength[p->size()].push_back(make_pair(*p, index++));
+    }
+
+    C << nl << "switch(op.size())";
+    C << sb;
+    for(map<string::size_type, NameList>::const_iterator p = byLength.begin(); p != byLength.end(); ++p)
+    {
+        const NameList& names = p->second;
+
+        string::size_type pos = 0;
+        set<char> best;
+        for(string::size_type i = 0; i < p->first && best.size() < names.size(); ++i)
+        {
+            set<char> chars;
+            for(NameList::const_iterator q = names.begin(); q != names.end(); ++q)
+            {
+                chars.insert(q->first[i]);
+            }
+            if(chars.size() > best.size())
+            {
+                best.swap(chars);
+                pos = i;
+            }
+        }
+
+        map<char, NameList> byChar;
+        for(NameList::const_iterator q = names.begin(); q != names.end(); ++q)
+        {
+            byChar[q->first[pos]].push_back(*q);
+        }
+
+        C << nl << "case " << p->first << ':';
+        C << sb;
+        C << nl << "switch(op[" << pos << "])";
+        C << sb;
+        for(map<char, NameList>::const_iterator q = byChar.begin(); q != byChar.end(); ++q)
+        {
+            C << nl << "case '" << q->first << "':";
+            C << sb;
+            for(NameList::const_iterator r = q->second.begin(); r != q->second.end(); ++r)
+            {
+                C << nl << "if(op == \"" << r->first << "\")";
+                C << sb;
+                C << nl << "return " << r->second << ';';
+                C << eb;
+            }
+            C << nl << "break;";
+            C << eb;
+        }
+        C << eb;
+        C << nl << "break;";
+        C << eb;
+    }
+    C << eb;
+    C << nl << "return -1;";
+}
+
 }
 
 Slice::Gen::Gen(const string& base, const string& headerExtension, const string& sourceExtension,
@@ -403,6 +522,16 @@ Slice::Gen::generate(const UnitPtr& p)
         H << "\n#include <Ice/FactoryTableInit.h>";
     }
 
+    if(p->hasContentsWithMetaData("cpp:arena"))
+    {
+        H << "\n#include <Ice/Arena.h>";
+    }
+
+    if(p->hasContentsWithMetaData("cpp:coroutine"))
+    {
+        H << "\n#include <Ice/Coroutine.h>";
+    }
+
     H << "\n#include <IceUtil/ScopedArray.h>";
     H << "\n#include <IceUtil/Optional.h>";
 
@@ -2043,6 +2172,37 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
         H << "const ::Ice::AsyncResultPtr&" << epar << ';';
     }
 
+    if(cl->hasMetaData("cpp:coroutine") || p->hasMetaData("cpp:coroutine"))
+    {
+        //
+        // The co_ methods start the invocation and return an object
+        // that a coroutine can co_await to get the AsyncResult to pass
+        // to end_.
+        //
+        H.zeroIndent();
+        H << nl << "#ifdef ICE_CPP_COROUTINES";
+        H.restoreIndent();
+
+        H << sp << nl << "::Ice::AsyncAwaiter co_" << name << spar << paramsDeclAMI << epar;
+        H << sb;
+        H << nl << "::Ice::AsyncAwaiter __awaiter;";
+        H << nl << "begin_" << name << spar << argsAMI << "0" << "__awaiter.callback()" << epar << ';';
+        H << nl << "return __awaiter;";
+        H << eb;
+
+        H << sp << nl << "::Ice::AsyncAwaiter co_" << name << spar << paramsDeclAMI
+          << "const ::Ice::Context& __ctx" << epar;
+        H << sb;
+        H << nl << "::Ice::AsyncAwaiter __awaiter;";
+        H << nl << "begin_" << name << spar << argsAMI << "&__ctx" << "__awaiter.callback()" << epar << ';';
+        H << nl << "return __awaiter;";
+        H << eb;
+
+        H.zeroIndent();
+        H << nl << "#endif";
+        H.restoreIndent();
+    }
+
     H << nl;
     H.dec();
     H << nl << "private:";
@@ -2706,6 +2866,23 @@ Slice::Gen::ObjectVisitor::visitClassDefStart(const ClassDefPtr& p)
          */
 
         emitOneShotConstructor(p);
+
+        if(p->hasMetaData("cpp:arena"))
+        {
+            //
+            // Allocate the instances from the per-thread arena (and
+            // the instances of derived classes, unless they provide
+            // their own allocation functions).
+            //
+            H << sp << nl << "static void* operator new(::std::size_t __sz)";
+            H << sb;
+            H << nl << "return ::IceInternal::arenaAllocate(__sz);";
+            H << eb;
+            H << sp << nl << "static void operator delete(void* __p)";
+            H << sb;
+            H << nl << "::IceInternal::arenaFree(__p);";
+            H << eb;
+        }
         H << sp;
 
         /*
@@ -2964,37 +3141,21 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             H << nl
               << "virtual ::Ice::DispatchStatus __dispatch(::IceInternal::Incoming&, const ::Ice::Current&);";
 
-            string flatName = p->flattenedScope() + p->name() + "_all";
+            string indexName = p->flattenedScope() + p->name() + "_index";
             C << sp << nl << "namespace";
             C << nl << "{";
-            C << nl << "const ::std::string " << flatName << "[] =";
+            C << sp << nl << "int";
+            C << nl << indexName << "(const ::std::string& op)";
             C << sb;
-
-            for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end();)
-            {
-                C << nl << '"' << *q << '"';
-                if(++q != allOpNames.end())
-                {
-                    C << ',';
-                }
-            }
-            C << eb << ';';
+            writeOperationIndex(C, allOpNames);
+            C << eb;
             C << sp << nl << "}";
             C << sp;
             C << nl << "::Ice::DispatchStatus" << nl << scoped.substr(2)
               << "::__dispatch(::IceInternal::Incoming& in, const ::Ice::Current& current)";
             C << sb;
 
-            C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
-              << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-              << ", current.operation);";
-            C << nl << "if(r.first == r.second)";
-            C << sb;
-            C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
-              << "current.facet, current.operation);";
-            C << eb;
-            C << sp;
-            C << nl << "switch(r.first - " << flatName << ')';
+            C << nl << "switch(" << indexName << "(current.operation))";
             C << sb;
             int i = 0;
             for(StringList::const_iterator q = allOpNames.begin(); q != allOpNames.end(); ++q)
@@ -3006,7 +3167,6 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
             }
             C << eb;
             C << sp;
-            C << nl << "assert(false);";
             C << nl << "throw ::Ice::OperationNotExistException(__FILE__, __LINE__, current.id, "
               << "current.facet, current.operation);";
             C << eb;
@@ -3064,15 +3224,13 @@ Slice::Gen::ObjectVisitor::visitClassDefEnd(const ClassDefPtr& p)
                   << "::ice_operationAttributes(const ::std::string& opName) const";
                 C << sb;
 
-                C << nl << "::std::pair< const ::std::string*, const ::std::string*> r = "
-                  << "::std::equal_range(" << flatName << ", " << flatName << " + " << allOpNames.size()
-                  << ", opName);";
-                C << nl << "if(r.first == r.second)";
+                C << nl << "int i = " << indexName << "(opName);";
+                C << nl << "if(i < 0)";
                 C << sb;
                 C << nl << "return -1;";
                 C << eb;
 
-                C << nl << "return " << opAttrFlatName << "[r.first - " << flatName << "];";
+                C << nl << "return " << opAttrFlatName << "[i];";
                 C << eb;
             }
         }
@@ -5144,6 +5302,16 @@ Slice::Gen::StreamVisitor::visitStructStart(const StructPtr& p)
         }
         H << eb << ";" << nl;
 
+        string reason;
+        if(p->hasMetaData("cpp:packed") && isPackedStruct(p, reason))
+        {
+            H << nl << "template<>";
+            H << nl << "struct StreamPackedTraits< " << fullStructName << ">";
+            H << sb;
+            H << nl << "static const bool packed = true;";
+            H << eb << ";" << nl;
+        }
+
         DataMemberList dataMembers = p->dataMembers();
 
         string holder = classMetaData ? "v->" : "v.";
@@ -5352,8 +5520,14 @@ Slice::Gen::MetaDataVisitor::visitOperation(const OperationPtr& p)
         }
     }
 
+    if(p->hasMetaData("cpp:coroutine") && cl->isLocal())
+    {
+        emitWarning(p->file(), p->line(), "ignoring invalid metadata `cpp:coroutine' for local operation");
+    }
+
     StringList metaData = p->getMetaData();
     metaData.remove("cpp:const");
+    metaData.remove("cpp:coroutine");
 
     TypePtr returnType = p->returnType();
     if(!metaData.empty())
@@ -5461,10 +5635,28 @@ Slice::Gen::MetaDataVisitor::validate(const SyntaxTreeBasePtr& cont, const Strin
                 {
                     continue;
                 }
+                if(StructPtr::dynamicCast(cont) && ss == "packed")
+                {
+                    string reason;
+                    if(isPackedStruct(StructPtr::dynamicCast(cont), reason))
+                    {
+                        continue;
+                    }
+                    emitWarning(file, line, "ignoring invalid metadata `" + s + "': " + reason);
+                    continue;
+                }
                 if(ClassDefPtr::dynamicCast(cont) && ss == "virtual")
                 {
                     continue;
                 }
+                if(ClassDefPtr::dynamicCast(cont) && !ClassDefPtr::dynamicCast(cont)->isInterface() && ss == "arena")
+                {
+                    continue;
+                }
+                if(ClassDefPtr::dynamicCast(cont) && !ClassDefPtr::dynamicCast(cont)->isLocal() && ss == "coroutine")
+                {
+                    continue;
+                }
                 if(ExceptionPtr::dynamicCast(cont) && ss == "ice_print")
                 {
                     continue;
@@ -27,6 +27,7 @@ SUBDIRS		= proxy \
 		  hold \
 		  binding \
 		  retry \
+		  hedging \
 		  timeout \
 		  acm \
 		  udp \
@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <Ice/FlightRecorder.h>
 #include <TestCommon.h>
 #include <TestI.h> // For TestFacetI
 
@@ -535,6 +536,60 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing flight recorder facet... " << flush;
+    {
+        //
+        // Test: The facet is only present if the flight recorder is enabled.
+        //
+        Ice::PropertyDict props;
+        props["Ice.Admin.Endpoints"] = "tcp -h " + defaultHost;
+        props["Ice.Admin.InstanceName"] = "Test";
+        RemoteCommunicatorPrx com = factory->createCommunicator(props);
+        test(!Ice::FlightRecorderPrx::checkedCast(com->getAdmin(), "FlightRecorder"));
+        com->destroy();
+
+        props["Ice.FlightRecorder.Size"] = "256";
+        com = factory->createCommunicator(props);
+        Ice::FlightRecorderPrx fr = Ice::FlightRecorderPrx::checkedCast(com->getAdmin(), "FlightRecorder");
+        test(fr);
+        Test::TestFacetPrx::checkedCast(fr, "TestFacet")->op();
+
+        //
+        // Test: The dump contains the events of the admin connection.
+        //
+        Ice::ByteSeq dump = fr->dump();
+        test(dump.size() >= 8);
+        test(dump[0] == 'I' && dump[1] == 'F' && dump[2] == 'R' && dump[3] == 1);
+        Ice::Int count = dump[4] | (dump[5] << 8) | (dump[6] << 16) | (dump[7] << 24);
+        test(count > 0 && dump.size() == static_cast<size_t>(8 + count * 32));
+        bool activated = false;
+        int received = 0;
+        int dispatched = 0;
+        for(Ice::Int i = 0; i < count; ++i)
+        {
+            const Ice::Byte* event = &dump[8 + i * 32];
+            Ice::Short type = static_cast<Ice::Short>(event[20] | (event[21] << 8));
+            test(type >= 1 && type <= 9);
+            if(type == 1 && event[28] == 2) // Connection state change to StateActive.
+            {
+                activated = true;
+            }
+            else if(type == 3 && event[24] == 0) // Request received.
+            {
+                ++received;
+            }
+            else if(type == 4) // Dispatch started.
+            {
+                ++dispatched;
+            }
+        }
+        test(activated);
+        test(received >= 3); // ice_isA, op and dump.
+        test(dispatched == received);
+        com->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing facet filtering... " << flush;
     {
         //
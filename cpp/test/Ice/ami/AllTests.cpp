@@ -844,6 +844,98 @@ private:
 };
 typedef IceUtil::Handle<Thrower> ThrowerPtr;
 
+#ifdef ICE_CPP_COROUTINES
+
+//
+// Plays the role of the AMD callback of a dispatch implemented with a
+// coroutine.
+//
+class CoroutineCallback : public Ice::AMDCallback
+{
+public:
+
+    CoroutineCallback() :
+        _called(false),
+        _result(0),
+        _exception(false)
+    {
+    }
+
+    void ice_response(int result)
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_m);
+        _result = result;
+        _called = true;
+        _m.notify();
+    }
+
+    virtual void ice_exception(const std::exception& ex)
+    {
+        test(dynamic_cast<const Test::TestIntfException*>(&ex));
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_m);
+        _exception = true;
+        _called = true;
+        _m.notify();
+    }
+
+    virtual void ice_exception()
+    {
+        test(false);
+    }
+
+    void check()
+    {
+        IceUtil::Monitor<IceUtil::Mutex>::Lock sync(_m);
+        while(!_called)
+        {
+            _m.wait();
+        }
+    }
+
+    int result() const
+    {
+        return _result;
+    }
+
+    bool exception() const
+    {
+        return _exception;
+    }
+
+private:
+
+    IceUtil::Monitor<IceUtil::Mutex> _m;
+    bool _called;
+    int _result;
+    bool _exception;
+};
+typedef IceUtil::Handle<CoroutineCallback> CoroutineCallbackPtr;
+
+Ice::DispatchTask
+opWithResultCoroutine(CoroutineCallbackPtr cb, Test::TestIntfPrx p)
+{
+    Ice::AsyncAwaiter awaiter;
+    p->begin_opWithResult(awaiter.callback());
+    int result = p->end_opWithResult(co_await awaiter);
+
+    Ice::Context ctx;
+    ctx["foo"] = "bar";
+    result += p->end_opWithResult(co_await p->co_opWithResult(ctx));
+
+    p->end_op(co_await p->co_op());
+    cb->ice_response(result);
+}
+
+Ice::DispatchTask
+opWithUECoroutine(CoroutineCallbackPtr cb, Test::TestIntfPrx p)
+{
+    p->end_op(co_await p->co_op());
+    p->end_opWithUE(co_await p->co_opWithUE());
+    test(false);
+}
+
+#endif
+
 }
 
 void
@@ -2589,6 +2681,27 @@ allTests(const Ice::CommunicatorPtr& communicator, bool collocated)
         cout << "ok" << endl;
 #endif
     }
+#ifdef ICE_CPP_COROUTINES
+    cout << "testing coroutines... " << flush;
+    {
+        for(int i = 0; i < 10; ++i)
+        {
+            CoroutineCallbackPtr cb = new CoroutineCallback();
+            opWithResultCoroutine(cb, p);
+            cb->check();
+            test(cb->result() == 30);
+
+            cb = new CoroutineCallback();
+            opWithUECoroutine(cb, p);
+            cb->check();
+            test(cb->exception());
+        }
+    }
+    cout << "ok" << endl;
+#else
+    cout << "testing coroutines... skipped, requires a C++20 build (CPP20=yes)" << endl;
+#endif
+
     cout << "testing AsyncResult operations... " << flush;
     {
         {
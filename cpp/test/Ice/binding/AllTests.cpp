@@ -794,6 +794,67 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing latency-aware endpoint selection... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LatencyAwareEndpointSelection", "1");
+        Ice::CommunicatorPtr latencyCommunicator = Ice::initialize(initData);
+
+        vector<RemoteObjectAdapterPrx> adapters;
+        adapters.push_back(com->createObjectAdapter("Adapter71", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter72", "default"));
+        adapters.push_back(com->createObjectAdapter("Adapter73", "default"));
+
+        try
+        {
+            TestIntfPrx test = TestIntfPrx::uncheckedCast(
+                latencyCommunicator->stringToProxy(communicator->proxyToString(createTestIntfPrx(adapters))));
+            test = TestIntfPrx::uncheckedCast(test->ice_connectionCached(false));
+            test(test->ice_getEndpointSelection() == Ice::Random);
+
+            //
+            // Adapter71 is slow. The endpoints without measurements are
+            // preferred, so all the adapters are used until they are
+            // measured.
+            //
+            adapters[0]->getTestIntf()->setDelay(50);
+            set<string> names;
+            names.insert("Adapter71");
+            names.insert("Adapter72");
+            names.insert("Adapter73");
+            for(int i = 0; i < 100 && !names.empty(); ++i)
+            {
+                names.erase(test->getAdapterName());
+            }
+            test(names.empty());
+
+            //
+            // Once measured, Adapter71 is moved after the other endpoints
+            // and no longer used.
+            //
+            for(int i = 0; i < 50; ++i)
+            {
+                test(test->getAdapterName() != "Adapter71");
+            }
+
+            //
+            // The slow adapter is still used once the others go away.
+            //
+            com->deactivateObjectAdapter(adapters[1]);
+            com->deactivateObjectAdapter(adapters[2]);
+            test(test->getAdapterName() == "Adapter71");
+        }
+        catch(...)
+        {
+            latencyCommunicator->destroy();
+            throw;
+        }
+        latencyCommunicator->destroy();
+        com->deactivateObjectAdapter(adapters[0]);
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<RemoteObjectAdapterPrx> adapters;
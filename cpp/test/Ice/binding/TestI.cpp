@@ -77,9 +77,29 @@ RemoteObjectAdapterI::deactivate(const Ice::Current&)
     }
 }
 
+TestI::TestI() : _delay(0)
+{
+}
+
 std::string
 TestI::getAdapterName(const Ice::Current& current)
 {
+    Ice::Int delay;
+    {
+        IceUtil::Mutex::Lock sync(_mutex);
+        delay = _delay;
+    }
+    if(delay > 0)
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
+    }
     return current.adapter->getName();
 }
 
+void
+TestI::setDelay(Ice::Int delay, const Ice::Current&)
+{
+    IceUtil::Mutex::Lock sync(_mutex);
+    _delay = delay;
+}
+
@@ -47,7 +47,15 @@ class TestI : public Test::TestIntf
 {
 public:
 
+    TestI();
+
     virtual std::string getAdapterName(const Ice::Current&);
+    virtual void setDelay(Ice::Int, const Ice::Current&);
+
+private:
+
+    IceUtil::Mutex _mutex;
+    Ice::Int _delay;
 };
 
 #endif
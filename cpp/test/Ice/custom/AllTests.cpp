@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <Ice/BasicStream.h>
 #include <IceUtil/Iterator.h>
 #include <TestCommon.h>
 #include <Test.h>
@@ -124,6 +125,18 @@ public:
         called();
     }
 
+    void opStringViewSeq(const Ice::StringViewSeq& ret, const Ice::StringViewSeq& out, const InParamPtr& cookie)
+    {
+        const Test::StringSeq& in = getIn<Test::StringSeq>(cookie);
+        test(ret.size() == in.size() && out.size() == in.size());
+        for(size_t i = 0; i < in.size(); ++i)
+        {
+            test(ret[i] == "key:" + in[i]);
+            test(out[i] == in[i]);
+        }
+        called();
+    }
+
     void opDoubleArray(const ::std::pair<const double*, const double*>& ret,
                        const ::std::pair<const double*, const double*>& out,
                        const InParamPtr& cookie)
@@ -3257,6 +3270,129 @@ allTests(const Ice::CommunicatorPtr& communicator)
     cout << "ok" << endl;
 #endif
 
+    cout << "testing packed structs... " << flush;
+    {
+        Test::Tick tick;
+        tick.ts = ICE_INT64(1420070400000);
+        tick.px = 101.25;
+        tick.qty = 300;
+
+        Test::TickSeq ticks;
+        Test::PointSeq points;
+        for(int i = 0; i < 100; ++i)
+        {
+            Test::Tick tk;
+            tk.ts = tick.ts + i;
+            tk.px = tick.px + i / 4.0;
+            tk.qty = i * 10;
+            ticks.push_back(tk);
+
+            Test::Point pt;
+            pt.x = static_cast<Ice::Short>(i);
+            pt.y = static_cast<Ice::Short>(-i);
+            pt.z = i * 1000;
+            points.push_back(pt);
+        }
+
+        Test::TickSeq outTicks;
+        Test::PointSeq outPoints;
+        Test::Tick ret = t->opPackedStruct(tick, ticks, points, outTicks, outPoints);
+        test(ret == tick);
+        test(outTicks == ticks);
+        test(outPoints == points);
+
+        //
+        // The public streaming API marshals the members one by one, the
+        // encoding must be the same.
+        //
+        Ice::OutputStreamPtr out = Ice::createOutputStream(communicator);
+        out->write(tick);
+        out->write(ticks);
+        out->write(points);
+        Ice::ByteSeq expected;
+        out->finished(expected);
+
+        IceInternal::InstancePtr instance = IceInternal::getInstance(communicator);
+        IceInternal::BasicStream os(instance.get(), Ice::currentEncoding);
+        os.write(tick);
+        os.write(ticks);
+        os.write(points);
+        test(Ice::ByteSeq(os.b.begin(), os.b.end()) == expected);
+
+        IceInternal::BasicStream is(instance.get(), Ice::currentEncoding, &expected[0],
+                                    &expected[0] + expected.size());
+        Test::Tick tick2;
+        Test::TickSeq ticks2;
+        Test::PointSeq points2;
+        is.read(tick2);
+        is.read(ticks2);
+        is.read(points2);
+        test(tick2 == tick);
+        test(ticks2 == ticks);
+        test(points2 == points);
+
+        IceInternal::BasicStream truncated(instance.get(), Ice::currentEncoding, &expected[0], &expected[0] + 10);
+        try
+        {
+            truncated.read(tick2);
+            test(false);
+        }
+        catch(const Ice::UnmarshalOutOfBoundsException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing string views... " << flush;
+    {
+        Test::StringSeq in;
+        for(int i = 0; i < 100; ++i)
+        {
+            ostringstream os;
+            os << "key" << i;
+            in.push_back(os.str());
+        }
+        in.push_back("");
+
+        Ice::StringViewSeq views(in.begin(), in.end());
+        Test::StringSeq out;
+        Test::StringSeq ret = t->opStringViewSeq("key:", views, out);
+        test(out == in);
+        test(ret.size() == in.size());
+        for(size_t i = 0; i < in.size(); ++i)
+        {
+            test(ret[i] == "key:" + in[i]);
+        }
+
+        CallbackPtr cb = new Callback();
+        t->begin_opStringViewSeq("key:", views,
+                                 Test::newCallback_TestIntf_opStringViewSeq(cb, &Callback::opStringViewSeq,
+                                                                            &Callback::noEx),
+                                 newInParam(in));
+        cb->check();
+
+        //
+        // The process has a string converter installed: the converted
+        // strings are held by the stream and the views must remain valid
+        // while more strings are read.
+        //
+        IceInternal::InstancePtr instance = IceInternal::getInstance(communicator);
+        IceInternal::BasicStream os(instance.get(), Ice::currentEncoding);
+        os.write(in);
+        Ice::ByteSeq data(os.b.begin(), os.b.end());
+        IceInternal::BasicStream is(instance.get(), Ice::currentEncoding, &data[0], &data[0] + data.size());
+        Ice::StringViewSeq views2;
+        is.read(views2);
+        test(is.i == is.b.end());
+        test(views2.size() == in.size());
+        for(size_t i = 0; i < in.size(); ++i)
+        {
+            test(views2[i] == in[i]);
+            test(views2[i].toString() == in[i]);
+        }
+    }
+    cout << "ok" << endl;
+
     cout << "testing wstring... " << flush;
 
     Test1::WstringSeq wseq1;
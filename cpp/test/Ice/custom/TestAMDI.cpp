@@ -288,6 +288,34 @@ TestIntfI::opClassStruct_async(const ::Test::AMD_TestIntf_opClassStructPtr& cb,
     cb->ice_response(inS, inS, inSeq);
 }
 
+void
+TestIntfI::opPackedStruct_async(const ::Test::AMD_TestIntf_opPackedStructPtr& cb,
+                                const ::Test::Tick& inS,
+                                const ::Test::TickSeq& inSeq,
+                                const ::Test::PointSeq& inPoints,
+                                const ::Ice::Current&)
+{
+    cb->ice_response(inS, inSeq, inPoints);
+}
+
+void
+TestIntfI::opStringViewSeq_async(const ::Test::AMD_TestIntf_opStringViewSeqPtr& cb,
+                                 const Ice::StringView& prefix,
+                                 const Ice::StringViewSeq& inSeq,
+                                 const ::Ice::Current&)
+{
+    //
+    // The views are only valid until the dispatch returns, they can be
+    // passed to ice_response since it marshals the response right away.
+    //
+    ::Test::StringSeq ret;
+    for(Ice::StringViewSeq::const_iterator p = inSeq.begin(); p != inSeq.end(); ++p)
+    {
+        ret.push_back(prefix.toString() + p->toString());
+    }
+    cb->ice_response(Ice::StringViewSeq(ret.begin(), ret.end()), inSeq);
+}
+
 
 void
 TestIntfI::opOutArrayByteSeq_async(const ::Test::AMD_TestIntf_opOutArrayByteSeqPtr& cb,
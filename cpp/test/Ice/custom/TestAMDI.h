@@ -140,6 +140,17 @@ public:
                                      const ::Test::ClassStructPtr&,
                                      const ::Test::ClassStructSeq&,
                                      const ::Ice::Current&);
+
+    virtual void opPackedStruct_async(const ::Test::AMD_TestIntf_opPackedStructPtr&,
+                                      const ::Test::Tick&,
+                                      const ::Test::TickSeq&,
+                                      const ::Test::PointSeq&,
+                                      const ::Ice::Current&);
+
+    virtual void opStringViewSeq_async(const ::Test::AMD_TestIntf_opStringViewSeqPtr&,
+                                       const Ice::StringView&,
+                                       const Ice::StringViewSeq&,
+                                       const ::Ice::Current&);
                                      
                                      
     virtual void opOutArrayByteSeq_async(const ::Test::AMD_TestIntf_opOutArrayByteSeqPtr&,
@@ -336,6 +336,34 @@ TestIntfI::opClassStruct(const ::Test::ClassStructPtr& inS,
     return inS;
 }
 
+::Test::Tick
+TestIntfI::opPackedStruct(const ::Test::Tick& inS,
+                          const ::Test::TickSeq& inSeq,
+                          const ::Test::PointSeq& inPoints,
+                          ::Test::TickSeq& outSeq,
+                          ::Test::PointSeq& outPoints,
+                          const Ice::Current&)
+{
+    outSeq = inSeq;
+    outPoints = inPoints;
+    return inS;
+}
+
+::Test::StringSeq
+TestIntfI::opStringViewSeq(const Ice::StringView& prefix,
+                           const Ice::StringViewSeq& inSeq,
+                           ::Test::StringSeq& outSeq,
+                           const Ice::Current&)
+{
+    ::Test::StringSeq ret;
+    for(Ice::StringViewSeq::const_iterator p = inSeq.begin(); p != inSeq.end(); ++p)
+    {
+        outSeq.push_back(p->toString());
+        ret.push_back(prefix.toString() + p->toString());
+    }
+    return ret;
+}
+
 void
 TestIntfI::opOutArrayByteSeq(const Test::ByteSeq& data, Test::ByteSeq& copy, const Ice::Current&)
 {
@@ -162,6 +162,18 @@ public:
                                                  ::Test::ClassStructPtr& out,
                                                  ::Test::ClassStructSeq& outSeq,
                                                  const Ice::Current&);
+
+    virtual ::Test::Tick opPackedStruct(const ::Test::Tick&,
+                                        const ::Test::TickSeq&,
+                                        const ::Test::PointSeq&,
+                                        ::Test::TickSeq&,
+                                        ::Test::PointSeq&,
+                                        const Ice::Current&);
+
+    virtual ::Test::StringSeq opStringViewSeq(const Ice::StringView&,
+                                              const Ice::StringViewSeq&,
+                                              ::Test::StringSeq&,
+                                              const Ice::Current&);
                                                  
                                                  
     virtual void opOutArrayByteSeq(const Test::ByteSeq&, Test::ByteSeq&, const Ice::Current&);
@@ -1025,6 +1025,27 @@ allTests(const Ice::CommunicatorPtr& communicator)
         test(false);
     }
 
+    {
+        //
+        // Names that only differ from existing operations by one
+        // character or by their length.
+        //
+        const char* names[] = { "", "t", "throwAasZ", "throwAasA_", "throwAas", "ice_pinG", "Ice_ping", "shutdowN" };
+        for(size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+        {
+            try
+            {
+                Ice::ByteSeq outParams;
+                thrower->ice_invoke(names[i], Ice::Normal, Ice::ByteSeq(), outParams);
+                test(false);
+            }
+            catch(const Ice::OperationNotExistException& ex)
+            {
+                test(ex.operation == names[i]);
+            }
+        }
+    }
+
     cout << "ok" << endl;
 
     cout << "catching unknown local exception... " << flush;
@@ -19,6 +19,52 @@ class EmptyI : virtual public Empty
 {
 };
 
+class RegistrationThread : public IceUtil::Thread
+{
+public:
+
+    RegistrationThread(const Ice::ObjectAdapterPtr& adapter, int id) :
+        _adapter(adapter),
+        _id(id)
+    {
+    }
+
+    virtual void run()
+    {
+        Ice::ObjectPtr obj = new EmptyI;
+        for(int i = 0; i < 500; ++i)
+        {
+            Ice::Identity ident = identity(_id, i);
+            _adapter->add(obj, ident);
+            _adapter->addFacet(obj, ident, "f");
+            test(_adapter->find(ident) == obj);
+            test(_adapter->findFacet(ident, "f") == obj);
+            test(_adapter->findAllFacets(ident).size() == 2);
+            if(i % 2 == 1)
+            {
+                _adapter->remove(ident);
+                test(_adapter->findAllFacets(ident).size() == 1);
+                _adapter->removeAllFacets(ident);
+                test(!_adapter->find(ident));
+            }
+        }
+    }
+
+    static Ice::Identity identity(int id, int i)
+    {
+        ostringstream os;
+        os << "concurrent-" << id << "-" << i;
+        Ice::Identity ident;
+        ident.name = os.str();
+        return ident;
+    }
+
+private:
+
+    const Ice::ObjectAdapterPtr _adapter;
+    const int _id;
+};
+
 GPrx
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -98,6 +144,37 @@ allTests(const Ice::CommunicatorPtr& communicator)
     test(fm[""] == obj3);
     cout << "ok" << endl;
 
+    cout << "testing concurrent servant registration... " << flush;
+    {
+        vector<IceUtil::ThreadControl> threads;
+        for(int i = 0; i < 4; ++i)
+        {
+            IceUtil::ThreadPtr thread = new RegistrationThread(adapter, i);
+            threads.push_back(thread->start());
+        }
+        for(vector<IceUtil::ThreadControl>::iterator p = threads.begin(); p != threads.end(); ++p)
+        {
+            p->join();
+        }
+        for(int i = 0; i < 4; ++i)
+        {
+            for(int j = 0; j < 500; ++j)
+            {
+                Ice::Identity ident = RegistrationThread::identity(i, j);
+                if(j % 2 == 1)
+                {
+                    test(!adapter->find(ident));
+                }
+                else
+                {
+                    test(adapter->findAllFacets(ident).size() == 2);
+                    adapter->removeAllFacets(ident);
+                }
+            }
+        }
+    }
+    cout << "ok" << endl;
+
     adapter->deactivate();
 
     cout << "testing stringToProxy... " << flush;
@@ -0,0 +1,353 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestCommon.h>
+#include <Test.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+class InvocationObserverI : public Ice::Instrumentation::HedgedInvocationObserver, public IceUtil::Mutex
+{
+public:
+
+    InvocationObserverI() :
+        _hedged(0)
+    {
+    }
+
+    virtual void
+    attach()
+    {
+    }
+
+    virtual void
+    detach()
+    {
+    }
+
+    virtual void
+    failed(const string&)
+    {
+    }
+
+    virtual void
+    retried()
+    {
+    }
+
+    virtual void
+    hedged()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        ++_hedged;
+    }
+
+    virtual void
+    userException()
+    {
+    }
+
+    virtual Ice::Instrumentation::RemoteObserverPtr
+    getRemoteObserver(const Ice::ConnectionInfoPtr&, const Ice::EndpointPtr&, Ice::Int, Ice::Int)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::CollocatedObserverPtr
+    getCollocatedObserver(const Ice::ObjectAdapterPtr&, Ice::Int, Ice::Int)
+    {
+        return 0;
+    }
+
+    int
+    takeHedgedCount()
+    {
+        IceUtil::Mutex::Lock sync(*this);
+        int hedged = _hedged;
+        _hedged = 0;
+        return hedged;
+    }
+
+private:
+
+    int _hedged;
+};
+typedef IceUtil::Handle<InvocationObserverI> InvocationObserverIPtr;
+
+InvocationObserverIPtr invocationObserver = new InvocationObserverI();
+
+class CommunicatorObserverI : public Ice::Instrumentation::CommunicatorObserver
+{
+public:
+
+    virtual Ice::Instrumentation::ObserverPtr
+    getConnectionEstablishmentObserver(const Ice::EndpointPtr&, const string&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::ObserverPtr
+    getEndpointLookupObserver(const Ice::EndpointPtr&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::ConnectionObserverPtr
+    getConnectionObserver(const Ice::ConnectionInfoPtr&, const Ice::EndpointPtr&,
+                          Ice::Instrumentation::ConnectionState,
+                          const Ice::Instrumentation::ConnectionObserverPtr&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::ThreadObserverPtr
+    getThreadObserver(const string&, const string&, Ice::Instrumentation::ThreadState,
+                      const Ice::Instrumentation::ThreadObserverPtr&)
+    {
+        return 0;
+    }
+
+    virtual Ice::Instrumentation::InvocationObserverPtr
+    getInvocationObserver(const Ice::ObjectPrx&, const string&, const Ice::Context&)
+    {
+        return invocationObserver;
+    }
+
+    virtual Ice::Instrumentation::DispatchObserverPtr
+    getDispatchObserver(const Ice::Current&, Ice::Int)
+    {
+        return 0;
+    }
+
+    virtual void
+    setObserverUpdater(const Ice::Instrumentation::ObserverUpdaterPtr&)
+    {
+    }
+};
+
+//
+// Returns the endpoints of both replicas for the Replicated adapter,
+// the slow one first, and only the endpoint of the slow replica for
+// the Slow adapter.
+//
+class LocatorI : public Ice::Locator
+{
+public:
+
+    virtual void
+    findObjectById_async(const Ice::AMD_Locator_findObjectByIdPtr& cb, const Ice::Identity&,
+                         const Ice::Current&) const
+    {
+        cb->ice_response(0);
+    }
+
+    virtual void
+    findAdapterById_async(const Ice::AMD_Locator_findAdapterByIdPtr& cb, const string& id,
+                          const Ice::Current& current) const
+    {
+        Ice::CommunicatorPtr communicator = current.adapter->getCommunicator();
+        if(id == "Replicated")
+        {
+            cb->ice_response(communicator->stringToProxy("dummy:default -p 12011:default -p 12010"));
+        }
+        else if(id == "Slow")
+        {
+            cb->ice_response(communicator->stringToProxy("dummy:default -p 12011"));
+        }
+        else
+        {
+            cb->ice_response(0);
+        }
+    }
+
+    virtual Ice::LocatorRegistryPrx
+    getRegistry(const Ice::Current&) const
+    {
+        return 0;
+    }
+};
+
+//
+// The hedged request is counted once it's sent, which can be after
+// the reply of the invocation is received.
+//
+void
+testHedgedCount(int expected)
+{
+    int hedged = 0;
+    for(int i = 0; i < 100; ++i)
+    {
+        hedged += invocationObserver->takeHedgedCount();
+        if(hedged >= expected)
+        {
+            break;
+        }
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+    }
+    test(hedged == expected);
+}
+
+}
+
+Ice::Instrumentation::CommunicatorObserverPtr
+getObserver()
+{
+    return new CommunicatorObserverI();
+}
+
+HedgePrx
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    cout << "testing stringToProxy... " << flush;
+    string ref = "hedge:default -p 12011:default -p 12010";
+    Ice::ObjectPrx base = communicator->stringToProxy(ref);
+    test(base);
+    cout << "ok" << endl;
+
+    cout << "testing checked cast... " << flush;
+    HedgePrx hedge = HedgePrx::checkedCast(base->ice_endpointSelection(Ice::Ordered));
+    test(hedge);
+    cout << "ok" << endl;
+
+    cout << "testing hedging... " << flush;
+    {
+        //
+        // The first 100 invocations measure the latency of the
+        // operation, they're not hedged.
+        //
+        Ice::Int remainingTime;
+        for(int i = 0; i < 100; ++i)
+        {
+            test(hedge->op(20, remainingTime) == "SlowAdapter");
+        }
+        testHedgedCount(0);
+
+        //
+        // The slow replica doesn't reply in time, the request is sent
+        // to the other replica which replies first.
+        //
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(hedge->op(2000, remainingTime) == "TestAdapter");
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1500));
+        test(remainingTime == -1);
+        testHedgedCount(1);
+
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(hedge->end_op(remainingTime, hedge->begin_op(2000)) == "TestAdapter");
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1500));
+        testHedgedCount(1);
+
+        //
+        // Non-idempotent invocations are never hedged.
+        //
+        test(hedge->opNotIdempotent(0) == "SlowAdapter");
+        testHedgedCount(0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing hedged request deadline... " << flush;
+    {
+        //
+        // The deadline of the hedged request is charged with the time
+        // the invocation waited for the slow replica, at least the 20ms
+        // latency measured above.
+        //
+        HedgePrx timeout = hedge->ice_invocationTimeout(5000);
+        Ice::Int remainingTime;
+        test(timeout->op(2000, remainingTime) == "TestAdapter");
+        test(remainingTime >= 0 && remainingTime <= 5000 - 20);
+        testHedgedCount(1);
+
+        test(timeout->end_op(remainingTime, timeout->begin_op(2000)) == "TestAdapter");
+        test(remainingTime >= 0 && remainingTime <= 5000 - 20);
+        testHedgedCount(1);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing hedged metrics... " << flush;
+    {
+        IceMX::MetricsAdminPrx metrics =
+            IceMX::MetricsAdminPrx::checkedCast(communicator->getAdmin(), "Metrics");
+        test(metrics);
+        Ice::Long timestamp;
+        IceMX::MetricsView view = metrics->getMetricsView("View", timestamp);
+        IceMX::MetricsMap map = view["Invocation"];
+        IceMX::InvocationMetricsPtr op;
+        IceMX::InvocationMetricsPtr opNotIdempotent;
+        for(IceMX::MetricsMap::const_iterator p = map.begin(); p != map.end(); ++p)
+        {
+            if((*p)->id == "op")
+            {
+                op = IceMX::InvocationMetricsPtr::dynamicCast(*p);
+            }
+            else if((*p)->id == "opNotIdempotent")
+            {
+                opNotIdempotent = IceMX::InvocationMetricsPtr::dynamicCast(*p);
+            }
+        }
+        test(op && op->hedged && *op->hedged == 4);
+        test(opNotIdempotent && !opNotIdempotent->hedged);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing hedging with a locator... " << flush;
+    {
+        Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+        Ice::LocatorPrx locator = Ice::LocatorPrx::uncheckedCast(
+            adapter->add(new LocatorI, communicator->stringToIdentity("locator")));
+
+        //
+        // The invocation uses the slow replica, the hedged request must
+        // be sent to the other replica returned by the locator. Wait
+        // for the slow replica to finish the dispatches delayed by the
+        // tests above, they would delay this invocation too.
+        //
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(2000));
+        HedgePrx indirect = HedgePrx::uncheckedCast(
+            communicator->stringToProxy("hedge @ Replicated")->ice_locator(locator)->
+                ice_endpointSelection(Ice::Ordered));
+        Ice::Int remainingTime;
+
+        //
+        // Replenish the budget used by the hedged requests of the tests
+        // above.
+        //
+        for(int i = 0; i < 60; ++i)
+        {
+            test(indirect->op(0, remainingTime) == "SlowAdapter");
+        }
+        testHedgedCount(0);
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        test(indirect->op(2000, remainingTime) == "TestAdapter");
+        test(IceUtil::Time::now(IceUtil::Time::Monotonic) - start < IceUtil::Time::milliSeconds(1500));
+        testHedgedCount(1);
+
+        test(indirect->end_op(remainingTime, indirect->begin_op(2000)) == "TestAdapter");
+        testHedgedCount(1);
+
+        //
+        // The locator only returns the endpoint used by the invocation,
+        // there's no other replica to hedge the request to.
+        //
+        indirect = HedgePrx::uncheckedCast(communicator->stringToProxy("hedge @ Slow")->ice_locator(locator));
+        test(indirect->op(100, remainingTime) == "SlowAdapter");
+        testHedgedCount(0);
+
+        adapter->destroy();
+    }
+    cout << "ok" << endl;
+
+    return hedge;
+}
@@ -0,0 +1,44 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+string
+HedgeI::op(Ice::Int slowDelay, Ice::Int& remainingTime, const Ice::Current& current)
+{
+    if(current.adapter->getName() == "SlowAdapter")
+    {
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(slowDelay));
+    }
+
+    Ice::Long deadline = Ice::getDispatchDeadline();
+    remainingTime = -1;
+    if(deadline > 0)
+    {
+        Ice::Long remaining = deadline - IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+        remainingTime = static_cast<Ice::Int>(remaining > 0 ? remaining : 0);
+    }
+    return current.adapter->getName();
+}
+
+string
+HedgeI::opNotIdempotent(Ice::Int slowDelay, const Ice::Current& current)
+{
+    Ice::Int remainingTime;
+    return op(slowDelay, remainingTime, current);
+}
+
+void
+HedgeI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
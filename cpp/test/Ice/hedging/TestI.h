@@ -0,0 +1,24 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+class HedgeI : public Test::Hedge
+{
+public:
+
+    virtual std::string op(Ice::Int, Ice::Int&, const Ice::Current&);
+    virtual std::string opNotIdempotent(Ice::Int, const Ice::Current&);
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
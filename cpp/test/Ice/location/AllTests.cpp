@@ -560,6 +560,42 @@ allTests(const Ice::CommunicatorPtr& communicator, const string& ref)
     }
     cout << "ok" << endl;
 
+    cout << "testing locator cache refresh-ahead... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.LocatorCacheRefreshAhead", "50");
+        Ice::CommunicatorPtr ic = Ice::initialize(initData);
+
+        registry->setAdapterDirectProxy("TestAdapter5", locator->findAdapterById("TestAdapter"));
+        const string prx = "test@TestAdapter5";
+
+        int count = locator->getRequestCount();
+        ic->stringToProxy(prx)->ice_locatorCacheTimeout(2)->ice_ping(); // 2s timeout.
+        test(++count == locator->getRequestCount());
+        for(int i = 0; i < 2; ++i)
+        {
+            //
+            // Once half of the timeout elapsed, the cached endpoints are
+            // still used but a single refresh is requested.
+            //
+            IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(1200));
+            ic->stringToProxy(prx)->ice_locatorCacheTimeout(2)->ice_ping();
+            ic->stringToProxy(prx)->ice_locatorCacheTimeout(2)->ice_ping();
+            ++count;
+            int retry = 0;
+            while(locator->getRequestCount() < count && ++retry < 100)
+            {
+                IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(10));
+            }
+            test(count == locator->getRequestCount());
+        }
+        ic->stringToProxy(prx)->ice_locatorCacheTimeout(2)->ice_ping();
+        test(count == locator->getRequestCount());
+        ic->destroy();
+    }
+    cout << "ok" << endl;
+
     cout << "testing proxy from server after shutdown... " << flush;
     hello = obj->getReplicatedHello();
     obj->shutdown();
@@ -56,5 +56,61 @@ main(int argc, char* argv[])
     in.close();
     remove("log.txt");
     cout << "ok" << endl;
+
+    cout << "testing asynchronous logger with log rotation... " << flush;
+    {
+        remove("log.txt");
+        remove("log.txt.1");
+        remove("log.txt.2");
+
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->load("config.client");
+        initData.properties->setProperty("Ice.LogFile", "log.txt");
+        initData.properties->setProperty("Ice.Logger.Async", "1");
+        initData.properties->setProperty("Ice.LogFile.MaxSize", "4096");
+        initData.properties->setProperty("Ice.LogFile.MaxFiles", "2");
+        Ice::CommunicatorPtr communicator = Ice::initialize(initData);
+
+        //
+        // The clone shares the log file and the writer of the logger.
+        //
+        Ice::LoggerPtr logger = communicator->getLogger();
+        Ice::LoggerPtr clone = logger->cloneWithPrefix("clone");
+        for(int i = 0; i < 1000; ++i)
+        {
+            ostringstream os;
+            os << "message " << i;
+            (i % 2 == 0 ? logger : clone)->trace("Test", os.str());
+        }
+        communicator->destroy();
+
+        //
+        // Messages logged after destroy are written synchronously.
+        //
+        logger->trace("Test", "message 1000");
+
+        test(!ifstream("log.txt.3"));
+        const char* files[] = { "log.txt.2", "log.txt.1", "log.txt" };
+        int next = -1;
+        for(int i = 0; i < 3; ++i)
+        {
+            ifstream file(files[i]);
+            test(file);
+            string line;
+            while(getline(file, line))
+            {
+                string::size_type pos = line.find("Test: message ");
+                test(pos != string::npos);
+                int n = atoi(line.substr(pos + 14).c_str());
+                test(next < 0 || n == next);
+                next = n + 1;
+            }
+            file.close();
+            remove(files[i]);
+        }
+        test(next == 1001);
+    }
+    cout << "ok" << endl;
     return EXIT_SUCCESS;
 }
@@ -8,10 +8,15 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <Ice/MetricsAdminI.h>
+#include <Ice/Network.h>
 #include <TestCommon.h>
 #include <InstrumentationI.h>
 #include <Test.h>
 
+#include <fstream>
+#include <cstdio>
+
 using namespace std;
 using namespace Test;
 
@@ -382,6 +387,43 @@ toMap(const IceMX::MetricsMap& mmap)
     return m;
 }
 
+class PingI : public Ice::Object
+{
+};
+
+Ice::Long
+getLatencyCount(const IceMX::LatencyHistogram& histogram)
+{
+    Ice::Long count = 0;
+    for(IceMX::LatencyHistogram::const_iterator p = histogram.begin(); p != histogram.end(); ++p)
+    {
+        count += *p;
+    }
+    return count;
+}
+
+string
+httpGet(int port, const string& request)
+{
+    IceInternal::Address addr = IceInternal::getAddressForServer("127.0.0.1", port, IceInternal::EnableIPv4, false);
+    SOCKET fd = IceInternal::createSocket(false, addr);
+    IceInternal::setBlock(fd, true);
+    IceInternal::doConnect(fd, addr, IceInternal::Address());
+
+    string data = request + "\r\n\r\n";
+    test(::send(fd, data.data(), static_cast<int>(data.size()), 0) == static_cast<int>(data.size()));
+
+    string response;
+    char buf[4096];
+    int ret;
+    while((ret = static_cast<int>(::recv(fd, buf, sizeof(buf), 0))) > 0)
+    {
+        response.append(buf, static_cast<size_t>(ret));
+    }
+    IceInternal::closeSocket(fd);
+    return response;
+}
+
 }
 
 MetricsPrx
@@ -390,6 +432,34 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
     MetricsPrx metrics = MetricsPrx::checkedCast(communicator->stringToProxy("metrics:default -p 12010"));
     bool collocated = !metrics->ice_getConnection();
 
+    cout << "testing latency histograms... " << flush;
+    test(IceMX::getLatencyBucket(0) == 0 && IceMX::getLatencyBucket(3) == 3);
+    test(IceMX::getLatencyBucket(4) == 4 && IceMX::getLatencyBucket(7) == 7);
+    test(IceMX::getLatencyBucket(8) == 8 && IceMX::getLatencyBucket(9) == 8 && IceMX::getLatencyBucket(10) == 9);
+    test(IceMX::getLatencyBucket(16) == 12 && IceMX::getLatencyBucket(19) == 12);
+    test(IceMX::getLatencyBucket(IceMX::getLatencyBucketUpperBound(42)) == 43);
+    test(IceMX::getLatencyBucket(IceMX::getLatencyBucketUpperBound(42) - 1) == 42);
+    test(IceMX::getLatencyBucket(-1) == 0);
+    test(IceMX::getLatencyBucket(ICE_INT64(0x7fffffffffffffff)) == IceMX::latencyBucketCount - 1);
+    {
+        IceMX::LatencyHistogram histogram;
+        test(IceMX::getLatencyPercentile(histogram, 50) == 0);
+        for(int i = 0; i < 90; ++i)
+        {
+            IceMX::addLatency(histogram, 100);
+        }
+        for(int i = 0; i < 10; ++i)
+        {
+            IceMX::addLatency(histogram, 10000);
+        }
+        test(histogram.size() == static_cast<size_t>(IceMX::getLatencyBucket(10000)) + 1);
+        test(getLatencyCount(histogram) == 100);
+        test(IceMX::getLatencyPercentile(histogram, 50) >= 100 && IceMX::getLatencyPercentile(histogram, 50) < 125);
+        test(IceMX::getLatencyPercentile(histogram, 90) == IceMX::getLatencyPercentile(histogram, 50));
+        test(IceMX::getLatencyPercentile(histogram, 99) >= 10000 && IceMX::getLatencyPercentile(histogram, 99) < 12500);
+    }
+    cout << "ok" << endl;
+
     cout << "testing metrics admin facet checkedCast... " << flush;
     Ice::ObjectPrx admin = communicator->getAdmin();
     Ice::PropertiesAdminPrx clientProps = Ice::PropertiesAdminPrx::checkedCast(admin, "Properties");
@@ -830,6 +900,7 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
     IceMX::DispatchMetricsPtr dm1 = IceMX::DispatchMetricsPtr::dynamicCast(map["op"]);
     test(dm1->current <= 1 && dm1->total == 1 && dm1->failures == 0 && dm1->userException == 0);
     test(dm1->size == 21 && dm1->replySize == 7);
+    test(dm1->latency && getLatencyCount(*dm1->latency) == dm1->total - dm1->current);
 
     dm1 = IceMX::DispatchMetricsPtr::dynamicCast(map["opWithUserException"]);
     test(dm1->current <= 1 && dm1->total == 1 && dm1->failures == 0 && dm1->userException == 1);
@@ -1021,6 +1092,8 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
     rim1 = IceMX::ChildInvocationMetricsPtr::dynamicCast(!collocated ? im1->remotes[0] : im1->collocated[0]);
     test(rim1->current == 0 && rim1->total == 3 && rim1->failures == 0);
     test(rim1->size == 63 && rim1->replySize == 21);
+    test(im1->latency && getLatencyCount(*im1->latency) == im1->total - im1->current);
+    test(rim1->latency && getLatencyCount(*rim1->latency) == 3 && rim1->latency->back() > 0);
 
     im1 = IceMX::InvocationMetricsPtr::dynamicCast(map["opWithUserException"]);
     test(im1->current <= 1 && im1->total == 3 && im1->failures == 0 && im1->retry == 0);
@@ -1242,5 +1315,148 @@ allTests(const Ice::CommunicatorPtr& communicator, const CommunicatorObserverIPt
     }
     cout << "ok" << endl;
 
+    cout << "testing OpenMetrics plugin... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        Ice::PropertyDict views = initData.properties->getPropertiesForPrefix("IceMX.");
+        for(Ice::PropertyDict::const_iterator p = views.begin(); p != views.end(); ++p)
+        {
+            initData.properties->setProperty(p->first, "");
+        }
+        initData.properties->setProperty("Ice.Admin.Endpoints", "");
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("IceMX.Metrics.View.GroupBy", "id");
+        initData.properties->setProperty("IceMX.Metrics.Op.GroupBy", "operation");
+        initData.properties->setProperty("Ice.Plugin.IceOpenMetrics", "Ice:createIceOpenMetrics");
+        initData.properties->setProperty("IceOpenMetrics.Host", "127.0.0.1");
+        initData.properties->setProperty("IceOpenMetrics.Port", "12015");
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        try
+        {
+            com->getProperties()->setProperty("PingAdapter.Endpoints", "default -p 12016");
+            Ice::ObjectAdapterPtr adapter = com->createObjectAdapter("PingAdapter");
+            Ice::ObjectPrx p = adapter->add(new PingI, com->stringToIdentity("ping"))->ice_collocationOptimized(false);
+            adapter->activate();
+            p->ice_ping();
+            p->ice_ping();
+            p->ice_ping();
+
+            string response = httpGet(12015, "GET /metrics HTTP/1.1\r\nHost: localhost");
+            test(response.find("HTTP/1.1 200 OK\r\n") == 0);
+            test(response.find("Content-Type: application/openmetrics-text") != string::npos);
+            test(response.find("# TYPE ice_invocation counter\n") != string::npos);
+            test(response.find("ice_invocation_total{view=\"Op\",id=\"ice_ping\"} 3\n") != string::npos);
+            test(response.find("ice_invocation_duration_seconds_count{view=\"Op\",id=\"ice_ping\"} 3\n") !=
+                 string::npos);
+            test(response.find("ice_invocation_duration_seconds_bucket{view=\"Op\",id=\"ice_ping\",le=\"+Inf\"} 3\n")
+                 != string::npos);
+            const string remote = "{view=\"View\",invocation=\"ping -t -e 1.1 [ice_ping]\","
+                                  "id=\"tcp -h 127.0.0.1 -p 12016 -t ";
+            test(response.find("ice_invocation_remote_total" + remote) != string::npos);
+            test(response.find("ice_invocation_remote_duration_seconds_count" + remote) != string::npos);
+            for(string::size_type pos = 0; pos < response.size();)
+            {
+                string::size_type end = response.find('\n', pos);
+                string sample = response.substr(pos, end - pos);
+                string::size_type id = sample.find(",id=\"");
+                test(id == string::npos || sample.find(",id=\"", id + 1) == string::npos);
+                pos = end == string::npos ? end : end + 1;
+            }
+            test(response.find("# TYPE ice_thread_in_use_for_user gauge\n") != string::npos);
+            test(response.find("ice_connection_sent_bytes_total{view=\"View\",id=\"") != string::npos);
+            test(response.find("# EOF\n") == response.size() - 6);
+
+            response = httpGet(12015, "HEAD /metrics HTTP/1.1");
+            test(response.find("HTTP/1.1 200 OK\r\n") == 0);
+            test(response.find("# EOF") == string::npos);
+
+            response = httpGet(12015, "GET /unknown HTTP/1.1");
+            test(response.find("HTTP/1.1 404 Not Found\r\n") == 0);
+
+            response = httpGet(12015, "POST /metrics HTTP/1.1");
+            test(response.find("HTTP/1.1 405 Method Not Allowed\r\n") == 0);
+        }
+        catch(...)
+        {
+            com->destroy();
+            throw;
+        }
+        com->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing request tracing... " << flush;
+    {
+        const string file = "tracing.log";
+        remove(file.c_str());
+
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->setProperty("Ice.Tracing.Sample", "2");
+        initData.properties->setProperty("Ice.Tracing.File", file);
+        Ice::CommunicatorPtr com = Ice::initialize(initData);
+        try
+        {
+            com->getProperties()->setProperty("PingAdapter.Endpoints", "default -p 12016");
+            Ice::ObjectAdapterPtr adapter = com->createObjectAdapter("PingAdapter");
+            Ice::ObjectPrx p = adapter->add(new PingI, com->stringToIdentity("ping"))->ice_collocationOptimized(false);
+            adapter->activate();
+            p->ice_ping();
+            p->ice_ping(); // Not sampled.
+            p->end_ice_ping(p->begin_ice_ping());
+            p->ice_ping(); // Not sampled.
+        }
+        catch(...)
+        {
+            com->destroy();
+            throw;
+        }
+        com->destroy(); // Writes the remaining spans.
+
+        ifstream is(file.c_str());
+        test(is.good());
+        vector<string> invocations;
+        vector<string> dispatches;
+        string line;
+        while(getline(is, line))
+        {
+            test(line.find(" operation=ice_ping ") != string::npos);
+            test(line.find(" failed") == string::npos);
+            if(line.find("invocation trace=") == 0)
+            {
+                test(line.find(" parent=0000000000000000 ") != string::npos);
+                test(line.find(" sent=+") != string::npos && line.find(" replied=+") != string::npos);
+                invocations.push_back(line);
+            }
+            else
+            {
+                test(line.find("dispatch trace=") == 0);
+                test(line.find(" dispatched=+") != string::npos);
+                dispatches.push_back(line);
+            }
+        }
+        is.close();
+        remove(file.c_str());
+
+        test(invocations.size() == 2);
+        test(dispatches.size() == 2);
+        for(vector<string>::const_iterator p = invocations.begin(); p != invocations.end(); ++p)
+        {
+            string trace = p->substr(p->find("trace=") + 6, 16);
+            string span = p->substr(p->find("span=") + 5, 16);
+            bool found = false;
+            for(vector<string>::const_iterator q = dispatches.begin(); q != dispatches.end(); ++q)
+            {
+                if(q->find("trace=" + trace + " ") != string::npos && q->find(" parent=" + span + " ") != string::npos)
+                {
+                    found = true;
+                }
+            }
+            test(found);
+        }
+    }
+    cout << "ok" << endl;
+
     return metrics;
 }
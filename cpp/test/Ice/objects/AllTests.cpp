@@ -8,6 +8,7 @@
 // **********************************************************************
 
 #include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
 #include <TestCommon.h>
 #include <Test.h>
 
@@ -51,6 +52,118 @@ testUOE(const Ice::CommunicatorPtr& communicator)
     }
 }
 
+ArenaNodePtr
+createArenaNodes(int count)
+{
+    ArenaNodePtr head;
+    for(int i = 0; i < count; ++i)
+    {
+        ArenaNodePtr node;
+        if(i % 2)
+        {
+            node = new ArenaNode();
+        }
+        else
+        {
+            ArenaLeafPtr leaf = new ArenaLeaf();
+            leaf->value = i;
+            node = leaf;
+        }
+        ostringstream os;
+        os << "node" << i;
+        node->name = os.str();
+        node->next = head;
+        head = node;
+    }
+    return head;
+}
+
+void
+checkArenaNodes(const ArenaNodePtr& head, int count)
+{
+    ArenaNodePtr node = head;
+    for(int i = count - 1; i >= 0; --i)
+    {
+        test(node);
+        ostringstream os;
+        os << "node" << i;
+        test(node->name == os.str());
+        ArenaLeafPtr leaf = ArenaLeafPtr::dynamicCast(node);
+        test(i % 2 ? !leaf : leaf && leaf->value == i);
+        node = node->next;
+    }
+    test(!node);
+}
+
+class ArenaThread : public IceUtil::Thread
+{
+public:
+
+    ArenaThread(int count) : _count(count)
+    {
+    }
+
+    virtual void run()
+    {
+        nodes = createArenaNodes(_count);
+    }
+
+    ArenaNodePtr nodes;
+
+private:
+
+    const int _count;
+};
+typedef IceUtil::Handle<ArenaThread> ArenaThreadPtr;
+
+void
+testArena(const Ice::CommunicatorPtr& communicator)
+{
+    const int count = 200;
+    const int chunks = IceInternal::arenaChunkCount();
+
+    //
+    // Instances allocated from the arena by a thread outlive it, its
+    // chunk is freed once they are all destroyed.
+    //
+    ArenaThreadPtr thread = new ArenaThread(count);
+    thread->start().join();
+    checkArenaNodes(thread->nodes, count);
+    test(IceInternal::arenaChunkCount() == chunks + 1);
+
+    Ice::OutputStreamPtr out = Ice::createOutputStream(communicator);
+    out->write(thread->nodes);
+    out->writePendingObjects();
+    Ice::ByteSeq data;
+    out->finished(data);
+    out = 0; // The stream keeps the marshaled instances.
+    thread = 0;
+    test(IceInternal::arenaChunkCount() == chunks);
+
+    //
+    // Unmarshal instances allocated from the arena of this thread, which
+    // keeps using its chunks while they're destroyed between reads.
+    //
+    for(int i = 0; i < 100; ++i)
+    {
+        Ice::InputStreamPtr in = Ice::createInputStream(communicator, data);
+        ArenaNodePtr nodes;
+        in->read(nodes);
+        in->readPendingObjects();
+        checkArenaNodes(nodes, count);
+        test(IceInternal::arenaChunkCount() > chunks && IceInternal::arenaChunkCount() <= chunks + 2);
+    }
+
+    //
+    // Instances too large for the arena are allocated from the heap.
+    //
+    int before = IceInternal::arenaChunkCount();
+    void* p = IceInternal::arenaAllocate(1024 * 1024);
+    memset(p, 0, 1024 * 1024);
+    test(IceInternal::arenaChunkCount() == before);
+    IceInternal::arenaFree(p);
+}
+
 InitialPrx
 allTests(const Ice::CommunicatorPtr& communicator)
 {
@@ -237,5 +350,9 @@ allTests(const Ice::CommunicatorPtr& communicator)
     testUOE(communicator);
     cout << "ok" << endl;
 
+    cout << "testing arena allocation... " << flush;
+    testArena(communicator);
+    cout << "ok" << endl;
+
     return initial;
 }
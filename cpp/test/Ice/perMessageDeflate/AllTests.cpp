@@ -0,0 +1,624 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Random.h>
+#include <TestCommon.h>
+#include <TestI.h>
+
+#include <zlib.h>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+const string endpoint = "ws -h 127.0.0.1 -p 12010";
+
+const unsigned char FLAG_FINAL = 0x80;
+const unsigned char FLAG_RSV1 = 0x40;
+const unsigned char OP_CONT = 0x00;
+const unsigned char OP_DATA = 0x02;
+
+Ice::CommunicatorPtr
+createCommunicator(const Ice::CommunicatorPtr& communicator, const Ice::PropertyDict& properties)
+{
+    Ice::InitializationData initData;
+    initData.properties = communicator->getProperties()->clone();
+    for(Ice::PropertyDict::const_iterator p = properties.begin(); p != properties.end(); ++p)
+    {
+        initData.properties->setProperty(p->first, p->second);
+    }
+    return Ice::initialize(initData);
+}
+
+Ice::CommunicatorPtr
+createServer(const Ice::CommunicatorPtr& communicator, const Ice::PropertyDict& properties)
+{
+    Ice::CommunicatorPtr server = createCommunicator(communicator, properties);
+    server->getProperties()->setProperty("TestAdapter.Endpoints", endpoint);
+    Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+    adapter->add(new TestIntfI, server->stringToIdentity("test"));
+    adapter->activate();
+    return server;
+}
+
+ByteSeq
+randomBytes(size_t size)
+{
+    ByteSeq seq(size);
+    if(size > 0)
+    {
+        IceUtilInternal::generateRandom(reinterpret_cast<char*>(&seq[0]), size);
+    }
+    return seq;
+}
+
+ByteSeq
+patternBytes(size_t size)
+{
+    ByteSeq seq(size);
+    for(size_t i = 0; i < size; ++i)
+    {
+        seq[i] = static_cast<Ice::Byte>("Ice permessage-deflate"[i % 22]);
+    }
+    return seq;
+}
+
+void
+checkEcho(const TestIntfPrx& prx)
+{
+    //
+    // Messages smaller than 100 bytes are sent uncompressed, the others
+    // are compressed. Each message is sent twice to exercise the context
+    // takeover.
+    //
+    const size_t sizes[] = { 0, 10, 70, 86, 87, 100, 1000, 64 * 1024, 300 * 1024 };
+    for(size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        ByteSeq pattern = patternBytes(sizes[i]);
+        ByteSeq random = randomBytes(sizes[i]);
+        for(int j = 0; j < 2; ++j)
+        {
+            test(prx->echo(pattern) == pattern);
+            test(prx->echo(random) == random);
+        }
+    }
+}
+
+//
+// Establishes a connection from a client to a server configured with the
+// given properties and checks that requests of any size can be sent over
+// it. Returns the Sec-WebSocket-Extensions headers from the upgrade
+// request and the upgrade response.
+//
+void
+negotiate(const Ice::CommunicatorPtr& communicator,
+          const Ice::PropertyDict& clientProperties,
+          const Ice::PropertyDict& serverProperties,
+          string& offer,
+          string& response)
+{
+    Ice::CommunicatorPtr server = createServer(communicator, serverProperties);
+    Ice::CommunicatorPtr client;
+    try
+    {
+        client = createCommunicator(communicator, clientProperties);
+        TestIntfPrx prx = TestIntfPrx::checkedCast(client->stringToProxy("test:" + endpoint));
+        test(prx);
+
+        offer = prx->getOffer();
+
+        Ice::WSConnectionInfoPtr info = Ice::WSConnectionInfoPtr::dynamicCast(prx->ice_getConnection()->getInfo());
+        test(info);
+        Ice::HeaderDict::const_iterator p = info->headers.find("Sec-WebSocket-Extensions");
+        response = p == info->headers.end() ? string() : p->second;
+
+        checkEcho(prx);
+    }
+    catch(...)
+    {
+        if(client)
+        {
+            client->destroy();
+        }
+        server->destroy();
+        throw;
+    }
+    client->destroy();
+    server->destroy();
+}
+
+Ice::PropertyDict
+deflateProperties(const string& enabled)
+{
+    Ice::PropertyDict properties;
+    properties["Ice.WS.PerMessageDeflate"] = enabled;
+    return properties;
+}
+
+//
+// A minimal WebSocket client used to send fragmented frames, which the Ice
+// run time never sends, and to inspect the frames sent by the server.
+//
+class RawConnection
+{
+public:
+
+    RawConnection()
+    {
+        _fd = socket(AF_INET, SOCK_STREAM, 0);
+        test(_fd >= 0);
+
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(12010);
+        addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+        test(connect(_fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0);
+    }
+
+    ~RawConnection()
+    {
+        close(_fd);
+    }
+
+    //
+    // Sends the HTTP upgrade request with the given extension offer and
+    // returns the Sec-WebSocket-Extensions header of the response.
+    //
+    string
+    upgrade(const string& offer)
+    {
+        ostringstream os;
+        os << "GET / HTTP/1.1\r\n"
+           << "Host: 127.0.0.1:12010\r\n"
+           << "Upgrade: websocket\r\n"
+           << "Connection: Upgrade\r\n"
+           << "Sec-WebSocket-Protocol: ice.zeroc.com\r\n"
+           << "Sec-WebSocket-Version: 13\r\n"
+           << "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+           << "Sec-WebSocket-Extensions: " << offer << "\r\n"
+           << "\r\n";
+        string request = os.str();
+        write(vector<Ice::Byte>(request.begin(), request.end()));
+
+        string response;
+        while(response.size() < 4 || response.compare(response.size() - 4, 4, "\r\n\r\n") != 0)
+        {
+            response += static_cast<char>(read(1)[0]);
+        }
+        test(response.find("HTTP/1.1 101 ") == 0);
+
+        const string header = "\r\nSec-WebSocket-Extensions: ";
+        string::size_type pos = response.find(header);
+        if(pos == string::npos)
+        {
+            return string();
+        }
+        pos += header.size();
+        return response.substr(pos, response.find("\r\n", pos) - pos);
+    }
+
+    //
+    // Sends a masked frame, as required for frames sent by a client.
+    //
+    void
+    sendFrame(unsigned char flags, vector<Ice::Byte>::const_iterator begin, vector<Ice::Byte>::const_iterator end)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        test(size <= 0xffff);
+
+        vector<Ice::Byte> frame;
+        frame.push_back(flags);
+        if(size < 126)
+        {
+            frame.push_back(static_cast<Ice::Byte>(0x80 | size));
+        }
+        else
+        {
+            frame.push_back(0x80 | 126);
+            frame.push_back(static_cast<Ice::Byte>(size >> 8));
+            frame.push_back(static_cast<Ice::Byte>(size & 0xff));
+        }
+
+        const Ice::Byte mask[] = { 0x12, 0x34, 0x56, 0x78 };
+        frame.insert(frame.end(), mask, mask + 4);
+        for(size_t i = 0; begin != end; ++begin, ++i)
+        {
+            frame.push_back(*begin ^ mask[i % 4]);
+        }
+        write(frame);
+    }
+
+    //
+    // Reads a frame, frames sent by the server must not be masked.
+    // Returns the first byte of the frame header.
+    //
+    unsigned char
+    readFrame(vector<Ice::Byte>& payload)
+    {
+        vector<Ice::Byte> header = read(2);
+        test((header[1] & 0x80) == 0);
+        size_t size = header[1] & 0x7f;
+        if(size == 126 || size == 127)
+        {
+            vector<Ice::Byte> length = read(size == 126 ? 2 : 8);
+            size = 0;
+            for(vector<Ice::Byte>::const_iterator p = length.begin(); p != length.end(); ++p)
+            {
+                size = (size << 8) | *p;
+            }
+        }
+        payload = read(size);
+        return header[0];
+    }
+
+private:
+
+    void
+    write(const vector<Ice::Byte>& data)
+    {
+        size_t written = 0;
+        while(written < data.size())
+        {
+            ssize_t ret = send(_fd, &data[written], data.size() - written, 0);
+            test(ret > 0);
+            written += static_cast<size_t>(ret);
+        }
+    }
+
+    vector<Ice::Byte>
+    read(size_t size)
+    {
+        vector<Ice::Byte> data(size);
+        size_t received = 0;
+        while(received < size)
+        {
+            ssize_t ret = recv(_fd, &data[received], size - received, 0);
+            test(ret > 0);
+            received += static_cast<size_t>(ret);
+        }
+        return data;
+    }
+
+    int _fd;
+};
+
+//
+// Compresses a message with a raw deflate stream and removes the empty
+// stored block which ends the output of Z_SYNC_FLUSH, as done by senders
+// of compressed messages (RFC 7692, section 7.2.1).
+//
+vector<Ice::Byte>
+deflateMessage(z_stream& stream, vector<Ice::Byte> data)
+{
+    vector<Ice::Byte> out(deflateBound(&stream, static_cast<uLong>(data.size())) + 64);
+    stream.next_in = &data[0];
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = &out[0];
+    stream.avail_out = static_cast<uInt>(out.size());
+    test(deflate(&stream, Z_SYNC_FLUSH) == Z_OK);
+    test(stream.avail_in == 0 && stream.avail_out > 0);
+    out.resize(out.size() - stream.avail_out);
+
+    test(out.size() > 4);
+    test(out[out.size() - 4] == 0x00 && out[out.size() - 3] == 0x00 &&
+         out[out.size() - 2] == 0xff && out[out.size() - 1] == 0xff);
+    out.resize(out.size() - 4);
+    return out;
+}
+
+vector<Ice::Byte>
+inflateMessage(z_stream& stream, vector<Ice::Byte> data)
+{
+    const Ice::Byte trailer[] = { 0x00, 0x00, 0xff, 0xff };
+    data.insert(data.end(), trailer, trailer + 4);
+
+    vector<Ice::Byte> out;
+    Ice::Byte buf[4096];
+    stream.next_in = &data[0];
+    stream.avail_in = static_cast<uInt>(data.size());
+    do
+    {
+        stream.next_out = buf;
+        stream.avail_out = sizeof(buf);
+        int err = inflate(&stream, Z_SYNC_FLUSH);
+        test(err == Z_OK || err == Z_BUF_ERROR);
+        out.insert(out.end(), buf, buf + sizeof(buf) - stream.avail_out);
+    }
+    while(stream.avail_in > 0 || stream.avail_out == 0);
+    return out;
+}
+
+vector<Ice::Byte>
+createRequest(const Ice::CommunicatorPtr& communicator, Ice::Int requestId, const ByteSeq& seq)
+{
+    Ice::OutputStreamPtr out = Ice::createOutputStream(communicator);
+    out->write(requestId);
+    out->write(string("test")); // Identity name
+    out->write(string()); // Identity category
+    out->writeSize(0); // Facet
+    out->write(string("echo"));
+    out->write(static_cast<Ice::Byte>(Ice::Normal));
+    out->writeSize(0); // Context
+    out->startEncapsulation();
+    out->write(seq);
+    out->endEncapsulation();
+    vector<Ice::Byte> body;
+    out->finished(body);
+
+    //
+    // Protocol 1.0, encoding 1.0, request message, no compression.
+    //
+    const Ice::Byte header[] = { 'I', 'c', 'e', 'P', 1, 0, 1, 0, 0, 0 };
+    vector<Ice::Byte> message(header, header + sizeof(header));
+    Ice::Int size = static_cast<Ice::Int>(sizeof(header) + 4 + body.size());
+    for(int i = 0; i < 4; ++i)
+    {
+        message.push_back(static_cast<Ice::Byte>((size >> (8 * i)) & 0xff));
+    }
+    message.insert(message.end(), body.begin(), body.end());
+    return message;
+}
+
+ByteSeq
+readReply(const Ice::CommunicatorPtr& communicator, const vector<Ice::Byte>& message, Ice::Int requestId)
+{
+    test(message.size() > 14);
+    test(message[0] == 'I' && message[1] == 'c' && message[2] == 'e' && message[3] == 'P');
+    test(message[8] == 2); // Reply message
+    test(message[9] == 0); // Not compressed
+
+    Ice::InputStreamPtr in =
+        Ice::createInputStream(communicator, make_pair(&message[0] + 14, &message[0] + message.size()));
+    Ice::Int id;
+    in->read(id);
+    test(id == requestId);
+    Ice::Byte status;
+    in->read(status);
+    test(status == 0); // Success
+    ByteSeq seq;
+    in->startEncapsulation();
+    in->read(seq);
+    in->endEncapsulation();
+    return seq;
+}
+
+void
+readValidateConnection(RawConnection& connection)
+{
+    vector<Ice::Byte> payload;
+    test(connection.readFrame(payload) == (FLAG_FINAL | OP_DATA));
+    test(payload.size() == 14);
+    test(payload[8] == 3); // Validate connection message
+}
+
+//
+// Sends a compressed request split in three frames, only the first one
+// has the RSV1 bit set, and returns the compressed reply.
+//
+vector<Ice::Byte>
+sendFragmented(RawConnection& connection, const vector<Ice::Byte>& message)
+{
+    const vector<Ice::Byte>::const_iterator third = message.begin() + message.size() / 3;
+    const vector<Ice::Byte>::const_iterator twoThirds = message.begin() + 2 * (message.size() / 3);
+    connection.sendFrame(FLAG_RSV1 | OP_DATA, message.begin(), third);
+    connection.sendFrame(OP_CONT, third, twoThirds);
+    connection.sendFrame(FLAG_FINAL | OP_CONT, twoThirds, message.end());
+
+    vector<Ice::Byte> payload;
+    test(connection.readFrame(payload) == (FLAG_FINAL | FLAG_RSV1 | OP_DATA));
+    return payload;
+}
+
+}
+
+void
+allTests(const Ice::CommunicatorPtr& communicator)
+{
+    const Ice::PropertyDict enabled = deflateProperties("1");
+    const Ice::PropertyDict disabled = deflateProperties("0");
+
+    //
+    // The raw connections are closed without a close frame.
+    //
+    Ice::PropertyDict rawServer = enabled;
+    rawServer["Ice.Warn.Connections"] = "0";
+    string offer;
+    string response;
+
+    cout << "testing permessage-deflate negotiation... " << flush;
+    {
+        negotiate(communicator, enabled, enabled, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits");
+        test(response == "permessage-deflate");
+
+        //
+        // The server declines the offer.
+        //
+        negotiate(communicator, enabled, disabled, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits");
+        test(response.empty());
+
+        //
+        // The client doesn't offer the extension.
+        //
+        negotiate(communicator, disabled, enabled, offer, response);
+        test(offer.empty());
+        test(response.empty());
+
+        negotiate(communicator, disabled, disabled, offer, response);
+        test(offer.empty());
+        test(response.empty());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing compressed round trips with reduced window sizes... " << flush;
+    {
+        Ice::PropertyDict clientProperties = enabled;
+        clientProperties["Ice.WS.PerMessageDeflate.ClientMaxWindowBits"] = "9";
+        clientProperties["Ice.WS.PerMessageDeflate.ServerMaxWindowBits"] = "11";
+        Ice::PropertyDict serverProperties = enabled;
+        serverProperties["Ice.WS.PerMessageDeflate.ServerMaxWindowBits"] = "10";
+        negotiate(communicator, clientProperties, serverProperties, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits=9; server_max_window_bits=11");
+        test(response == "permessage-deflate; server_max_window_bits=10");
+
+        serverProperties = enabled;
+        serverProperties["Ice.WS.PerMessageDeflate.ClientMaxWindowBits"] = "12";
+        negotiate(communicator, enabled, serverProperties, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits");
+        test(response == "permessage-deflate; client_max_window_bits=12");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing context takeover... " << flush;
+    {
+        Ice::PropertyDict clientProperties = enabled;
+        clientProperties["Ice.WS.PerMessageDeflate.ClientNoContextTakeover"] = "1";
+        negotiate(communicator, clientProperties, enabled, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits; client_no_context_takeover");
+        test(response == "permessage-deflate; client_no_context_takeover");
+
+        clientProperties = enabled;
+        clientProperties["Ice.WS.PerMessageDeflate.ServerNoContextTakeover"] = "1";
+        negotiate(communicator, clientProperties, enabled, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits; server_no_context_takeover");
+        test(response == "permessage-deflate; server_no_context_takeover");
+
+        Ice::PropertyDict serverProperties = enabled;
+        serverProperties["Ice.WS.PerMessageDeflate.ClientNoContextTakeover"] = "1";
+        serverProperties["Ice.WS.PerMessageDeflate.ServerNoContextTakeover"] = "1";
+        negotiate(communicator, enabled, serverProperties, offer, response);
+        test(offer == "permessage-deflate; client_max_window_bits");
+        test(response == "permessage-deflate; server_no_context_takeover; client_no_context_takeover");
+
+        //
+        // Check the frames sent by the server. With context takeover, the
+        // second of two identical replies refers to the first one and is
+        // much smaller. Without context takeover, each reply can be
+        // inflated on its own and both have about the same size.
+        //
+        Ice::CommunicatorPtr server = createServer(communicator, rawServer);
+        try
+        {
+            const ByteSeq data = randomBytes(1000);
+            for(int noContextTakeover = 0; noContextTakeover < 2; ++noContextTakeover)
+            {
+                RawConnection connection;
+                if(noContextTakeover)
+                {
+                    test(connection.upgrade("permessage-deflate; server_no_context_takeover") ==
+                         "permessage-deflate; server_no_context_takeover");
+                }
+                else
+                {
+                    test(connection.upgrade("permessage-deflate") == "permessage-deflate");
+                }
+                readValidateConnection(connection);
+
+                z_stream inflater;
+                memset(&inflater, 0, sizeof(inflater));
+                test(inflateInit2(&inflater, -15) == Z_OK);
+
+                vector<size_t> sizes;
+                for(Ice::Int requestId = 1; requestId <= 2; ++requestId)
+                {
+                    vector<Ice::Byte> request = createRequest(communicator, requestId, data);
+                    connection.sendFrame(FLAG_FINAL | OP_DATA, request.begin(), request.end());
+
+                    vector<Ice::Byte> payload;
+                    test(connection.readFrame(payload) == (FLAG_FINAL | FLAG_RSV1 | OP_DATA));
+                    sizes.push_back(payload.size());
+                    if(noContextTakeover)
+                    {
+                        test(inflateReset(&inflater) == Z_OK);
+                    }
+                    test(readReply(communicator, inflateMessage(inflater, payload), requestId) == data);
+                }
+                inflateEnd(&inflater);
+
+                if(noContextTakeover)
+                {
+                    test(sizes[1] > sizes[0] / 2);
+                }
+                else
+                {
+                    test(sizes[1] < sizes[0] / 2);
+                }
+            }
+        }
+        catch(...)
+        {
+            server->destroy();
+            throw;
+        }
+        server->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing fragmented compressed frames... " << flush;
+    {
+        Ice::CommunicatorPtr server = createServer(communicator, rawServer);
+        try
+        {
+            RawConnection connection;
+            test(connection.upgrade("permessage-deflate; client_max_window_bits") == "permessage-deflate");
+            readValidateConnection(connection);
+
+            z_stream deflater;
+            memset(&deflater, 0, sizeof(deflater));
+            test(deflateInit2(&deflater, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+            z_stream inflater;
+            memset(&inflater, 0, sizeof(inflater));
+            test(inflateInit2(&inflater, -15) == Z_OK);
+
+            //
+            // The second request is compressed with the context of the
+            // first one, the server must keep its inflate context.
+            //
+            const ByteSeq data = randomBytes(1000);
+            for(Ice::Int requestId = 1; requestId <= 2; ++requestId)
+            {
+                vector<Ice::Byte> request = deflateMessage(deflater, createRequest(communicator, requestId, data));
+                vector<Ice::Byte> reply = sendFragmented(connection, request);
+                test(readReply(communicator, inflateMessage(inflater, reply), requestId) == data);
+            }
+
+            //
+            // A fragmented message without RSV1 isn't compressed.
+            //
+            vector<Ice::Byte> request = createRequest(communicator, 3, data);
+            const vector<Ice::Byte>::const_iterator half = request.begin() + request.size() / 2;
+            connection.sendFrame(OP_DATA, request.begin(), half);
+            connection.sendFrame(FLAG_FINAL | OP_CONT, half, request.end());
+            vector<Ice::Byte> reply;
+            test(connection.readFrame(reply) == (FLAG_FINAL | FLAG_RSV1 | OP_DATA));
+            test(readReply(communicator, inflateMessage(inflater, reply), 3) == data);
+
+            deflateEnd(&deflater);
+            inflateEnd(&inflater);
+        }
+        catch(...)
+        {
+            server->destroy();
+            throw;
+        }
+        server->destroy();
+    }
+    cout << "ok" << endl;
+}
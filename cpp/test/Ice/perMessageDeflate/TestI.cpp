@@ -0,0 +1,28 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+
+Test::ByteSeq
+TestIntfI::echo(const Test::ByteSeq& seq, const Ice::Current&)
+{
+    return seq;
+}
+
+string
+TestIntfI::getOffer(const Ice::Current& current)
+{
+    Ice::WSConnectionInfoPtr info = Ice::WSConnectionInfoPtr::dynamicCast(current.con->getInfo());
+    assert(info);
+    Ice::HeaderDict::const_iterator p = info->headers.find("Sec-WebSocket-Extensions");
+    return p == info->headers.end() ? string() : p->second;
+}
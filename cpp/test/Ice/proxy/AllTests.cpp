@@ -690,6 +690,81 @@ allTests(const Ice::CommunicatorPtr& communicator)
 
     cout << "ok" << endl;
 
+    cout << "testing proxy sharing... " << flush;
+    {
+        //
+        // Proxies with the same endpoints share the endpoint objects,
+        // whether they are parsed or unmarshaled.
+        //
+        Ice::ObjectPrx p1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10000:udp -h 127.0.0.1 -p 10001");
+        Ice::ObjectPrx p2 = communicator->stringToProxy("bar:tcp -h 127.0.0.1 -p 10000:udp -h 127.0.0.1 -p 10001");
+        Ice::EndpointSeq endpts1 = p1->ice_getEndpoints();
+        Ice::EndpointSeq endpts2 = p2->ice_getEndpoints();
+        test(endpts1.size() == 2 && endpts2.size() == 2);
+        test(endpts1[0].get() == endpts2[0].get());
+        test(endpts1[1].get() == endpts2[1].get());
+
+        Ice::OutputStreamPtr out = Ice::createOutputStream(communicator);
+        out->write(p2);
+        vector<Ice::Byte> data;
+        out->finished(data);
+        Ice::InputStreamPtr in = Ice::createInputStream(communicator, data);
+        Ice::ObjectPrx p3;
+        in->read(p3);
+        test(p3 == p2);
+        endpts2 = p3->ice_getEndpoints();
+        test(endpts1[0].get() == endpts2[0].get());
+        test(endpts1[1].get() == endpts2[1].get());
+
+        endpts2 = p1->ice_endpoints(communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10000")->ice_getEndpoints())->
+            ice_getEndpoints();
+        test(endpts2.size() == 1 && endpts1[0].get() == endpts2[0].get());
+
+        test(communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 10002")->ice_getEndpoints()[0].get() !=
+             endpts1[0].get());
+
+        Ice::Context ctx;
+        ctx["one"] = "hello";
+        test(p1->ice_context(ctx)->ice_getContext() == ctx);
+        test(p1->ice_context(ctx) != p1);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing proxy parsing and unmarshaling throughput... " << flush;
+    {
+        const int count = 20000;
+        const string str = "test -e 1.1:tcp -h 127.0.0.1 -p 12010 -t 10000:udp -h 127.0.0.1 -p 12010";
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < count; ++i)
+        {
+            test(communicator->stringToProxy(str));
+        }
+        IceUtil::Time parsing = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        Ice::ObjectPrx prx = communicator->stringToProxy(str);
+        Ice::OutputStreamPtr out = Ice::createOutputStream(communicator);
+        for(int i = 0; i < count; ++i)
+        {
+            out->write(prx);
+        }
+        vector<Ice::Byte> data;
+        out->finished(data);
+
+        start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        Ice::InputStreamPtr in = Ice::createInputStream(communicator, data);
+        for(int i = 0; i < count; ++i)
+        {
+            Ice::ObjectPrx p;
+            in->read(p);
+            test(p);
+        }
+        IceUtil::Time unmarshaling = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+
+        cout << "ok (" << static_cast<int>(count / parsing.toSecondsDouble()) << " parsed/s, "
+             << static_cast<int>(count / unmarshaling.toSecondsDouble()) << " unmarshaled/s)" << endl;
+    }
+
     cout << "testing checked cast... " << flush;
     Test::MyClassPrx cl = Test::MyClassPrx::checkedCast(base);
     test(cl);
@@ -258,5 +258,64 @@ allTests(const Ice::CommunicatorPtr& communicator, const Ice::CommunicatorPtr& c
     }
     cout << "ok" << endl;
 
+    if(retry1->ice_getConnection())
+    {
+        cout << "testing admission control... " << flush;
+        RetryPrx limited = RetryPrx::uncheckedCast(communicator->stringToProxy("retry:default -p 12011"));
+        Ice::ConnectionPtr connection = limited->ice_getConnection();
+        testInvocationCount(-1);
+        testFailureCount(-1);
+        testRetryCount(-1);
+
+        //
+        // The adapter only accepts one request at a time, the second
+        // request is rejected with an overloaded reply while the first
+        // one is dispatched. The rejected request isn't idempotent but
+        // it's retried since it wasn't dispatched, until the retry
+        // limit is reached. The connection isn't closed.
+        //
+        Ice::AsyncResultPtr r = limited->begin_sleep(1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        try
+        {
+            limited->op(false);
+            test(false);
+        }
+        catch(const Ice::UnknownLocalException& ex)
+        {
+            test(ex.unknown.find("overloaded") != string::npos);
+        }
+        testRetryCount(4);
+        testFailureCount(1);
+        limited->end_sleep(r);
+        testInvocationCount(2);
+
+        limited->op(false);
+        test(limited->ice_getConnection() == connection);
+        testInvocationCount(2);
+        testFailureCount(0);
+        testRetryCount(0);
+
+        //
+        // A rejected request is retried with another endpoint of the
+        // proxy rather than over the connection to the overloaded
+        // adapter, which stays open.
+        //
+        RetryPrx replicated = RetryPrx::uncheckedCast(
+            communicator->stringToProxy("retry:default -p 12011:default -p 12010")->ice_endpointSelection(
+                Ice::Ordered));
+        test(replicated->ice_getConnection() == connection);
+        testInvocationCount(-1);
+        r = limited->begin_sleep(1000);
+        IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(100));
+        replicated->op(false);
+        testRetryCount(1);
+        testFailureCount(0);
+        limited->end_sleep(r);
+        testInvocationCount(2);
+        test(replicated->ice_getConnection() != connection);
+        cout << "ok" << endl;
+    }
+
     return retry1;
 }
@@ -23,6 +23,17 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
     Ice::ObjectPtr object = new RetryI;
     adapter->add(object, communicator->stringToIdentity("retry"));
     adapter->activate();
+
+    //
+    // An adapter which accepts a single request at a time, used to
+    // test admission control.
+    //
+    communicator->getProperties()->setProperty("LimitedAdapter.Endpoints", "default -p 12011");
+    communicator->getProperties()->setProperty("LimitedAdapter.MaxInFlight", "1");
+    communicator->getProperties()->setProperty("LimitedAdapter.ThreadPool.Size", "2");
+    Ice::ObjectAdapterPtr limitedAdapter = communicator->createObjectAdapter("LimitedAdapter");
+    limitedAdapter->add(object, communicator->stringToIdentity("retry"));
+    limitedAdapter->activate();
     TEST_READY
     communicator->waitForShutdown();
     return EXIT_SUCCESS;
@@ -62,6 +62,12 @@ RetryI::opSystemException(const Ice::Current&)
     throw SystemFailure(__FILE__, __LINE__);
 }
 
+void
+RetryI::sleep(Ice::Int delay, const Ice::Current&)
+{
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
+}
+
 void
 RetryI::shutdown(const Ice::Current& current)
 {
@@ -22,6 +22,7 @@ public:
     virtual int opIdempotent(int, const Ice::Current&);
     virtual void opNotIdempotent(const Ice::Current&);
     virtual void opSystemException(const Ice::Current&);
+    virtual void sleep(Ice::Int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 
 private:
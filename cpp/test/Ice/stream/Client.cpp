@@ -94,6 +94,79 @@ public:
 };
 typedef IceUtil::Handle<TestReadObjectCallback> TestReadObjectCallbackPtr;
 
+//
+// Writes an instance with a type ID chosen at runtime, used to marshal
+// instances of many types.
+//
+class TypeIdObjectWriter : public Ice::ObjectWriter
+{
+public:
+
+    TypeIdObjectWriter(const string& t, Ice::Int v) : typeId(t), value(v)
+    {
+    }
+
+    virtual void
+    write(const Ice::OutputStreamPtr& out) const
+    {
+        out->startObject(0);
+        out->startSlice(typeId, -1, true);
+        out->write(value);
+        out->endSlice();
+        out->endObject();
+    }
+
+    const string typeId;
+    const Ice::Int value;
+};
+
+class TypeIdObjectReader : public Ice::ObjectReader
+{
+public:
+
+    TypeIdObjectReader(vector<Ice::Int>& order) : value(-1), _order(order)
+    {
+    }
+
+    virtual void
+    read(const Ice::InputStreamPtr& in)
+    {
+        in->startObject();
+        typeId = in->startSlice();
+        in->read(value);
+        in->endSlice();
+        in->endObject(false);
+        _order.push_back(value);
+    }
+
+    string typeId;
+    Ice::Int value;
+
+private:
+
+    vector<Ice::Int>& _order;
+};
+typedef IceUtil::Handle<TypeIdObjectReader> TypeIdObjectReaderPtr;
+
+class TypeIdObjectFactory : public Ice::ObjectFactory
+{
+public:
+
+    virtual Ice::ObjectPtr
+    create(const string&)
+    {
+        return new TypeIdObjectReader(order);
+    }
+
+    virtual void
+    destroy()
+    {
+    }
+
+    vector<Ice::Int> order; // The values of the instances in the order they are read.
+};
+typedef IceUtil::Handle<TypeIdObjectFactory> TypeIdObjectFactoryPtr;
+
 class MyClassFactoryWrapper : public Ice::ObjectFactory
 {
 public:
@@ -1112,6 +1185,132 @@ run(int, char**, const Ice::CommunicatorPtr& communicator)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing large object graphs... " << flush;
+    {
+        //
+        // More instances and type IDs than the encoders and decoders
+        // keep in their small tables.
+        //
+        const int typeCount = 20;
+        const int instanceCount = 40;
+        TypeIdObjectFactoryPtr factory = new TypeIdObjectFactory;
+        vector<string> typeIds;
+        for(int i = 0; i < typeCount; ++i)
+        {
+            ostringstream os;
+            os << "::Test::Dynamic" << i;
+            typeIds.push_back(os.str());
+            communicator->addObjectFactory(factory, typeIds.back());
+        }
+
+        Ice::EncodingVersion encodings[] = { Ice::Encoding_1_0, Ice::Encoding_1_1 };
+        for(size_t e = 0; e < sizeof(encodings) / sizeof(encodings[0]); ++e)
+        {
+            //
+            // Each instance is written twice, the second reference must
+            // be decoded to the same instance. With the 1.0 encoding,
+            // the instances are written after the references in the
+            // order they were first referenced.
+            //
+            Ice::OutputStreamPtr out = Ice::createOutputStream(communicator, encodings[e]);
+            vector<Ice::ObjectPtr> writers;
+            for(int i = 0; i < instanceCount; ++i)
+            {
+                writers.push_back(new TypeIdObjectWriter(typeIds[i % typeCount], i));
+            }
+            for(int i = 0; i < 2 * instanceCount; ++i)
+            {
+                out->writeObject(writers[i % instanceCount]);
+            }
+            out->writePendingObjects();
+            vector<Ice::Byte> data;
+            out->finished(data);
+
+            factory->order.clear();
+            Ice::InputStreamPtr in = Ice::createInputStream(communicator, data, encodings[e]);
+            vector<TestReadObjectCallbackPtr> callbacks;
+            for(int i = 0; i < 2 * instanceCount; ++i)
+            {
+                callbacks.push_back(new TestReadObjectCallback);
+                in->readObject(callbacks.back());
+            }
+            in->readPendingObjects();
+
+            test(static_cast<int>(factory->order.size()) == instanceCount);
+            for(int i = 0; i < instanceCount; ++i)
+            {
+                test(factory->order[i] == i);
+                TypeIdObjectReaderPtr reader = TypeIdObjectReaderPtr::dynamicCast(callbacks[i]->obj);
+                test(reader);
+                test(reader->value == i);
+                test(reader->typeId == typeIds[i % typeCount]);
+                test(callbacks[i + instanceCount]->obj == reader);
+            }
+        }
+
+        {
+            //
+            // An instance ID far greater than the number of instances the
+            // stream can hold is decoded without a table indexed by ID.
+            //
+            Ice::OutputStreamPtr out = Ice::createOutputStream(communicator, Ice::Encoding_1_0);
+            Ice::OutputStream::size_type ref = out->pos();
+            out->writeObject(new TypeIdObjectWriter(typeIds[0], 1));
+            Ice::OutputStream::size_type pending = out->pos();
+            out->writePendingObjects();
+            out->rewrite(-0x7fffffff, ref);
+            out->rewrite(0x7fffffff, pending + 1); // After the size of the pending instances.
+            vector<Ice::Byte> data;
+            out->finished(data);
+
+            factory->order.clear();
+            Ice::InputStreamPtr in = Ice::createInputStream(communicator, data, Ice::Encoding_1_0);
+            TestReadObjectCallbackPtr cb = new TestReadObjectCallback;
+            in->readObject(cb);
+            in->readPendingObjects();
+            TypeIdObjectReaderPtr reader = TypeIdObjectReaderPtr::dynamicCast(cb->obj);
+            test(reader && reader->value == 1);
+        }
+
+        for(size_t e = 0; e < sizeof(encodings) / sizeof(encodings[0]); ++e)
+        {
+            //
+            // A reference to a forged instance ID is rejected once the
+            // instances are read.
+            //
+            Ice::OutputStreamPtr out = Ice::createOutputStream(communicator, encodings[e]);
+            if(encodings[e] == Ice::Encoding_1_0)
+            {
+                out->write(-0x7fffffff);
+                out->writeSize(0);
+            }
+            else
+            {
+                out->writeSize(0x7fffffff);
+                out->writeObject(new TypeIdObjectWriter(typeIds[0], 1));
+            }
+            vector<Ice::Byte> data;
+            out->finished(data);
+
+            Ice::InputStreamPtr in = Ice::createInputStream(communicator, data, encodings[e]);
+            try
+            {
+                in->readObject(new TestReadObjectCallback);
+                if(encodings[e] == Ice::Encoding_1_1)
+                {
+                    in->readObject(new TestReadObjectCallback);
+                }
+                in->readPendingObjects();
+                test(false);
+            }
+            catch(const Ice::MarshalException&)
+            {
+            }
+        }
+    }
+    cout << "ok" << endl;
+
     return 0;
 }
 
@@ -257,6 +257,38 @@ allTests(const Ice::CommunicatorPtr& communicator)
     }
     cout << "ok" << endl;
 
+    cout << "testing deadline propagation... " << flush;
+    {
+        test(timeout->remainingTime() == -1);
+        test(timeout->nestedRemainingTime(0) == -1);
+
+        TimeoutPrx to = timeout->ice_invocationTimeout(1000);
+        Ice::Int remaining = to->remainingTime();
+        test(remaining > 0 && remaining <= 1000);
+        remaining = to->end_remainingTime(to->begin_remainingTime());
+        test(remaining > 0 && remaining <= 1000);
+        remaining = to->nestedRemainingTime(100);
+        test(remaining > 0 && remaining <= 900);
+
+        //
+        // A request whose deadline expired isn't dispatched, and a
+        // nested request made after the deadline expired is dropped.
+        //
+        Ice::Context ctx;
+        ctx["_deadline"] = "0";
+        try
+        {
+            timeout->op(ctx);
+            test(false);
+        }
+        catch(const Ice::UnknownLocalException&)
+        {
+        }
+        ctx["_deadline"] = "100";
+        test(timeout->nestedRemainingTime(300, ctx) == -2);
+    }
+    cout << "ok" << endl;
+
     cout << "testing close timeout... " << flush;
     {
         TimeoutPrx to = TimeoutPrx::checkedCast(obj->ice_timeout(100));
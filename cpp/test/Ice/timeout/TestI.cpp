@@ -61,6 +61,37 @@ TimeoutI::holdAdapter(Ice::Int to, const Ice::Current& current)
     threadControl.detach();
 }
 
+Ice::Int
+TimeoutI::remainingTime(const Ice::Current&)
+{
+    Ice::Long deadline = Ice::getDispatchDeadline();
+    if(deadline == 0)
+    {
+        return -1;
+    }
+    Ice::Long remaining = deadline - IceUtil::Time::now(IceUtil::Time::Monotonic).toMilliSeconds();
+    return static_cast<Ice::Int>(remaining > 0 ? remaining : 0);
+}
+
+Ice::Int
+TimeoutI::nestedRemainingTime(Ice::Int delay, const Ice::Current& current)
+{
+    IceUtil::ThreadControl::sleep(IceUtil::Time::milliSeconds(delay));
+    Test::TimeoutPrx self = Test::TimeoutPrx::uncheckedCast(current.adapter->createProxy(current.id));
+    try
+    {
+        return self->remainingTime();
+    }
+    catch(const Ice::UnknownLocalException&)
+    {
+        //
+        // The nested request was not dispatched because its deadline
+        // already expired.
+        //
+        return -2;
+    }
+}
+
 void
 TimeoutI::shutdown(const Ice::Current& current)
 {
@@ -20,6 +20,8 @@ public:
     virtual void sendData(const Test::ByteSeq&, const Ice::Current&);
     virtual void sleep(Ice::Int, const Ice::Current&);
     virtual void holdAdapter(Ice::Int, const Ice::Current&);
+    virtual Ice::Int remainingTime(const Ice::Current&);
+    virtual Ice::Int nestedRemainingTime(Ice::Int, const Ice::Current&);
     virtual void shutdown(const Ice::Current&);
 };
 
@@ -20,6 +20,36 @@
 using namespace IceUtil;
 using namespace std;
 
+namespace
+{
+
+//
+// A UTF-8 buffer which counts the calls to getMoreBytes(), the wide
+// string converter asks for more bytes when the target is exhausted.
+//
+class TestUTF8Buffer : public UTF8Buffer
+{
+public:
+
+    TestUTF8Buffer() : calls(0)
+    {
+    }
+
+    virtual Byte*
+    getMoreBytes(size_t howMany, Byte* firstUnused)
+    {
+        ++calls;
+        size_t used = firstUnused ? static_cast<size_t>(firstUnused - &bytes[0]) : 0;
+        bytes.resize(used + howMany);
+        return &bytes[0] + used;
+    }
+
+    vector<Byte> bytes;
+    int calls;
+};
+
+}
+
 //
 // Note that each file starts with a BOM; stringToWstring and wstringToString
 // converts these BOMs back and forth.
@@ -182,6 +212,74 @@ main(int argc, char* argv[])
         cout << "ok" << endl;
     }
 
+    {
+        cout << "testing ASCII runs... ";
+
+        //
+        // ASCII characters are converted and validated by blocks of 8
+        // bytes. The runs below end before, on and after a block
+        // boundary and are followed by multi-byte characters.
+        //
+        const size_t lengths[] = { 1, 7, 8, 9, 15, 16, 17, 0 };
+        for(size_t i = 0; lengths[i] != 0; ++i)
+        {
+            string ascii;
+            wstring wascii;
+            for(size_t j = 0; j < lengths[i]; ++j)
+            {
+                ascii += static_cast<char>('a' + j);
+                wascii += static_cast<wchar_t>('a' + j);
+            }
+
+            //
+            // U+00E9 (2 bytes in UTF-8) and U+20AC (3 bytes).
+            //
+            string utf8 = ascii + "\xc3\xa9" + ascii + "\xe2\x82\xac" + ascii;
+            wstring wide = wascii + wchar_t(0xE9) + wascii + wchar_t(0x20AC) + wascii;
+
+            test(isLegalUTF8Sequence(reinterpret_cast<const Byte*>(utf8.data()),
+                                     reinterpret_cast<const Byte*>(utf8.data() + utf8.size())));
+            test(stringToWstring(ascii) == wascii);
+            test(stringToWstring(utf8) == wide);
+            test(wstringToString(wascii) == ascii);
+            test(wstringToString(wide) == utf8);
+
+            //
+            // The UTF-8 encoding is longer than the wide string, so the
+            // target gets exhausted in the middle of an ASCII run once
+            // the first chunk is full.
+            //
+            wide = wchar_t(0xE9) + wascii;
+            utf8 = "\xc3\xa9" + ascii;
+            TestUTF8Buffer buffer;
+            UnicodeWstringConverter converter;
+            Byte* last = converter.toUTF8(wide.data(), wide.data() + wide.size(), buffer);
+            test(string(reinterpret_cast<const char*>(&buffer.bytes[0]), reinterpret_cast<const char*>(last)) == utf8);
+            test(buffer.calls == (utf8.size() > max<size_t>(wide.size(), 6) ? 2 : 1));
+
+            //
+            // An invalid byte at each position of the run.
+            //
+            for(size_t j = 0; j < lengths[i]; ++j)
+            {
+                string bad = ascii + ascii;
+                bad[j] = '\x80';
+                test(!isLegalUTF8Sequence(reinterpret_cast<const Byte*>(bad.data()),
+                                          reinterpret_cast<const Byte*>(bad.data() + bad.size())));
+                try
+                {
+                    stringToWstring(bad);
+                    test(false);
+                }
+                catch(const IceUtil::IllegalConversionException&)
+                {
+                }
+            }
+        }
+
+        cout << "ok" << endl;
+    }
+
     {
         cout << "testing error handling... ";
 
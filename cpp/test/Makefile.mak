@@ -20,7 +20,8 @@ SUBDIRS		= IceUtil \
 		  Slice \
 		  Ice \
 		  IceSSL \
-		  IceDiscovery
+		  IceDiscovery \
+		  Perf
 !else
 SUBDIRS		= IceUtil \
 		  Slice \
@@ -32,7 +33,8 @@ SUBDIRS		= IceUtil \
 		  FreezeScript \
 		  IceGrid \
 		  IceBox \
-		  IceDiscovery
+		  IceDiscovery \
+		  Perf
 
 !endif
 
@@ -0,0 +1,528 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/StringUtil.h>
+#include <IceUtil/Time.h>
+#include <TestCommon.h>
+#include <TestI.h>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+
+DEFINE_TEST("client")
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+//
+// Measure the throughput and the latency of invocations over each
+// transport and with a collocated servant. For each benchmark the
+// client reports the operations per second, the payload throughput
+// and the 50th, 90th and 99th latency percentiles in microseconds.
+// With the Perf.Output property the results are also written to the
+// given file in CSV format, to compare the results of two builds.
+//
+// Perf.Count          Number of ping invocations per benchmark, the
+//                     payload benchmarks use fewer invocations as
+//                     the payload grows.
+// Perf.Outstanding    Number of outstanding AMI invocations.
+// Perf.BatchSize      Number of batch oneways per flush.
+// Perf.Transports     Transports to measure, from tcp, ws, ssl, udp
+//                     and collocated.
+// Perf.Output         CSV output file.
+//
+
+struct Payload
+{
+    Payload() : size(0)
+    {
+    }
+
+    int size;
+    ByteSeq bytes;
+    FixedSeq fixed;
+    NodePtr graph;
+};
+
+typedef void (*Invocation)(const ThroughputPrx&, const Payload&);
+
+void
+ping(const ThroughputPrx& proxy, const Payload&)
+{
+    proxy->ping();
+}
+
+void
+sendBytes(const ThroughputPrx& proxy, const Payload& payload)
+{
+    proxy->sendBytes(make_pair(&payload.bytes[0], &payload.bytes[0] + payload.bytes.size()));
+}
+
+void
+recvBytes(const ThroughputPrx& proxy, const Payload& payload)
+{
+    test(static_cast<int>(proxy->recvBytes(payload.size).size()) == payload.size);
+}
+
+void
+sendFixed(const ThroughputPrx& proxy, const Payload& payload)
+{
+    proxy->sendFixed(payload.fixed);
+}
+
+void
+recvFixed(const ThroughputPrx& proxy, const Payload& payload)
+{
+    test(static_cast<int>(proxy->recvFixed(payload.size).size()) == payload.size);
+}
+
+void
+sendGraph(const ThroughputPrx& proxy, const Payload& payload)
+{
+    proxy->sendGraph(payload.graph);
+}
+
+void
+recvGraph(const ThroughputPrx& proxy, const Payload& payload)
+{
+    test(proxy->recvGraph(payload.size)->value == payload.size);
+}
+
+struct Result
+{
+    Result() : operations(0), bytes(0)
+    {
+    }
+
+    int operations;
+    IceUtil::Time elapsed;
+    Ice::Long bytes; // Payload bytes per operation.
+    vector<IceUtil::Int64> latencies; // In microseconds, empty if not measured.
+};
+
+class Reporter
+{
+public:
+
+    Reporter(const string& file)
+    {
+        if(!file.empty())
+        {
+            _csv.open(file.c_str());
+            if(!_csv)
+            {
+                Ice::FileException ex(__FILE__, __LINE__);
+                ex.path = file;
+                throw ex;
+            }
+            _csv << "transport,benchmark,size,operations,seconds,ops_per_sec,mb_per_sec,p50_us,p90_us,p99_us,max_us"
+                 << endl;
+        }
+
+        cout << setw(12) << left << "transport" << setw(18) << "benchmark" << right << setw(9) << "size"
+             << setw(12) << "ops/s" << setw(10) << "MB/s" << setw(9) << "p50 us" << setw(9) << "p90 us"
+             << setw(9) << "p99 us" << endl;
+    }
+
+    void report(const string& transport, const string& benchmark, int size, Result& result)
+    {
+        test(result.operations > 0);
+
+        double seconds = result.elapsed.toSecondsDouble();
+        double ops = result.operations / seconds;
+        double mbs = static_cast<double>(result.bytes) * result.operations / (1024 * 1024) / seconds;
+
+        IceUtil::Int64 p50 = 0;
+        IceUtil::Int64 p90 = 0;
+        IceUtil::Int64 p99 = 0;
+        IceUtil::Int64 max = 0;
+        if(!result.latencies.empty())
+        {
+            sort(result.latencies.begin(), result.latencies.end());
+            p50 = percentile(result.latencies, 50);
+            p90 = percentile(result.latencies, 90);
+            p99 = percentile(result.latencies, 99);
+            max = result.latencies.back();
+        }
+
+        cout << setw(12) << left << transport << setw(18) << benchmark << right << setw(9);
+        if(size > 0)
+        {
+            cout << size;
+        }
+        else
+        {
+            cout << "-";
+        }
+        cout << fixed << setprecision(0) << setw(12) << ops << setprecision(1) << setw(10);
+        if(result.bytes > 0)
+        {
+            cout << mbs;
+        }
+        else
+        {
+            cout << "-";
+        }
+        if(!result.latencies.empty())
+        {
+            cout << setw(9) << p50 << setw(9) << p90 << setw(9) << p99;
+        }
+        else
+        {
+            cout << setw(9) << "-" << setw(9) << "-" << setw(9) << "-";
+        }
+        cout << endl;
+
+        if(_csv)
+        {
+            _csv << transport << ',' << benchmark << ',' << size << ',' << result.operations << ',' << fixed
+                 << setprecision(6) << seconds << ',' << setprecision(1) << ops << ',' << setprecision(3) << mbs;
+            if(!result.latencies.empty())
+            {
+                _csv << ',' << p50 << ',' << p90 << ',' << p99 << ',' << max;
+            }
+            else
+            {
+                _csv << ",,,,";
+            }
+            _csv << endl;
+        }
+    }
+
+private:
+
+    static IceUtil::Int64 percentile(const vector<IceUtil::Int64>& sorted, int p)
+    {
+        size_t rank = (sorted.size() * p + 99) / 100; // Nearest rank.
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+
+    ofstream _csv;
+};
+
+//
+// Invoke count times and measure the latency of each invocation. The
+// oneway and batch oneway invocations are followed by a twoway ping on
+// the sync proxy, if any, to wait for their dispatch. The latency of
+// batch oneways is not measured.
+//
+Result
+measure(const ThroughputPrx& proxy, const ThroughputPrx& sync, Invocation invocation, const Payload& payload,
+        int count, int batchSize = 0)
+{
+    Result result;
+    result.operations = count;
+    if(batchSize == 0)
+    {
+        result.latencies.reserve(count);
+    }
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < count; ++i)
+    {
+        if(batchSize > 0)
+        {
+            invocation(proxy, payload);
+            if((i + 1) % batchSize == 0 || i + 1 == count)
+            {
+                proxy->ice_flushBatchRequests();
+            }
+        }
+        else
+        {
+            IceUtil::Time t = IceUtil::Time::now(IceUtil::Time::Monotonic);
+            invocation(proxy, payload);
+            result.latencies.push_back((IceUtil::Time::now(IceUtil::Time::Monotonic) - t).toMicroSeconds());
+        }
+    }
+    if(sync)
+    {
+        sync->ping();
+    }
+    result.elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    return result;
+}
+
+//
+// Keep the given number of AMI invocations outstanding. The latency
+// of an invocation includes the time spent waiting behind the other
+// outstanding invocations.
+//
+Result
+measureAsync(const ThroughputPrx& proxy, int count, int outstanding)
+{
+    Result result;
+    result.operations = count;
+    result.latencies.reserve(count);
+
+    deque<pair<Ice::AsyncResultPtr, IceUtil::Time> > pending;
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int i = 0; i < count; ++i)
+    {
+        if(static_cast<int>(pending.size()) == outstanding)
+        {
+            proxy->end_ping(pending.front().first);
+            result.latencies.push_back(
+                (IceUtil::Time::now(IceUtil::Time::Monotonic) - pending.front().second).toMicroSeconds());
+            pending.pop_front();
+        }
+        IceUtil::Time t = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        pending.push_back(make_pair(proxy->begin_ping(), t));
+    }
+    while(!pending.empty())
+    {
+        proxy->end_ping(pending.front().first);
+        result.latencies.push_back(
+            (IceUtil::Time::now(IceUtil::Time::Monotonic) - pending.front().second).toMicroSeconds());
+        pending.pop_front();
+    }
+    result.elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    return result;
+}
+
+//
+// The payload benchmarks send about as many bytes as count invocations
+// with a payload of 1KB, with at least 10 invocations.
+//
+int
+scaled(int count, Ice::Long bytes)
+{
+    return static_cast<int>(max(static_cast<Ice::Long>(10), count * static_cast<Ice::Long>(1024) / max(bytes,
+                                                                                  static_cast<Ice::Long>(1024))));
+}
+
+void
+runPayloads(Reporter& reporter, const string& transport, const ThroughputPrx& proxy, int count)
+{
+    const int byteSizes[] = { 1024, 64 * 1024, 1024 * 1024 };
+    for(size_t i = 0; i < sizeof(byteSizes) / sizeof(byteSizes[0]); ++i)
+    {
+        Payload payload;
+        payload.size = byteSizes[i];
+        payload.bytes = createBytes(payload.size);
+        int n = scaled(count, payload.size);
+
+        Result result = measure(proxy, 0, sendBytes, payload, n);
+        result.bytes = payload.size;
+        reporter.report(transport, "send bytes", payload.size, result);
+
+        result = measure(proxy, 0, recvBytes, payload, n);
+        result.bytes = payload.size;
+        reporter.report(transport, "recv bytes", payload.size, result);
+    }
+
+    //
+    // A Fixed struct is marshaled with 16 bytes.
+    //
+    const int fixedSizes[] = { 100, 10000 };
+    for(size_t i = 0; i < sizeof(fixedSizes) / sizeof(fixedSizes[0]); ++i)
+    {
+        Payload payload;
+        payload.size = fixedSizes[i];
+        payload.fixed = createFixed(payload.size);
+        int n = scaled(count, payload.size * 16);
+
+        Result result = measure(proxy, 0, sendFixed, payload, n);
+        result.bytes = payload.size * 16;
+        reporter.report(transport, "send structs", payload.size, result);
+
+        result = measure(proxy, 0, recvFixed, payload, n);
+        result.bytes = payload.size * 16;
+        reporter.report(transport, "recv structs", payload.size, result);
+    }
+
+    //
+    // The size of the class graphs is their number of nodes, their
+    // marshaled size depends on the encoding so the MB/s aren't
+    // reported.
+    //
+    const int depths[] = { 4, 10 };
+    for(size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); ++i)
+    {
+        Payload payload;
+        payload.size = depths[i];
+        payload.graph = createGraph(payload.size);
+        int nodes = (1 << payload.size) - 1;
+        int n = scaled(count, nodes * 16);
+
+        Result result = measure(proxy, 0, sendGraph, payload, n);
+        reporter.report(transport, "send graph", nodes, result);
+
+        result = measure(proxy, 0, recvGraph, payload, n);
+        reporter.report(transport, "recv graph", nodes, result);
+    }
+}
+
+void
+runTransport(Reporter& reporter, const string& transport, const ThroughputPrx& proxy, int count, int outstanding,
+             int batchSize)
+{
+    Payload empty;
+    if(transport == "udp")
+    {
+        //
+        // Only oneway invocations are supported with udp, the results
+        // only measure how fast the client sends the datagrams.
+        //
+        ThroughputPrx oneway = proxy->ice_datagram();
+        measure(oneway, 0, ping, empty, 100);
+
+        Result result = measure(oneway, 0, ping, empty, count);
+        reporter.report(transport, "oneway", 0, result);
+
+        result = measure(proxy->ice_batchDatagram(), 0, ping, empty, count, batchSize);
+        reporter.report(transport, "batch oneway", 0, result);
+
+        Payload payload;
+        payload.size = 1024;
+        payload.bytes = createBytes(payload.size);
+        result = measure(oneway, 0, sendBytes, payload, count);
+        result.bytes = payload.size;
+        reporter.report(transport, "send bytes", payload.size, result);
+        return;
+    }
+
+    measure(proxy, 0, ping, empty, 100); // Warm up the connection.
+
+    Result result = measure(proxy, 0, ping, empty, count);
+    reporter.report(transport, "twoway", 0, result);
+
+    result = measure(proxy->ice_oneway(), proxy, ping, empty, count);
+    reporter.report(transport, "oneway", 0, result);
+
+    result = measure(proxy->ice_batchOneway(), proxy, ping, empty, count, batchSize);
+    reporter.report(transport, "batch oneway", 0, result);
+
+    result = measureAsync(proxy, count, outstanding);
+    ostringstream ami;
+    ami << "ami x" << outstanding;
+    reporter.report(transport, ami.str(), 0, result);
+
+    runPayloads(reporter, transport, proxy, count);
+
+    if(transport != "collocated")
+    {
+        //
+        // Compressed requests, the payload of the byte benchmarks
+        // compresses well.
+        //
+        ThroughputPrx compressed = proxy->ice_compress(true);
+        const int sizes[] = { 64 * 1024, 1024 * 1024 };
+        for(size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        {
+            Payload payload;
+            payload.size = sizes[i];
+            payload.bytes = createBytes(payload.size);
+            result = measure(compressed, 0, sendBytes, payload, scaled(count, payload.size));
+            result.bytes = payload.size;
+            reporter.report(transport, "send compressed", payload.size, result);
+        }
+    }
+}
+
+}
+
+int
+run(int, char**, const Ice::CommunicatorPtr& communicator)
+{
+    Ice::PropertiesPtr properties = communicator->getProperties();
+    int count = max(properties->getPropertyAsIntWithDefault("Perf.Count", 10000), 10);
+    int outstanding = max(properties->getPropertyAsIntWithDefault("Perf.Outstanding", 100), 1);
+    int batchSize = max(properties->getPropertyAsIntWithDefault("Perf.BatchSize", 100), 1);
+
+    bool ssl = !properties->getProperty("Ice.Plugin.IceSSL").empty();
+    string defaultTransports = ssl ? "tcp ws ssl udp collocated" : "tcp ws udp collocated";
+    vector<string> transports;
+    IceUtilInternal::splitString(properties->getPropertyWithDefault("Perf.Transports", defaultTransports), ", \t",
+                                 transports);
+
+    Reporter reporter(properties->getProperty("Perf.Output"));
+
+    //
+    // The collocated servant is hosted by an object adapter without
+    // endpoints.
+    //
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+    ThroughputPrx collocated = ThroughputPrx::uncheckedCast(adapter->addWithUUID(new ThroughputI));
+    adapter->activate();
+
+    for(vector<string>::const_iterator p = transports.begin(); p != transports.end(); ++p)
+    {
+        ThroughputPrx proxy;
+        if(*p == "collocated")
+        {
+            proxy = collocated;
+        }
+        else if(*p == "tcp" || *p == "udp")
+        {
+            proxy = ThroughputPrx::uncheckedCast(communicator->stringToProxy("test:" + *p + " -p 12010"));
+        }
+        else if(*p == "ws")
+        {
+            proxy = ThroughputPrx::uncheckedCast(communicator->stringToProxy("test:ws -p 12011"));
+        }
+        else if(*p == "ssl")
+        {
+            proxy = ThroughputPrx::uncheckedCast(communicator->stringToProxy("test:ssl -p 12012"));
+        }
+        else
+        {
+            cerr << "unknown transport `" << *p << "'" << endl;
+            return EXIT_FAILURE;
+        }
+        runTransport(reporter, *p, proxy, count, outstanding, batchSize);
+    }
+
+    ThroughputPrx::uncheckedCast(communicator->stringToProxy("test:tcp -p 12010"))->shutdown();
+    return EXIT_SUCCESS;
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status;
+    Ice::CommunicatorPtr communicator;
+
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+        args = initData.properties->parseCommandLineOptions("Perf", args);
+        Ice::stringSeqToArgs(args, argc, argv);
+        initData.properties->setProperty("Ice.MessageSizeMax", "0");
+        initData.properties->setProperty("Ice.Warn.Connections", "0");
+        communicator = Ice::initialize(argc, argv, initData);
+        status = run(argc, argv, communicator);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Ice::Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
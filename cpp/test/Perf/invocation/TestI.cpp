@@ -0,0 +1,97 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <TestI.h>
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+//
+// The payloads are shared by the client and the server. The bytes
+// repeat a short pattern so that they can be compressed.
+//
+ByteSeq
+createBytes(int size)
+{
+    ByteSeq seq(size);
+    for(int i = 0; i < size; ++i)
+    {
+        seq[i] = static_cast<Byte>(i % 61);
+    }
+    return seq;
+}
+
+FixedSeq
+createFixed(int size)
+{
+    FixedSeq seq(size);
+    for(int i = 0; i < size; ++i)
+    {
+        seq[i].i = i;
+        seq[i].j = size - i;
+        seq[i].d = i * 0.5;
+    }
+    return seq;
+}
+
+NodePtr
+createGraph(int depth)
+{
+    if(depth <= 0)
+    {
+        return 0;
+    }
+    return new Node(depth, createGraph(depth - 1), createGraph(depth - 1));
+}
+
+void
+ThroughputI::ping(const Current&)
+{
+}
+
+void
+ThroughputI::sendBytes(const pair<const Byte*, const Byte*>&, const Current&)
+{
+}
+
+ByteSeq
+ThroughputI::recvBytes(Int size, const Current&)
+{
+    return createBytes(size);
+}
+
+void
+ThroughputI::sendFixed(const FixedSeq&, const Current&)
+{
+}
+
+FixedSeq
+ThroughputI::recvFixed(Int size, const Current&)
+{
+    return createFixed(size);
+}
+
+void
+ThroughputI::sendGraph(const NodePtr&, const Current&)
+{
+}
+
+NodePtr
+ThroughputI::recvGraph(Int depth, const Current&)
+{
+    return createGraph(depth);
+}
+
+void
+ThroughputI::shutdown(const Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,37 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include <Test.h>
+
+Test::ByteSeq createBytes(int);
+Test::FixedSeq createFixed(int);
+Test::NodePtr createGraph(int);
+
+class ThroughputI : public Test::Throughput
+{
+public:
+
+    virtual void ping(const Ice::Current&);
+
+    virtual void sendBytes(const std::pair<const Ice::Byte*, const Ice::Byte*>&, const Ice::Current&);
+    virtual Test::ByteSeq recvBytes(Ice::Int, const Ice::Current&);
+
+    virtual void sendFixed(const Test::FixedSeq&, const Ice::Current&);
+    virtual Test::FixedSeq recvFixed(Ice::Int, const Ice::Current&);
+
+    virtual void sendGraph(const Test::NodePtr&, const Ice::Current&);
+    virtual Test::NodePtr recvGraph(Ice::Int, const Ice::Current&);
+
+    virtual void shutdown(const Ice::Current&);
+};
+
+#endif
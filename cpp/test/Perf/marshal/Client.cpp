@@ -0,0 +1,544 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Ice/BasicStream.h>
+#include <IceUtil/Atomic.h>
+#include <IceUtil/Time.h>
+#include <IceUtil/UniquePtr.h>
+#include <TestCommon.h>
+#include <Test.h>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+
+//
+// Every allocation made with operator new is counted, including the
+// allocations made by the Ice library. With Visual C++ the library
+// uses the operator new of its own DLL so only the allocations of the
+// generated code are counted. The buffers of the streams are allocated
+// with malloc and aren't counted.
+//
+IceUtilInternal::Atomic allocations;
+
+}
+
+#ifdef ICE_CPP11
+void*
+operator new(size_t size)
+#else
+void*
+operator new(size_t size) throw(std::bad_alloc)
+#endif
+{
+    ++allocations;
+    void* p = malloc(size > 0 ? size : 1);
+    if(!p)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+#ifdef ICE_CPP11
+void*
+operator new[](size_t size)
+#else
+void*
+operator new[](size_t size) throw(std::bad_alloc)
+#endif
+{
+    return operator new(size);
+}
+
+void
+operator delete(void* p) ICE_NOEXCEPT
+{
+    free(p);
+}
+
+void
+operator delete[](void* p) ICE_NOEXCEPT
+{
+    free(p);
+}
+
+namespace
+{
+
+//
+// Marshal and unmarshal the Slice types of Test.ice with the 1.0 and
+// 1.1 encodings and report the time and the number of allocations per
+// operation. Each case is encoded in an encapsulation, as the
+// parameters of a request. Each measure runs for Perf.Duration
+// milliseconds.
+//
+class Case : public IceUtil::Shared
+{
+public:
+
+    Case(const string& name, Ice::FormatType format = Ice::DefaultFormat) :
+        _name(name), _format(format)
+    {
+    }
+
+    const string& name() const
+    {
+        return _name;
+    }
+
+    void encode(const IceInternal::InstancePtr& instance, const Ice::EncodingVersion& encoding)
+    {
+        IceInternal::BasicStream out(instance.get(), encoding);
+        out.startWriteEncaps(encoding, _format);
+        write(out);
+        out.endWriteEncaps();
+    }
+
+    void decode(const IceInternal::InstancePtr& instance, const Ice::EncodingVersion& encoding,
+                const vector<Ice::Byte>& bytes)
+    {
+        IceInternal::BasicStream in(instance.get(), encoding, &bytes[0], &bytes[0] + bytes.size());
+        in.startReadEncaps();
+        read(in);
+        in.endReadEncaps();
+    }
+
+    vector<Ice::Byte> encoded(const IceInternal::InstancePtr& instance, const Ice::EncodingVersion& encoding)
+    {
+        IceInternal::BasicStream out(instance.get(), encoding);
+        out.startWriteEncaps(encoding, _format);
+        write(out);
+        out.endWriteEncaps();
+        return vector<Ice::Byte>(out.b.begin(), out.b.end());
+    }
+
+    //
+    // Check the value read by the last decode.
+    //
+    virtual void check(const Ice::EncodingVersion&) = 0;
+
+protected:
+
+    virtual void write(IceInternal::BasicStream&) = 0;
+    virtual void read(IceInternal::BasicStream&) = 0;
+
+private:
+
+    const string _name;
+    const Ice::FormatType _format;
+};
+typedef IceUtil::Handle<Case> CasePtr;
+
+template<typename T> class ValueCase : public Case
+{
+public:
+
+    ValueCase(const string& name, const T& value) :
+        Case(name), _value(value)
+    {
+    }
+
+    virtual void check(const Ice::EncodingVersion&)
+    {
+        test(_result == _value);
+    }
+
+protected:
+
+    virtual void write(IceInternal::BasicStream& out)
+    {
+        out.write(_value);
+    }
+
+    virtual void read(IceInternal::BasicStream& in)
+    {
+        in.read(_result);
+    }
+
+private:
+
+    const T _value;
+    T _result;
+};
+
+class OptionalsCase : public Case
+{
+public:
+
+    OptionalsCase(const OptionalsPtr& value) :
+        Case("optionals"), _value(value)
+    {
+    }
+
+    virtual void check(const Ice::EncodingVersion& encoding)
+    {
+        test(_result && _result->required == _value->required);
+        if(encoding == Ice::Encoding_1_0)
+        {
+            test(!_result->i && !_result->s && !_result->seq && !_result->p && !_result->c);
+        }
+        else
+        {
+            test(_result->i == _value->i && _result->s == _value->s && _result->seq == _value->seq);
+            test(_result->p == _value->p && _result->c == _value->c);
+        }
+    }
+
+protected:
+
+    virtual void write(IceInternal::BasicStream& out)
+    {
+        out.write(_value);
+        out.writePendingObjects();
+    }
+
+    virtual void read(IceInternal::BasicStream& in)
+    {
+        in.read(_result);
+        in.readPendingObjects();
+    }
+
+private:
+
+    const OptionalsPtr _value;
+    OptionalsPtr _result;
+};
+
+int
+countNodes(const NodePtr& node)
+{
+    return node ? 1 + countNodes(node->left) + countNodes(node->right) : 0;
+}
+
+NodePtr
+createGraph(int depth)
+{
+    return depth > 0 ? new Node(depth, createGraph(depth - 1), createGraph(depth - 1)) : NodePtr();
+}
+
+class GraphCase : public Case
+{
+public:
+
+    GraphCase(int depth) :
+        Case("class graph"), _value(createGraph(depth))
+    {
+    }
+
+    virtual void check(const Ice::EncodingVersion&)
+    {
+        test(countNodes(_result) == countNodes(_value));
+    }
+
+protected:
+
+    virtual void write(IceInternal::BasicStream& out)
+    {
+        out.write(_value);
+        out.writePendingObjects();
+    }
+
+    virtual void read(IceInternal::BasicStream& in)
+    {
+        in.read(_result);
+        in.readPendingObjects();
+    }
+
+private:
+
+    const NodePtr _value;
+    NodePtr _result;
+};
+
+//
+// An exception whose type ID is unknown to the receiver, which slices it
+// to Derived. The 1.1 encoding can only skip the unknown slice if the
+// exception is encoded with the sliced format.
+//
+class UnknownDerived : public Derived
+{
+public:
+
+    UnknownDerived(const Derived& value, const IntSeq& extra) :
+        Derived(value), extra(extra)
+    {
+    }
+
+    virtual ~UnknownDerived() throw()
+    {
+    }
+
+    virtual string ice_name() const
+    {
+        return "Test::UnknownDerived";
+    }
+
+    virtual UnknownDerived* ice_clone() const
+    {
+        return new UnknownDerived(*this);
+    }
+
+    virtual void ice_throw() const
+    {
+        throw *this;
+    }
+
+    IntSeq extra;
+
+protected:
+
+    virtual void __writeImpl(IceInternal::BasicStream* os) const
+    {
+        os->startWriteSlice("::Test::UnknownDerived", -1, false);
+        os->write(extra);
+        os->endWriteSlice();
+        Derived::__writeImpl(os);
+    }
+
+    using Derived::__writeImpl;
+};
+
+//
+// Unmarshaling an exception throws it, as when the reply of a request
+// carries a user exception.
+//
+class ExceptionCase : public Case
+{
+public:
+
+    ExceptionCase(const string& name, const Derived& value, Ice::FormatType format = Ice::DefaultFormat) :
+        Case(name, format), _value(value.ice_clone())
+    {
+    }
+
+    virtual void check(const Ice::EncodingVersion&)
+    {
+        test(_reason == _value->reason && _values == _value->values && _primitives == _value->primitives);
+    }
+
+protected:
+
+    virtual void write(IceInternal::BasicStream& out)
+    {
+        out.writeException(*_value);
+    }
+
+    virtual void read(IceInternal::BasicStream& in)
+    {
+        try
+        {
+            in.throwException();
+            test(false);
+        }
+        catch(const Derived& ex)
+        {
+            test(ex.ice_name() == "Test::Derived");
+            _reason = ex.reason;
+            _values = ex.values;
+            _primitives = ex.primitives;
+        }
+    }
+
+private:
+
+    const IceUtil::UniquePtr<Derived> _value;
+    string _reason;
+    IntSeq _values;
+    Primitives _primitives;
+};
+
+Primitives
+createPrimitives(int n)
+{
+    Primitives p;
+    p.b = n % 2 == 0;
+    p.by = static_cast<Ice::Byte>(n);
+    p.s = static_cast<Ice::Short>(n);
+    p.i = n;
+    p.l = static_cast<Ice::Long>(n) << 32;
+    p.f = static_cast<Ice::Float>(n) / 3;
+    p.d = static_cast<Ice::Double>(n) / 7;
+    p.str = "primitives";
+    p.c = static_cast<Color>(n % 3);
+    return p;
+}
+
+vector<CasePtr>
+createCases()
+{
+    vector<CasePtr> cases;
+
+    cases.push_back(new ValueCase<Primitives>("struct", createPrimitives(1)));
+
+    IntSeq ints;
+    StringSeq strings;
+    PrimitivesSeq structs;
+    IntStringDict intDict;
+    StringPrimitivesDict structDict;
+    for(int i = 0; i < 100; ++i)
+    {
+        ostringstream os;
+        os << "string " << i;
+        ints.push_back(i);
+        strings.push_back(os.str());
+        structs.push_back(createPrimitives(i));
+        intDict[i] = os.str();
+        structDict[os.str()] = createPrimitives(i);
+    }
+    cases.push_back(new ValueCase<IntSeq>("int seq", ints));
+    cases.push_back(new ValueCase<StringSeq>("string seq", strings));
+    cases.push_back(new ValueCase<PrimitivesSeq>("struct seq", structs));
+    cases.push_back(new ValueCase<IntStringDict>("int dict", intDict));
+    cases.push_back(new ValueCase<StringPrimitivesDict>("struct dict", structDict));
+
+    OptionalsPtr optionals = new Optionals;
+    optionals->required = 1;
+    optionals->i = 2;
+    optionals->s = string("optional");
+    optionals->seq = ints;
+    optionals->p = createPrimitives(3);
+    optionals->c = blue;
+    cases.push_back(new OptionalsCase(optionals));
+
+    cases.push_back(new GraphCase(7));
+
+    Derived derived;
+    derived.reason = "derived";
+    derived.values = IntSeq(10, 5);
+    derived.primitives = createPrimitives(4);
+    cases.push_back(new ExceptionCase("exception", derived));
+    cases.push_back(new ExceptionCase("sliced exception", UnknownDerived(derived, ints), Ice::SlicedFormat));
+
+    return cases;
+}
+
+struct Result
+{
+    double ns;
+    double allocations;
+};
+
+//
+// The number of operations per batch is calibrated first, then the
+// batches are repeated for the given duration.
+//
+Result
+measure(const CasePtr& c, const IceInternal::InstancePtr& instance, const Ice::EncodingVersion& encoding,
+        const vector<Ice::Byte>* bytes, const IceUtil::Time& duration)
+{
+    int batch = 1;
+    while(true)
+    {
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(int i = 0; i < batch; ++i)
+        {
+            bytes ? c->decode(instance, encoding, *bytes) : c->encode(instance, encoding);
+        }
+        if(IceUtil::Time::now(IceUtil::Time::Monotonic) - start >= duration / 20)
+        {
+            break;
+        }
+        batch *= 2;
+    }
+
+    Ice::Long operations = 0;
+    int before = allocations.load();
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    IceUtil::Time elapsed;
+    do
+    {
+        for(int i = 0; i < batch; ++i)
+        {
+            bytes ? c->decode(instance, encoding, *bytes) : c->encode(instance, encoding);
+        }
+        operations += batch;
+        elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+    }
+    while(elapsed < duration);
+    unsigned int count = static_cast<unsigned int>(allocations.load() - before);
+
+    Result result;
+    result.ns = elapsed.toMicroSecondsDouble() * 1000 / operations;
+    result.allocations = static_cast<double>(count) / operations;
+    return result;
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status = EXIT_SUCCESS;
+    Ice::CommunicatorPtr communicator;
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+        args = initData.properties->parseCommandLineOptions("Perf", args);
+        Ice::stringSeqToArgs(args, argc, argv);
+        communicator = Ice::initialize(argc, argv, initData);
+
+        IceUtil::Time duration = IceUtil::Time::milliSeconds(
+            max(communicator->getProperties()->getPropertyAsIntWithDefault("Perf.Duration", 100), 1));
+
+        IceInternal::InstancePtr instance = IceInternal::getInstance(communicator);
+        vector<CasePtr> cases = createCases();
+
+        cout << setw(18) << left << "case" << setw(10) << "encoding" << right << setw(8) << "bytes" << setw(14)
+             << "write ns/op" << setw(14) << "write allocs" << setw(14) << "read ns/op" << setw(14) << "read allocs"
+             << endl;
+
+        const Ice::EncodingVersion encodings[] = { Ice::Encoding_1_0, Ice::Encoding_1_1 };
+        for(vector<CasePtr>::const_iterator p = cases.begin(); p != cases.end(); ++p)
+        {
+            for(size_t i = 0; i < sizeof(encodings) / sizeof(encodings[0]); ++i)
+            {
+                vector<Ice::Byte> bytes = (*p)->encoded(instance, encodings[i]);
+                (*p)->decode(instance, encodings[i], bytes);
+                (*p)->check(encodings[i]);
+
+                Result write = measure(*p, instance, encodings[i], 0, duration);
+                Result read = measure(*p, instance, encodings[i], &bytes, duration);
+
+                cout << setw(18) << left << (*p)->name() << setw(10) << Ice::encodingVersionToString(encodings[i]) << right << setw(8)
+                     << bytes.size() << fixed << setprecision(0) << setw(14) << write.ns << setprecision(1)
+                     << setw(14) << write.allocations << setprecision(0) << setw(14) << read.ns << setprecision(1)
+                     << setw(14) << read.allocations << endl;
+            }
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Ice::Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
@@ -0,0 +1,187 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <IceUtil/Thread.h>
+#include <IceUtil/Time.h>
+#include <TestCommon.h>
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+//
+// Measure the throughput of twoway ice_ping invocations sent by
+// several threads over a loopback connection, with metrics disabled
+// and with metrics enabled in the client and the server. With the
+// "id" view each operation and connection gets its own metrics entry,
+// with the "none" view all the invocations and dispatches update the
+// same entry.
+//
+class Pinger : public IceUtil::Thread
+{
+public:
+
+    Pinger(const Ice::ObjectPrx& proxy, const IceUtil::Time& duration) :
+        _proxy(proxy), _duration(duration), _count(0)
+    {
+    }
+
+    virtual void run()
+    {
+        IceUtil::Time end = IceUtil::Time::now(IceUtil::Time::Monotonic) + _duration;
+        while(IceUtil::Time::now(IceUtil::Time::Monotonic) < end)
+        {
+            for(int i = 0; i < 100; ++i)
+            {
+                _proxy->ice_ping();
+            }
+            _count += 100;
+        }
+    }
+
+    int count() const
+    {
+        return _count;
+    }
+
+private:
+
+    const Ice::ObjectPrx _proxy;
+    const IceUtil::Time _duration;
+    int _count;
+};
+typedef IceUtil::Handle<Pinger> PingerPtr;
+
+class PingI : public Ice::Object
+{
+};
+
+Ice::InitializationData
+createInitData(const Ice::PropertiesPtr& defaults, const string& groupBy, int threads)
+{
+    ostringstream size;
+    size << threads;
+
+    Ice::InitializationData initData;
+    initData.properties = defaults->clone();
+    initData.properties->setProperty("Ice.ThreadPool.Client.Size", size.str());
+    initData.properties->setProperty("Ice.ThreadPool.Server.Size", size.str());
+    if(!groupBy.empty())
+    {
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("Ice.Admin.InstanceName", "Perf");
+        initData.properties->setProperty("IceMX.Metrics.Perf.GroupBy", groupBy);
+    }
+    return initData;
+}
+
+double
+run(const Ice::PropertiesPtr& defaults, const string& groupBy, int threads, const IceUtil::Time& duration)
+{
+    Ice::CommunicatorPtr server = Ice::initialize(createInitData(defaults, groupBy, threads));
+    Ice::CommunicatorPtr client;
+    double callsPerSecond = 0;
+    try
+    {
+        server->getProperties()->setProperty("TestAdapter.Endpoints", "default -p 12010");
+        Ice::ObjectAdapterPtr adapter = server->createObjectAdapter("TestAdapter");
+        adapter->add(new PingI, server->stringToIdentity("test"));
+        adapter->activate();
+
+        client = Ice::initialize(createInitData(defaults, groupBy, threads));
+        Ice::ObjectPrx proxy = client->stringToProxy("test:default -p 12010");
+
+        //
+        // Warm up the connection and the metrics entries.
+        //
+        for(int i = 0; i < 1000; ++i)
+        {
+            proxy->ice_ping();
+        }
+
+        vector<PingerPtr> pingers;
+        for(int i = 0; i < threads; ++i)
+        {
+            pingers.push_back(new Pinger(proxy, duration));
+        }
+
+        IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+        for(vector<PingerPtr>::const_iterator p = pingers.begin(); p != pingers.end(); ++p)
+        {
+            (*p)->start();
+        }
+        int count = 0;
+        for(vector<PingerPtr>::const_iterator p = pingers.begin(); p != pingers.end(); ++p)
+        {
+            (*p)->getThreadControl().join();
+            count += (*p)->count();
+        }
+        IceUtil::Time elapsed = IceUtil::Time::now(IceUtil::Time::Monotonic) - start;
+        callsPerSecond = count / elapsed.toSecondsDouble();
+    }
+    catch(...)
+    {
+        if(client)
+        {
+            client->destroy();
+        }
+        server->destroy();
+        throw;
+    }
+
+    client->destroy();
+    server->destroy();
+    return callsPerSecond;
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status = EXIT_SUCCESS;
+    try
+    {
+        Ice::PropertiesPtr properties = Ice::createProperties(argc, argv);
+        Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+        args = properties->parseCommandLineOptions("Perf", args);
+
+        IceUtil::Time duration = IceUtil::Time::milliSeconds(properties->getPropertyAsIntWithDefault("Perf.Duration",
+                                                                                                    1000));
+        int maxThreads = properties->getPropertyAsIntWithDefault("Perf.Threads", 4);
+        if(maxThreads <= 0)
+        {
+            maxThreads = 1;
+        }
+
+        cout << "twoway ice_ping invocations per second, " << duration.toMilliSeconds() << "ms per run" << endl;
+        cout << setw(8) << left << "threads" << right << setw(12) << "off" << setw(12) << "id" << setw(8) << "%"
+             << setw(12) << "none" << setw(8) << "%" << endl;
+        for(int threads = 1; threads <= maxThreads; threads *= 2)
+        {
+            double off = run(properties, "", threads, duration);
+            double id = run(properties, "id", threads, duration);
+            double none = run(properties, "none", threads, duration);
+            test(off > 0 && id > 0 && none > 0);
+
+            cout << setw(8) << left << threads << right << fixed << setprecision(0) << setw(12) << off << setw(12)
+                 << id << setprecision(1) << setw(8) << (id / off - 1) * 100 << setprecision(0) << setw(12) << none
+                 << setprecision(1) << setw(8) << (none / off - 1) * 100 << endl;
+        }
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+    return status;
+}
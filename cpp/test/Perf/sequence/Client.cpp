@@ -0,0 +1,192 @@
+// **********************************************************************
+//
+// Copyright (c) 2003-2015 ZeroC, Inc. All rights reserved.
+//
+// This copy of Ice is licensed to you under the terms described in the
+// ICE_LICENSE file included in this distribution.
+//
+// **********************************************************************
+
+#include <Ice/Ice.h>
+#include <Ice/BasicStream.h>
+#include <IceUtil/Time.h>
+#include <TestCommon.h>
+#include <iomanip>
+
+using namespace std;
+
+namespace
+{
+
+//
+// Marshal and unmarshal sequences of primitive types with a large
+// number of elements and report the time per operation and the
+// throughput. The results are checked once after the timed loops.
+//
+const int SequenceSize = 1000000;
+
+template<typename T> T
+element(int n)
+{
+    return static_cast<T>(n % 127);
+}
+
+template<> bool
+element<bool>(int n)
+{
+    return n % 3 == 0;
+}
+
+void
+report(const string& name, const string& op, IceUtil::Time elapsed, int repetitions, size_t bytes)
+{
+    double ms = elapsed.toMilliSecondsDouble() / repetitions;
+    double mbs = (static_cast<double>(bytes) / (1024 * 1024)) / (ms / 1000);
+    cout << setw(8) << left << name << setw(12) << op << right << fixed << setprecision(3) << setw(10) << ms
+         << " ms  " << setprecision(1) << setw(10) << mbs << " MB/s" << endl;
+}
+
+template<typename T> void
+run(const IceInternal::InstancePtr& instance, const string& name, int repetitions)
+{
+    vector<T> seq(SequenceSize);
+    for(int n = 0; n < SequenceSize; ++n)
+    {
+        seq[n] = element<T>(n);
+    }
+    size_t bytes = SequenceSize * sizeof(T);
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int n = 0; n < repetitions; ++n)
+    {
+        IceInternal::BasicStream out(instance.get(), Ice::currentEncoding);
+        out.write(seq);
+    }
+    report(name, "write", IceUtil::Time::now(IceUtil::Time::Monotonic) - start, repetitions, bytes);
+
+    IceInternal::BasicStream data(instance.get(), Ice::currentEncoding);
+    data.write(seq);
+    const Ice::Byte* begin = &data.b[0];
+    const Ice::Byte* end = begin + data.b.size();
+
+    vector<T> result;
+    start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int n = 0; n < repetitions; ++n)
+    {
+        IceInternal::BasicStream in(instance.get(), Ice::currentEncoding, begin, end);
+        in.read(result);
+    }
+    report(name, "read", IceUtil::Time::now(IceUtil::Time::Monotonic) - start, repetitions, bytes);
+    test(result == seq);
+
+    pair<const T*, const T*> p;
+    IceUtil::ScopedArray<T> array;
+    start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int n = 0; n < repetitions; ++n)
+    {
+        IceInternal::BasicStream in(instance.get(), Ice::currentEncoding, begin, end);
+        in.read(p, array);
+    }
+    report(name, "read array", IceUtil::Time::now(IceUtil::Time::Monotonic) - start, repetitions, bytes);
+    test(static_cast<int>(p.second - p.first) == SequenceSize);
+    test(equal(p.first, p.second, seq.begin()));
+}
+
+//
+// Wide strings go through the UTF-8 transcoding of the wstring converter.
+//
+const int WstringSequenceSize = 100000;
+
+void
+runWstring(const IceInternal::InstancePtr& instance, const string& name, const wstring& value, int repetitions)
+{
+    vector<wstring> seq(WstringSequenceSize, value);
+
+    IceInternal::BasicStream data(instance.get(), Ice::currentEncoding);
+    data.write(seq);
+    const Ice::Byte* begin = &data.b[0];
+    const Ice::Byte* end = begin + data.b.size();
+    size_t bytes = data.b.size();
+
+    IceUtil::Time start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int n = 0; n < repetitions; ++n)
+    {
+        IceInternal::BasicStream out(instance.get(), Ice::currentEncoding);
+        out.write(seq);
+    }
+    report(name, "write", IceUtil::Time::now(IceUtil::Time::Monotonic) - start, repetitions, bytes);
+
+    vector<wstring> result;
+    start = IceUtil::Time::now(IceUtil::Time::Monotonic);
+    for(int n = 0; n < repetitions; ++n)
+    {
+        IceInternal::BasicStream in(instance.get(), Ice::currentEncoding, begin, end);
+        in.read(result);
+    }
+    report(name, "read", IceUtil::Time::now(IceUtil::Time::Monotonic) - start, repetitions, bytes);
+    test(result == seq);
+}
+
+}
+
+int
+main(int argc, char* argv[])
+{
+    int status = EXIT_SUCCESS;
+    Ice::CommunicatorPtr communicator;
+    try
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties(argc, argv);
+        Ice::StringSeq args = Ice::argsToStringSeq(argc, argv);
+        args = initData.properties->parseCommandLineOptions("Perf", args);
+        Ice::stringSeqToArgs(args, argc, argv);
+        initData.properties->setProperty("Ice.MessageSizeMax", "0");
+        communicator = Ice::initialize(argc, argv, initData);
+
+        int repetitions = communicator->getProperties()->getPropertyAsIntWithDefault("Perf.Repetitions", 50);
+        if(repetitions <= 0)
+        {
+            repetitions = 1;
+        }
+
+        cout << "marshaling sequences of " << SequenceSize << " elements, " << repetitions << " repetitions" << endl;
+
+        IceInternal::InstancePtr instance = IceInternal::getInstance(communicator);
+        run<bool>(instance, "bool", repetitions);
+        run<Ice::Short>(instance, "short", repetitions);
+        run<Ice::Int>(instance, "int", repetitions);
+        run<Ice::Long>(instance, "long", repetitions);
+        run<Ice::Float>(instance, "float", repetitions);
+        run<Ice::Double>(instance, "double", repetitions);
+
+        cout << "marshaling sequences of " << WstringSequenceSize << " wide strings, " << repetitions
+             << " repetitions" << endl;
+
+        runWstring(instance, "ascii", L"The quick brown fox jumps over the lazy dog", repetitions);
+        runWstring(instance, "latin", L"Voix ambigu\u00EB d'un c\u0153ur qui au z\u00E9phyr pr\u00E9f\u00E8re les jattes",
+                   repetitions);
+        runWstring(instance, "cjk", L"\u5929\u5730\u7384\u9EC4\u5B87\u5B99\u6D2A\u8352\u65E5\u6708\u76C8\u6603",
+                   repetitions);
+    }
+    catch(const Ice::Exception& ex)
+    {
+        cerr << ex << endl;
+        status = EXIT_FAILURE;
+    }
+
+    if(communicator)
+    {
+        try
+        {
+            communicator->destroy();
+        }
+        catch(const Ice::Exception& ex)
+        {
+            cerr << ex << endl;
+            status = EXIT_FAILURE;
+        }
+    }
+
+    return status;
+}
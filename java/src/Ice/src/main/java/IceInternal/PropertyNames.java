@@ -67,6 +67,9 @@ public final class PropertyNames
         new Property("Ice\\.Admin\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("Ice\\.Admin\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("Ice\\.Admin\\.MessageSizeMax", false, null),
+        new Property("Ice\\.Admin\\.MaxInFlight", false, null),
+        new Property("Ice\\.Admin\\.TargetQueueDelay", false, null),
+        new Property("Ice\\.Admin\\.QueueDelayInterval", false, null),
         new Property("Ice\\.Admin\\.DelayCreation", false, null),
         new Property("Ice\\.Admin\\.Enabled", false, null),
         new Property("Ice\\.Admin\\.Facets", false, null),
@@ -118,13 +121,27 @@ public final class PropertyNames
         new Property("Ice\\.Default\\.Timeout", false, null),
         new Property("Ice\\.EventLog\\.Source", false, null),
         new Property("Ice\\.FactoryAssemblies", false, null),
+        new Property("Ice\\.FlightRecorder\\.File", false, null),
+        new Property("Ice\\.FlightRecorder\\.Size", false, null),
+        new Property("Ice\\.HedgeBudget", false, null),
+        new Property("Ice\\.HedgePercentile", false, null),
         new Property("Ice\\.HTTPProxyHost", false, null),
         new Property("Ice\\.HTTPProxyPort", false, null),
         new Property("Ice\\.ImplicitContext", false, null),
         new Property("Ice\\.InitPlugins", false, null),
         new Property("Ice\\.IPv4", false, null),
         new Property("Ice\\.IPv6", false, null),
+        new Property("Ice\\.LatencyAwareEndpointSelection", false, null),
+        new Property("Ice\\.LocatorCacheJitter", false, null),
+        new Property("Ice\\.LocatorCacheRefreshAhead", false, null),
         new Property("Ice\\.LogFile", false, null),
+        new Property("Ice\\.LogFile\\.MaxFiles", false, null),
+        new Property("Ice\\.LogFile\\.MaxSize", false, null),
+        new Property("Ice\\.LogFile\\.RotateInterval", false, null),
+        new Property("Ice\\.Logger\\.Async", false, null),
+        new Property("Ice\\.Logger\\.BufferSize", false, null),
+        new Property("Ice\\.Logger\\.FlushInterval", false, null),
+        new Property("Ice\\.Logger\\.Fsync", false, null),
         new Property("Ice\\.LogStdErr\\.Convert", false, null),
         new Property("Ice\\.MessageSizeMax", false, null),
         new Property("Ice\\.Nohup", false, null),
@@ -172,11 +189,21 @@ public final class PropertyNames
         new Property("Ice\\.Trace\\.Retry", false, null),
         new Property("Ice\\.Trace\\.Slicing", false, null),
         new Property("Ice\\.Trace\\.ThreadPool", false, null),
+        new Property("Ice\\.Tracing\\.BufferSize", false, null),
+        new Property("Ice\\.Tracing\\.Enabled", false, null),
+        new Property("Ice\\.Tracing\\.File", false, null),
+        new Property("Ice\\.Tracing\\.FlushInterval", false, null),
+        new Property("Ice\\.Tracing\\.Sample", false, null),
         new Property("Ice\\.UDP\\.RcvSize", false, null),
         new Property("Ice\\.UDP\\.SndSize", false, null),
         new Property("Ice\\.TCP\\.Backlog", false, null),
         new Property("Ice\\.TCP\\.RcvSize", false, null),
         new Property("Ice\\.TCP\\.SndSize", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate\\.ClientMaxWindowBits", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate\\.ClientNoContextTakeover", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate\\.ServerMaxWindowBits", false, null),
+        new Property("Ice\\.WS\\.PerMessageDeflate\\.ServerNoContextTakeover", false, null),
         new Property("Ice\\.UseApplicationClassLoader", false, null),
         new Property("Ice\\.UseSyslog", false, null),
         new Property("Ice\\.Warn\\.AMICallback", false, null),
@@ -242,6 +269,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceDiscovery\\.Multicast\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceDiscovery\\.Multicast\\.MessageSizeMax", false, null),
+        new Property("IceDiscovery\\.Multicast\\.MaxInFlight", false, null),
+        new Property("IceDiscovery\\.Multicast\\.TargetQueueDelay", false, null),
+        new Property("IceDiscovery\\.Multicast\\.QueueDelayInterval", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM\\.Timeout", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM\\.Heartbeat", false, null),
         new Property("IceDiscovery\\.Reply\\.ACM\\.Close", false, null),
@@ -279,6 +309,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceDiscovery\\.Reply\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceDiscovery\\.Reply\\.MessageSizeMax", false, null),
+        new Property("IceDiscovery\\.Reply\\.MaxInFlight", false, null),
+        new Property("IceDiscovery\\.Reply\\.TargetQueueDelay", false, null),
+        new Property("IceDiscovery\\.Reply\\.QueueDelayInterval", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM\\.Timeout", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM\\.Heartbeat", false, null),
         new Property("IceDiscovery\\.Locator\\.ACM\\.Close", false, null),
@@ -316,6 +349,9 @@ public final class PropertyNames
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceDiscovery\\.Locator\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceDiscovery\\.Locator\\.MessageSizeMax", false, null),
+        new Property("IceDiscovery\\.Locator\\.MaxInFlight", false, null),
+        new Property("IceDiscovery\\.Locator\\.TargetQueueDelay", false, null),
+        new Property("IceDiscovery\\.Locator\\.QueueDelayInterval", false, null),
         new Property("IceDiscovery\\.Lookup", false, null),
         new Property("IceDiscovery\\.Timeout", false, null),
         new Property("IceDiscovery\\.RetryCount", false, null),
@@ -366,6 +402,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Reply\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGridDiscovery\\.Reply\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGridDiscovery\\.Reply\\.MessageSizeMax", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.MaxInFlight", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.TargetQueueDelay", false, null),
+        new Property("IceGridDiscovery\\.Reply\\.QueueDelayInterval", false, null),
         new Property("IceGridDiscovery\\.Locator\\.ACM\\.Timeout", false, null),
         new Property("IceGridDiscovery\\.Locator\\.ACM\\.Heartbeat", false, null),
         new Property("IceGridDiscovery\\.Locator\\.ACM\\.Close", false, null),
@@ -403,6 +442,9 @@ public final class PropertyNames
         new Property("IceGridDiscovery\\.Locator\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGridDiscovery\\.Locator\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGridDiscovery\\.Locator\\.MessageSizeMax", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.MaxInFlight", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.TargetQueueDelay", false, null),
+        new Property("IceGridDiscovery\\.Locator\\.QueueDelayInterval", false, null),
         new Property("IceGridDiscovery\\.Lookup", false, null),
         new Property("IceGridDiscovery\\.Timeout", false, null),
         new Property("IceGridDiscovery\\.RetryCount", false, null),
@@ -414,6 +456,15 @@ public final class PropertyNames
         null
     };
 
+    public static final Property IceOpenMetricsProps[] = 
+    {
+        new Property("IceOpenMetrics\\.Host", false, null),
+        new Property("IceOpenMetrics\\.Port", false, null),
+        new Property("IceOpenMetrics\\.Path", false, null),
+        new Property("IceOpenMetrics\\.Timeout", false, null),
+        null
+    };
+
     public static final Property IceBoxProps[] = 
     {
         new Property("IceBox\\.InheritProperties", false, null),
@@ -501,6 +552,9 @@ public final class PropertyNames
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGridAdmin\\.Discovery\\.Reply\\.MessageSizeMax", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.MaxInFlight", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.TargetQueueDelay", false, null),
+        new Property("IceGridAdmin\\.Discovery\\.Reply\\.QueueDelayInterval", false, null),
         new Property("IceGridAdmin\\.Trace\\.Observers", false, null),
         new Property("IceGridAdmin\\.Trace\\.SaveToRegistry", false, null),
         null
@@ -545,6 +599,9 @@ public final class PropertyNames
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.AdminRouter\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.AdminRouter\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.AdminRouter\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.AdminRouter\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.AdminRouter\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.InstanceName", false, null),
         new Property("IceGrid\\.Node\\.ACM\\.Timeout", false, null),
         new Property("IceGrid\\.Node\\.ACM\\.Heartbeat", false, null),
@@ -583,6 +640,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Node\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Node\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Node\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Node\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Node\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Node\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Node\\.AllowRunningServersAsRoot", false, null),
         new Property("IceGrid\\.Node\\.AllowEndpointsOverride", false, null),
         new Property("IceGrid\\.Node\\.CollocateRegistry", false, null),
@@ -660,6 +720,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Registry\\.AdminSessionManager\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Registry\\.AdminSessionManager\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.ConnectionCached", false, null),
         new Property("IceGrid\\.Registry\\.AdminSSLPermissionsVerifier\\.PreferSecure", false, null),
@@ -707,6 +770,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Registry\\.Client\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Registry\\.Client\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Registry\\.CryptPasswords", false, null),
         new Property("IceGrid\\.Registry\\.Data", false, null),
         new Property("IceGrid\\.Registry\\.DefaultTemplates", false, null),
@@ -747,6 +813,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Registry\\.Discovery\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Enabled", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Address", false, null),
         new Property("IceGrid\\.Registry\\.Discovery\\.Port", false, null),
@@ -789,6 +858,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Registry\\.Internal\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Registry\\.Internal\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Registry\\.NodeSessionTimeout", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.PermissionsVerifier\\.ConnectionCached", false, null),
@@ -841,6 +913,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Registry\\.Server\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Registry\\.Server\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Registry\\.SessionFilters", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ACM\\.Timeout", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ACM\\.Heartbeat", false, null),
@@ -879,6 +954,9 @@ public final class PropertyNames
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IceGrid\\.Registry\\.SessionManager\\.MessageSizeMax", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.MaxInFlight", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.TargetQueueDelay", false, null),
+        new Property("IceGrid\\.Registry\\.SessionManager\\.QueueDelayInterval", false, null),
         new Property("IceGrid\\.Registry\\.SessionTimeout", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.EndpointSelection", false, null),
         new Property("IceGrid\\.Registry\\.SSLPermissionsVerifier\\.ConnectionCached", false, null),
@@ -952,6 +1030,9 @@ public final class PropertyNames
         new Property("IcePatch2\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("IcePatch2\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("IcePatch2\\.MessageSizeMax", false, null),
+        new Property("IcePatch2\\.MaxInFlight", false, null),
+        new Property("IcePatch2\\.TargetQueueDelay", false, null),
+        new Property("IcePatch2\\.QueueDelayInterval", false, null),
         new Property("IcePatch2\\.Directory", false, null),
         new Property("IcePatch2\\.InstanceName", false, null),
         null
@@ -1065,6 +1146,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Client\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("Glacier2\\.Client\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("Glacier2\\.Client\\.MessageSizeMax", false, null),
+        new Property("Glacier2\\.Client\\.MaxInFlight", false, null),
+        new Property("Glacier2\\.Client\\.TargetQueueDelay", false, null),
+        new Property("Glacier2\\.Client\\.QueueDelayInterval", false, null),
         new Property("Glacier2\\.Client\\.AlwaysBatch", false, null),
         new Property("Glacier2\\.Client\\.Buffered", false, null),
         new Property("Glacier2\\.Client\\.ForwardContext", false, null),
@@ -1140,6 +1224,9 @@ public final class PropertyNames
         new Property("Glacier2\\.Server\\.ThreadPool\\.ThreadIdleTime", false, null),
         new Property("Glacier2\\.Server\\.ThreadPool\\.ThreadPriority", false, null),
         new Property("Glacier2\\.Server\\.MessageSizeMax", false, null),
+        new Property("Glacier2\\.Server\\.MaxInFlight", false, null),
+        new Property("Glacier2\\.Server\\.TargetQueueDelay", false, null),
+        new Property("Glacier2\\.Server\\.QueueDelayInterval", false, null),
         new Property("Glacier2\\.Server\\.AlwaysBatch", false, null),
         new Property("Glacier2\\.Server\\.Buffered", false, null),
         new Property("Glacier2\\.Server\\.ForwardContext", false, null),
@@ -1217,6 +1304,7 @@ public final class PropertyNames
         IceMXProps,
         IceDiscoveryProps,
         IceGridDiscoveryProps,
+        IceOpenMetricsProps,
         IceBoxProps,
         IceBoxAdminProps,
         IceGridAdminProps,
@@ -1237,6 +1325,7 @@ public final class PropertyNames
         "IceMX",
         "IceDiscovery",
         "IceGridDiscovery",
+        "IceOpenMetrics",
         "IceBox",
         "IceBoxAdmin",
         "IceGridAdmin",
@@ -68,6 +68,9 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadIdleTime/", false, null),
     new Property("/^Ice\.Admin\.ThreadPool\.ThreadPriority/", false, null),
     new Property("/^Ice\.Admin\.MessageSizeMax/", false, null),
+    new Property("/^Ice\.Admin\.MaxInFlight/", false, null),
+    new Property("/^Ice\.Admin\.TargetQueueDelay/", false, null),
+    new Property("/^Ice\.Admin\.QueueDelayInterval/", false, null),
     new Property("/^Ice\.Admin\.DelayCreation/", false, null),
     new Property("/^Ice\.Admin\.Enabled/", false, null),
     new Property("/^Ice\.Admin\.Facets/", false, null),
@@ -119,13 +122,27 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Default\.Timeout/", false, null),
     new Property("/^Ice\.EventLog\.Source/", false, null),
     new Property("/^Ice\.FactoryAssemblies/", false, null),
+    new Property("/^Ice\.FlightRecorder\.File/", false, null),
+    new Property("/^Ice\.FlightRecorder\.Size/", false, null),
+    new Property("/^Ice\.HedgeBudget/", false, null),
+    new Property("/^Ice\.HedgePercentile/", false, null),
     new Property("/^Ice\.HTTPProxyHost/", false, null),
     new Property("/^Ice\.HTTPProxyPort/", false, null),
     new Property("/^Ice\.ImplicitContext/", false, null),
     new Property("/^Ice\.InitPlugins/", false, null),
     new Property("/^Ice\.IPv4/", false, null),
     new Property("/^Ice\.IPv6/", false, null),
+    new Property("/^Ice\.LatencyAwareEndpointSelection/", false, null),
+    new Property("/^Ice\.LocatorCacheJitter/", false, null),
+    new Property("/^Ice\.LocatorCacheRefreshAhead/", false, null),
     new Property("/^Ice\.LogFile/", false, null),
+    new Property("/^Ice\.LogFile\.MaxFiles/", false, null),
+    new Property("/^Ice\.LogFile\.MaxSize/", false, null),
+    new Property("/^Ice\.LogFile\.RotateInterval/", false, null),
+    new Property("/^Ice\.Logger\.Async/", false, null),
+    new Property("/^Ice\.Logger\.BufferSize/", false, null),
+    new Property("/^Ice\.Logger\.FlushInterval/", false, null),
+    new Property("/^Ice\.Logger\.Fsync/", false, null),
     new Property("/^Ice\.LogStdErr\.Convert/", false, null),
     new Property("/^Ice\.MessageSizeMax/", false, null),
     new Property("/^Ice\.Nohup/", false, null),
@@ -173,11 +190,21 @@ PropertyNames.IceProps =
     new Property("/^Ice\.Trace\.Retry/", false, null),
     new Property("/^Ice\.Trace\.Slicing/", false, null),
     new Property("/^Ice\.Trace\.ThreadPool/", false, null),
+    new Property("/^Ice\.Tracing\.BufferSize/", false, null),
+    new Property("/^Ice\.Tracing\.Enabled/", false, null),
+    new Property("/^Ice\.Tracing\.File/", false, null),
+    new Property("/^Ice\.Tracing\.FlushInterval/", false, null),
+    new Property("/^Ice\.Tracing\.Sample/", false, null),
     new Property("/^Ice\.UDP\.RcvSize/", false, null),
     new Property("/^Ice\.UDP\.SndSize/", false, null),
     new Property("/^Ice\.TCP\.Backlog/", false, null),
     new Property("/^Ice\.TCP\.RcvSize/", false, null),
     new Property("/^Ice\.TCP\.SndSize/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate\.ClientMaxWindowBits/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate\.ClientNoContextTakeover/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate\.ServerMaxWindowBits/", false, null),
+    new Property("/^Ice\.WS\.PerMessageDeflate\.ServerNoContextTakeover/", false, null),
     new Property("/^Ice\.UseApplicationClassLoader/", false, null),
     new Property("/^Ice\.UseSyslog/", false, null),
     new Property("/^Ice\.Warn\.AMICallback/", false, null),